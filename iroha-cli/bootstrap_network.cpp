@@ -22,7 +22,11 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include "model/commands/add_asset_quantity.hpp"
 #include "model/commands/add_peer.hpp"
+#include "model/commands/create_account.hpp"
+#include "model/commands/create_asset.hpp"
+#include "model/commands/create_domain.hpp"
 #include "common/assert_config.hpp"
 #include "common/types.hpp"
 #include "ip_tools/ip_tools.hpp"
@@ -35,6 +39,33 @@ using namespace assert_config;
 
 namespace iroha_cli {
 
+  namespace {
+    const rapidjson::Value &get_member(const rapidjson::Value &value,
+                                       const char *name) {
+      assert_fatal(value.HasMember(name), no_member_error(name));
+      return value[name];
+    }
+
+    std::string get_string(const rapidjson::Value &value, const char *name) {
+      const auto &member = get_member(value, name);
+      assert_fatal(member.IsString(), type_error(name, "string"));
+      return member.GetString();
+    }
+
+    uint64_t get_uint(const rapidjson::Value &value, const char *name) {
+      const auto &member = get_member(value, name);
+      assert_fatal(member.IsUint64(), type_error(name, "unsigned integer"));
+      return member.GetUint64();
+    }
+
+    rapidjson::Value::ConstArray get_array(const rapidjson::Value &value,
+                                           const char *name) {
+      const auto &member = get_member(value, name);
+      assert_fatal(member.IsArray(), type_error(name, "array"));
+      return member.GetArray();
+    }
+  }  // namespace
+
   /**
    * parse trusted peers in `target.conf`
    * @param target_conf_path
@@ -133,6 +164,88 @@ namespace iroha_cli {
     return block;
   }
 
+  /**
+   * parse provisioning file `provisioning.json`:
+   * {"domains":["ru"],
+   *  "assets":[{"asset_name":"coin", "domain_id":"ru", "precision":2}],
+   *  "accounts":[{"account_name":"user", "domain_id":"ru", "pubkey":"hex",
+   *               "balances":[{"asset_id":"coin#ru",
+   *                            "amount":{"int_part":1, "frac_part":50}}]}]}
+   * @param provisioning_json_path
+   * @return iroha::model::Block
+   */
+  iroha::model::Block BootstrapNetwork::parse_provisioning_file(
+      std::string const &provisioning_json_path) {
+    std::ifstream ifs(provisioning_json_path);
+    assert_fatal(ifs.is_open(),
+                 "Cannot open: '" + provisioning_json_path + "'");
+
+    rapidjson::Document doc;
+    rapidjson::IStreamWrapper isw(ifs);
+    doc.ParseStream(isw);
+    assert_fatal(not doc.HasParseError(), parse_error(provisioning_json_path));
+    assert_fatal(doc.IsObject(), type_error("JSON", "object"));
+
+    iroha::model::Transaction tx;
+    for (const auto &json_domain : get_array(doc, "domains")) {
+      assert_fatal(json_domain.IsString(),
+                   type_error("an element in domains", "string"));
+      auto create_domain = std::make_shared<iroha::model::CreateDomain>();
+      create_domain->domain_name = json_domain.GetString();
+      tx.commands.push_back(create_domain);
+    }
+    for (const auto &json_asset : get_array(doc, "assets")) {
+      auto create_asset = std::make_shared<iroha::model::CreateAsset>();
+      create_asset->asset_name = get_string(json_asset, "asset_name");
+      create_asset->domain_id = get_string(json_asset, "domain_id");
+      create_asset->precision = get_uint(json_asset, "precision");
+      tx.commands.push_back(create_asset);
+    }
+    // balances are added after all accounts are created
+    std::vector<std::shared_ptr<iroha::model::Command>> add_balances;
+    for (const auto &json_account : get_array(doc, "accounts")) {
+      auto create_account = std::make_shared<iroha::model::CreateAccount>();
+      create_account->account_name = get_string(json_account, "account_name");
+      create_account->domain_id = get_string(json_account, "domain_id");
+      const auto pkbytes =
+          iroha::hex2bytes(get_string(json_account, "pubkey"));
+      assert_fatal(pkbytes.size() == create_account->pubkey.size(),
+                   "pubkey: '" + get_string(json_account, "pubkey")
+                       + "' is invalid.");
+      std::copy(
+          pkbytes.begin(), pkbytes.end(), create_account->pubkey.begin());
+      tx.commands.push_back(create_account);
+
+      if (not json_account.HasMember("balances")) {
+        continue;
+      }
+      for (const auto &json_balance : get_array(json_account, "balances")) {
+        auto add_asset = std::make_shared<iroha::model::AddAssetQuantity>();
+        add_asset->account_id =
+            create_account->account_name + "@" + create_account->domain_id;
+        add_asset->asset_id = get_string(json_balance, "asset_id");
+        const auto &json_amount = get_member(json_balance, "amount");
+        add_asset->amount.int_part = get_uint(json_amount, "int_part");
+        add_asset->amount.frac_part = get_uint(json_amount, "frac_part");
+        add_balances.push_back(add_asset);
+      }
+    }
+    tx.commands.insert(
+        tx.commands.end(), add_balances.begin(), add_balances.end());
+
+    iroha::model::Block block;
+    block.transactions.push_back(tx);
+    block.height = 1;
+    block.prev_hash.fill(0);
+    block.txs_number =
+        static_cast<decltype(block.txs_number)>(block.transactions.size());
+
+    auto hash_provider = iroha::model::HashProviderImpl();
+    block.hash = hash_provider.get_hash(block);
+
+    return block;
+  }
+
   /**
    * merges trusted peers AddPeer tx with given block
    * @param block
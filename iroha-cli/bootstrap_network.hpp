@@ -47,6 +47,15 @@ namespace iroha_cli {
     iroha::model::Block parse_genesis_block(
         std::string const& genesis_json_path);
 
+    /**
+     * parses provisioning file with domains, assets and accounts
+     * with their balances, and makes genesis block creating them
+     * @param provisioning_json_path
+     * @return iroha::model::Block
+     */
+    iroha::model::Block parse_provisioning_file(
+        std::string const& provisioning_json_path);
+
     /**
      * merges trusted peers AddPeer tx with given block
      * @param block
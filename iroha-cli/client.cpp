@@ -53,6 +53,58 @@ namespace iroha_cli {
                               iroha::protocol::STATELESS_VALIDATION_SUCCESS
                           ? OK
                           : NOT_VALID;
+    if (toriiResponse.admission() == iroha::protocol::ADMISSION_OVERLOADED) {
+      response.answer = OVERLOADED;
+    }
+    return response;
+  }
+
+  CliClient::Response<std::vector<CliClient::TxStatus>> CliClient::sendTxs(
+      std::string json_txs) {
+    CliClient::Response<std::vector<CliClient::TxStatus>> response;
+    auto doc = iroha::model::converters::stringToJson(std::move(json_txs));
+    if (not doc.has_value() or not doc.value().IsArray()) {
+      response.status = grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                     "transactions are not a json array");
+      return response;
+    }
+
+    iroha::model::converters::JsonTransactionFactory serializer;
+    iroha::model::converters::PbTransactionFactory factory;
+    iroha::protocol::TxList tx_list;
+    // positions of sent transactions in the array
+    std::vector<size_t> sent;
+    for (const auto &json_tx : doc.value().GetArray()) {
+      rapidjson::Document tx_doc;
+      tx_doc.CopyFrom(json_tx, tx_doc.GetAllocator());
+      auto tx_opt = serializer.deserialize(tx_doc);
+      if (not tx_opt.has_value()) {
+        response.answer.push_back(WRONG_FORMAT);
+        continue;
+      }
+      *tx_list.add_transactions() = factory.serialize(tx_opt.value());
+      sent.push_back(response.answer.size());
+      response.answer.push_back(OK);
+    }
+
+    // Send to iroha:
+    iroha::protocol::ToriiBatchResponse batch_response;
+    response.status = command_client_.ToriiBatch(tx_list, batch_response);
+    if (not response.status.ok()) {
+      return response;
+    }
+    for (int i = 0; i < batch_response.responses_size(); ++i) {
+      const auto &torii_response = batch_response.responses(i);
+      auto &answer = response.answer.at(sent.at(i));
+      answer = torii_response.validation()
+              == iroha::protocol::STATELESS_VALIDATION_SUCCESS
+          ? OK
+          : NOT_VALID;
+      if (torii_response.admission()
+          == iroha::protocol::ADMISSION_OVERLOADED) {
+        answer = OVERLOADED;
+      }
+    }
     return response;
   }
 
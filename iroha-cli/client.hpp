@@ -19,6 +19,7 @@
 #define IROHA_CLIENT_HPP
 
 #include <string>
+#include <vector>
 #include <torii_utils/query_client.hpp>
 #include "torii/command_client.hpp"
 
@@ -32,7 +33,7 @@ namespace iroha_cli {
       T answer;
     };
 
-    enum TxStatus { WRONG_FORMAT, NOT_VALID, OK,  };
+    enum TxStatus { WRONG_FORMAT, NOT_VALID, OK, OVERLOADED };
 
     CliClient(std::string target_ip, int port);
     /**
@@ -42,6 +43,14 @@ namespace iroha_cli {
      */
     CliClient::Response<CliClient::TxStatus> sendTx(std::string json_tx);
 
+    /**
+     * Send batch of transactions to Iroha-Network in one request
+     * @param json_txs - json array of transactions
+     * @return status of each transaction in the order of the array
+     */
+    CliClient::Response<std::vector<CliClient::TxStatus>> sendTxs(
+        std::string json_txs);
+
     CliClient::Response<iroha::protocol::QueryResponse> sendQuery(std::string json_query);
 
    private:
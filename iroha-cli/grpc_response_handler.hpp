@@ -28,6 +28,8 @@ namespace iroha_cli {
    public:
     GrpcResponseHandler();
     void handle(CliClient::Response<CliClient::TxStatus> response);
+    void handle(
+        CliClient::Response<std::vector<CliClient::TxStatus>> response);
     void handle(CliClient::Response<iroha::protocol::QueryResponse> response);
    private:
     TransactionResponseHandler tx_handler_;
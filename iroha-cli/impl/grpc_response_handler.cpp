@@ -50,6 +50,17 @@ namespace iroha_cli {
     }
   }
 
+  void GrpcResponseHandler::handle(
+      CliClient::Response<std::vector<CliClient::TxStatus>> response) {
+    if (response.status.ok()) {
+      for (auto status : response.answer) {
+        tx_handler_.handle(status);
+      }
+    } else {
+      handleGrpcErrors(response.status.error_code());
+    }
+  }
+
   void GrpcResponseHandler::handle(
       CliClient::Response<iroha::protocol::QueryResponse> response) {
     if (response.status.ok()) {
@@ -16,6 +16,7 @@
  */
 
 #include "query_response_handler.hpp"
+#include "common/types.hpp"
 
 using namespace iroha::protocol;
 namespace iroha_cli {
@@ -32,6 +33,8 @@ namespace iroha_cli {
         &QueryResponseHandler::handleSignatoriesResponse;
     handler_map_[QueryResponse::ResponseCase::kTransactionsResponse] =
         &QueryResponseHandler::handleTransactionsResponse;
+    handler_map_[QueryResponse::ResponseCase::kAssetHoldersResponse] =
+        &QueryResponseHandler::handleAssetHoldersResponse;
 
     // Error responses:
     error_handler_map_[ErrorResponse::STATEFUL_INVALID] =
@@ -44,6 +47,10 @@ namespace iroha_cli {
     error_handler_map_[ErrorResponse::NO_SIGNATORIES] = "No signatories found";
     error_handler_map_[ErrorResponse::NOT_SUPPORTED] = "Query not supported";
     error_handler_map_[ErrorResponse::WRONG_FORMAT] = "Query has wrong format";
+    error_handler_map_[ErrorResponse::OVERLOADED] =
+        "Peer is overloaded with queries, retry later";
+    error_handler_map_[ErrorResponse::DEADLINE_EXCEEDED] =
+        "Query was not executed in time, retry later";
   }
 
   void QueryResponseHandler::handle(
@@ -79,11 +86,21 @@ namespace iroha_cli {
 
   void QueryResponseHandler::handleAccountAssetsResponse(
       const iroha::protocol::QueryResponse &response) {
-    auto acc_assets = response.account_assets_response().account_asset();
+    auto acc_assets_response = response.account_assets_response();
     log_->info("[Account Assets]");
-    log_->info("-Account Id- {}", acc_assets.account_id());
-    log_->info("-Asset Id- {}", acc_assets.asset_id());
-    log_->info("-Balance- {}", acc_assets.balance());
+    if (acc_assets_response.account_assets_size() == 0) {
+      auto acc_assets = acc_assets_response.account_asset();
+      log_->info("-Account Id- {}", acc_assets.account_id());
+      log_->info("-Asset Id- {}", acc_assets.asset_id());
+      log_->info("-Balance- {}", acc_assets.balance());
+      return;
+    }
+    auto acc_assets = acc_assets_response.account_assets();
+    std::for_each(acc_assets.begin(), acc_assets.end(), [this](auto acc_asset) {
+      log_->info("-Account Id- {}", acc_asset.account_id());
+      log_->info("-Asset Id- {}", acc_asset.asset_id());
+      log_->info("-Balance- {}", acc_asset.balance());
+    });
   }
 
   void QueryResponseHandler::handleSignatoriesResponse(
@@ -104,6 +121,26 @@ namespace iroha_cli {
       log_->info("--[Creator Id] -- {}", tx.meta().creator_account_id());
       // TODO: add other fields
     });
+    auto next_tx_hash = response.transactions_response().next_tx_hash();
+    if (not next_tx_hash.empty()) {
+      log_->info("-Next page after- {}",
+                 iroha::bytestringToHexstring(next_tx_hash));
+    }
+  }
+
+  void QueryResponseHandler::handleAssetHoldersResponse(
+      const iroha::protocol::QueryResponse &response) {
+    auto holders = response.asset_holders_response().holders();
+    log_->info("[Asset Holders]");
+    std::for_each(holders.begin(), holders.end(), [this](auto holder) {
+      log_->info("-Account Id- {}", holder.account_id());
+      log_->info("-Balance- {}", holder.balance());
+    });
+    if (not response.asset_holders_response().next_account_id().empty()) {
+      log_->info("-Next page after- {} with balance {}",
+                 response.asset_holders_response().next_account_id(),
+                 response.asset_holders_response().next_balance());
+    }
   }
 
 }  // namespace iroha_cli
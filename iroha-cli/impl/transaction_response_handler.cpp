@@ -31,6 +31,9 @@ namespace iroha_cli {
       case iroha_cli::CliClient::NOT_VALID:
         log_->error("Transaction is not valid");
         break;
+      case iroha_cli::CliClient::OVERLOADED:
+        log_->error("Network is overloaded, retry transaction later");
+        break;
     }
   }
   TransactionResponseHandler::TransactionResponseHandler()
@@ -37,6 +37,10 @@ DEFINE_string(config, "", "Trusted peer's ip addresses");
 // DEFINE_validator(config, &iroha_cli::validate_config);
 
 DEFINE_string(genesis_block, "", "Genesis block for sending network");
+DEFINE_string(provisioning,
+              "",
+              "Domains, assets and accounts of genesis block for sending "
+              "network");
 // DEFINE_validator(genesis_block, &iroha_cli::validate_genesis_block);
 
 DEFINE_bool(new_account, false, "Choose if account does not exist");
@@ -49,6 +53,9 @@ DEFINE_string(address, "0.0.0.0", "Address of the Iroha node");
 DEFINE_int32(torii_port, 50051, "Port of iroha's Torii");
 DEFINE_validator(torii_port, &iroha_cli::validate_port);
 DEFINE_string(json_transaction, "", "Transaction in json format");
+DEFINE_string(json_transactions,
+              "",
+              "Json array of transactions to send in one batch");
 DEFINE_string(json_query, "", "Query in json format");
 
 using namespace iroha::protocol;
@@ -66,11 +73,15 @@ int main(int argc, char* argv[]) {
       logger->info(
           "Public and private key has been generated in current directory");
     };
-  } else if (not FLAGS_config.empty() && not FLAGS_genesis_block.empty()) {
+  } else if (not FLAGS_config.empty()
+             && (not FLAGS_genesis_block.empty()
+                 || not FLAGS_provisioning.empty())) {
     iroha_cli::GenesisBlockClientImpl genesis_block_client;
     auto bootstrap = iroha_cli::BootstrapNetwork(genesis_block_client);
     auto peers = bootstrap.parse_trusted_peers(FLAGS_config);
-    auto block = bootstrap.parse_genesis_block(FLAGS_genesis_block);
+    auto block = FLAGS_provisioning.empty()
+        ? bootstrap.parse_genesis_block(FLAGS_genesis_block)
+        : bootstrap.parse_provisioning_file(FLAGS_provisioning);
     block = bootstrap.merge_tx_add_trusted_peers(block, peers);
     bootstrap.run_network(peers, block);
   } else if (FLAGS_grpc) {
@@ -84,6 +95,14 @@ int main(int argc, char* argv[]) {
                       std::istreambuf_iterator<char>());
       response_handler.handle(client.sendTx(str));
     }
+    if (not FLAGS_json_transactions.empty()) {
+      logger->info("Send batch of transactions to {}:{} ", FLAGS_address,
+                   FLAGS_torii_port);
+      std::ifstream file(FLAGS_json_transactions);
+      std::string str((std::istreambuf_iterator<char>(file)),
+                      std::istreambuf_iterator<char>());
+      response_handler.handle(client.sendTxs(str));
+    }
     if (not FLAGS_json_query.empty()) {
       logger->info("Send query to {}:{}", FLAGS_address, FLAGS_torii_port);
       std::ifstream file(FLAGS_json_query);
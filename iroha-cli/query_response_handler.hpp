@@ -44,6 +44,8 @@ namespace iroha_cli {
         const iroha::protocol::QueryResponse& response);
     void handleSignatoriesResponse(
         const iroha::protocol::QueryResponse& response);
+    void handleAssetHoldersResponse(
+        const iroha::protocol::QueryResponse& response);
     // -- --
     using Handler =
         void (QueryResponseHandler::*)(const iroha::protocol::QueryResponse&);
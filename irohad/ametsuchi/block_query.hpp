@@ -20,11 +20,22 @@
 
 #include <model/block.hpp>
 #include <model/transaction.hpp>
+#include <nonstd/optional.hpp>
 #include <rxcpp/rx-observable.hpp>
 
 namespace iroha {
 
   namespace ametsuchi {
+    /**
+     * Page of transactions of an account
+     */
+    struct TransactionPage {
+      std::vector<model::Transaction> transactions;
+      // cursor to pass as after_hash for the next page, none if there are
+      // no more transactions
+      nonstd::optional<hash256_t> next_hash;
+    };
+
     /**
      * Public interface for queries on blocks and transactions
      */
@@ -39,6 +50,21 @@ namespace iroha {
       virtual rxcpp::observable<model::Transaction> getAccountTransactions(
           std::string account_id) = 0;
 
+      /**
+       * Get one page of transactions of an account in order of commit.
+       * Only blocks holding the page are read.
+       * @param account_id - creator of transactions
+       * @param after_hash - next_hash of the previous page, none for the
+       * first page
+       * @param limit - maximum number of transactions
+       * @return page of transactions, empty if after_hash is unknown,
+       * none if the page can not be read
+       */
+      virtual nonstd::optional<TransactionPage> getAccountTransactions(
+          const std::string &account_id,
+          const nonstd::optional<hash256_t> &after_hash,
+          uint32_t limit) = 0;
+
       /**
       * Get all blocks with having id in range [from, to].
       * @param from - starting id
@@ -47,6 +73,11 @@ namespace iroha {
       */
       virtual rxcpp::observable<model::Block> getBlocks(uint32_t from,
                                                         uint32_t to) = 0;
+
+      /**
+       * @return height of the top block in ledger, 0 if ledger is empty
+       */
+      virtual uint32_t getTopHeight() = 0;
     };
 
   }  // namespace ametsuchi
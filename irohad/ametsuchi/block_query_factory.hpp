@@ -0,0 +1,42 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_BLOCK_QUERY_FACTORY_HPP
+#define IROHA_BLOCK_QUERY_FACTORY_HPP
+
+#include <memory>
+#include "ametsuchi/block_query.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class BlockQueryFactory {
+     public:
+      /**
+       * Creates a block query with its own connection to the database,
+       * so it can be used in parallel with other queries and does not wait
+       * for commits of blocks.
+       * @return Created block query, nullptr if connection failed
+       */
+      virtual std::unique_ptr<BlockQuery> createBlockQuery() = 0;
+
+      virtual ~BlockQueryFactory() = default;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+#endif  // IROHA_BLOCK_QUERY_FACTORY_HPP
@@ -18,6 +18,7 @@
 #ifndef IROHA_FLAT_FILE_HPP
 #define IROHA_FLAT_FILE_HPP
 
+#include <atomic>
 #include <memory>
 #include <nonstd/optional.hpp>
 #include <string>
@@ -35,7 +36,8 @@ namespace iroha {
       std::string directory() const;
 
      private:
-      uint32_t current_id;
+      // read by block queries without the lock of storage
+      std::atomic<uint32_t> current_id;
       const std::string dump_dir;
 
       FlatFile(uint32_t current_id, const std::string &path);
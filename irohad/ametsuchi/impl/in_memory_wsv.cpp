@@ -0,0 +1,245 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/in_memory_wsv.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    namespace {
+      // balances are stored as bigint
+      const uint64_t MAX_BALANCE = std::numeric_limits<int64_t>::max();
+    }  // namespace
+
+    nonstd::optional<model::Account> InMemoryWsv::getAccount(
+        const std::string &account_id) {
+      auto it = accounts_.find(account_id);
+      if (it == accounts_.end()) {
+        return nonstd::nullopt;
+      }
+      return it->second;
+    }
+
+    nonstd::optional<std::vector<ed25519::pubkey_t>>
+    InMemoryWsv::getSignatories(const std::string &account_id) {
+      std::vector<ed25519::pubkey_t> signatories;
+      for (auto it = account_signatories_.lower_bound({account_id, {}});
+           it != account_signatories_.end() and it->first == account_id;
+           ++it) {
+        signatories.push_back(it->second);
+      }
+      return signatories;
+    }
+
+    nonstd::optional<model::Asset> InMemoryWsv::getAsset(
+        const std::string &asset_id) {
+      auto it = assets_.find(asset_id);
+      if (it == assets_.end()) {
+        return nonstd::nullopt;
+      }
+      return it->second;
+    }
+
+    nonstd::optional<model::AccountAsset> InMemoryWsv::getAccountAsset(
+        const std::string &account_id, const std::string &asset_id) {
+      auto it = account_assets_.find({account_id, asset_id});
+      if (it == account_assets_.end()) {
+        return nonstd::nullopt;
+      }
+      return it->second;
+    }
+
+    nonstd::optional<std::vector<model::AccountAsset>>
+    InMemoryWsv::getAccountAssets(const std::string &account_id) {
+      std::vector<model::AccountAsset> assets;
+      for (auto it = account_assets_.lower_bound({account_id, ""});
+           it != account_assets_.end() and it->first.first == account_id;
+           ++it) {
+        assets.push_back(it->second);
+      }
+      return assets;
+    }
+
+    nonstd::optional<std::vector<model::AccountAsset>>
+    InMemoryWsv::getAssetHolders(const std::string &asset_id,
+                                 const std::string &after_account_id,
+                                 uint64_t after_balance,
+                                 uint32_t limit,
+                                 bool order_by_balance) {
+      std::vector<model::AccountAsset> holders;
+      for (const auto &account_asset : account_assets_) {
+        if (account_asset.second.asset_id == asset_id) {
+          holders.push_back(account_asset.second);
+        }
+      }
+      // the same order as in PostgresWsvQuery
+      auto before = [order_by_balance](const model::AccountAsset &a,
+                                       const model::AccountAsset &b) {
+        if (not order_by_balance) {
+          return a.account_id < b.account_id;
+        }
+        return a.balance != b.balance ? a.balance > b.balance
+                                      : a.account_id > b.account_id;
+      };
+      std::sort(holders.begin(), holders.end(), before);
+      if (not after_account_id.empty()) {
+        model::AccountAsset after;
+        after.account_id = after_account_id;
+        after.balance = after_balance;
+        holders.erase(
+            holders.begin(),
+            std::upper_bound(holders.begin(), holders.end(), after, before));
+      }
+      if (holders.size() > limit) {
+        holders.resize(limit);
+      }
+      return holders;
+    }
+
+    nonstd::optional<std::vector<model::Peer>> InMemoryWsv::getPeers() {
+      return peers_;
+    }
+
+    bool InMemoryWsv::insertAccount(const model::Account &account) {
+      if (accounts_.count(account.account_id) != 0
+          or domains_.count(account.domain_name) == 0
+          or signatories_.count(account.master_key) == 0) {
+        return false;
+      }
+      accounts_.emplace(account.account_id, account);
+      return true;
+    }
+
+    bool InMemoryWsv::updateAccount(const model::Account &account) {
+      auto it = accounts_.find(account.account_id);
+      if (it == accounts_.end()) {
+        // update of absent row is not an error
+        return true;
+      }
+      if (domains_.count(account.domain_name) == 0
+          or signatories_.count(account.master_key) == 0) {
+        return false;
+      }
+      it->second = account;
+      return true;
+    }
+
+    bool InMemoryWsv::insertAsset(const model::Asset &asset) {
+      if (assets_.count(asset.asset_id) != 0
+          or domains_.count(asset.domain_id) == 0) {
+        return false;
+      }
+      assets_.emplace(asset.asset_id, asset);
+      return true;
+    }
+
+    bool InMemoryWsv::upsertAccountAsset(const model::AccountAsset &asset) {
+      if (accounts_.count(asset.account_id) == 0
+          or assets_.count(asset.asset_id) == 0
+          or asset.balance > MAX_BALANCE) {
+        return false;
+      }
+      account_assets_[{asset.account_id, asset.asset_id}] = asset;
+      return true;
+    }
+
+    bool InMemoryWsv::addAccountAssetBalance(const std::string &account_id,
+                                             const std::string &asset_id,
+                                             uint64_t amount) {
+      auto it = account_assets_.find({account_id, asset_id});
+      if (it == account_assets_.end()) {
+        model::AccountAsset asset;
+        asset.account_id = account_id;
+        asset.asset_id = asset_id;
+        asset.balance = amount;
+        return upsertAccountAsset(asset);
+      }
+      if (amount > MAX_BALANCE - it->second.balance) {
+        return false;
+      }
+      it->second.balance += amount;
+      return true;
+    }
+
+    bool InMemoryWsv::transferAccountAsset(const std::string &src_account_id,
+                                           const std::string &dest_account_id,
+                                           const std::string &asset_id,
+                                           uint64_t amount) {
+      auto src = account_assets_.find({src_account_id, asset_id});
+      if (src == account_assets_.end() or src->second.balance < amount) {
+        return false;
+      }
+      if (src_account_id == dest_account_id) {
+        return true;
+      }
+      auto dest = account_assets_.find({dest_account_id, asset_id});
+      if (dest == account_assets_.end()) {
+        if (accounts_.count(dest_account_id) == 0) {
+          return false;
+        }
+      } else if (amount > MAX_BALANCE - dest->second.balance) {
+        return false;
+      }
+      src->second.balance -= amount;
+      return addAccountAssetBalance(dest_account_id, asset_id, amount);
+    }
+
+    bool InMemoryWsv::insertSignatory(const ed25519::pubkey_t &signatory) {
+      return signatories_.insert(signatory).second;
+    }
+
+    bool InMemoryWsv::insertAccountSignatory(
+        const std::string &account_id, const ed25519::pubkey_t &signatory) {
+      if (accounts_.count(account_id) == 0
+          or signatories_.count(signatory) == 0) {
+        return false;
+      }
+      return account_signatories_.emplace(account_id, signatory).second;
+    }
+
+    bool InMemoryWsv::deleteAccountSignatory(
+        const std::string &account_id, const ed25519::pubkey_t &signatory) {
+      account_signatories_.erase({account_id, signatory});
+      return true;
+    }
+
+    bool InMemoryWsv::insertPeer(const model::Peer &peer) {
+      auto duplicate =
+          std::find_if(peers_.begin(), peers_.end(), [&peer](auto &p) {
+            return p.pubkey == peer.pubkey or p.address == peer.address;
+          });
+      if (duplicate != peers_.end()) {
+        return false;
+      }
+      peers_.push_back(peer);
+      return true;
+    }
+
+    bool InMemoryWsv::deletePeer(const model::Peer &peer) {
+      peers_.erase(std::remove(peers_.begin(), peers_.end(), peer),
+                   peers_.end());
+      return true;
+    }
+
+    bool InMemoryWsv::insertDomain(const model::Domain &domain) {
+      return domains_.emplace(domain.domain_id, domain).second;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_IN_MEMORY_WSV_HPP
+#define IROHA_IN_MEMORY_WSV_HPP
+
+#include <map>
+#include <set>
+#include <utility>
+#include "ametsuchi/wsv_command.hpp"
+#include "ametsuchi/wsv_query.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * World state view kept in memory.
+     * Enforces the same key constraints as the postgres schema,
+     * so commands can be checked against it before anything is written.
+     */
+    class InMemoryWsv : public WsvQuery, public WsvCommand {
+      friend class PostgresWsvBulkLoader;
+
+     public:
+      nonstd::optional<model::Account> getAccount(
+          const std::string &account_id) override;
+      nonstd::optional<std::vector<ed25519::pubkey_t>> getSignatories(
+          const std::string &account_id) override;
+      nonstd::optional<model::Asset> getAsset(
+          const std::string &asset_id) override;
+      nonstd::optional<model::AccountAsset> getAccountAsset(
+          const std::string &account_id, const std::string &asset_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAccountAssets(
+          const std::string &account_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAssetHolders(
+          const std::string &asset_id,
+          const std::string &after_account_id,
+          uint64_t after_balance,
+          uint32_t limit,
+          bool order_by_balance) override;
+      nonstd::optional<std::vector<model::Peer>> getPeers() override;
+
+      bool insertAccount(const model::Account &account) override;
+      bool updateAccount(const model::Account &account) override;
+      bool insertAsset(const model::Asset &asset) override;
+      bool upsertAccountAsset(const model::AccountAsset &asset) override;
+      bool addAccountAssetBalance(const std::string &account_id,
+                                  const std::string &asset_id,
+                                  uint64_t amount) override;
+      bool transferAccountAsset(const std::string &src_account_id,
+                                const std::string &dest_account_id,
+                                const std::string &asset_id,
+                                uint64_t amount) override;
+      bool insertSignatory(const ed25519::pubkey_t &signatory) override;
+      bool insertAccountSignatory(const std::string &account_id,
+                                  const ed25519::pubkey_t &signatory) override;
+      bool deleteAccountSignatory(const std::string &account_id,
+                                  const ed25519::pubkey_t &signatory) override;
+      bool insertPeer(const model::Peer &peer) override;
+      bool deletePeer(const model::Peer &peer) override;
+      bool insertDomain(const model::Domain &domain) override;
+
+     private:
+      std::map<std::string, model::Domain> domains_;
+      std::set<ed25519::pubkey_t> signatories_;
+      std::map<std::string, model::Account> accounts_;
+      std::set<std::pair<std::string, ed25519::pubkey_t>>
+          account_signatories_;
+      std::vector<model::Peer> peers_;
+      std::map<std::string, model::Asset> assets_;
+      std::map<std::pair<std::string, std::string>, model::AccountAsset>
+          account_assets_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_IN_MEMORY_WSV_HPP
@@ -16,6 +16,8 @@
  */
 
 #include <ametsuchi/impl/mutable_storage_impl.hpp>
+#include "ametsuchi/impl/in_memory_wsv.hpp"
+#include "ametsuchi/impl/postgres_wsv_bulk_loader.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -37,6 +39,30 @@ namespace iroha {
       return result;
     }
 
+    bool MutableStorageImpl::applyBulk(
+        const std::vector<model::Block> &blocks,
+        std::function<bool(const model::Block &, WsvCommand &, WsvQuery &)>
+            function) {
+      // whole batch is checked before anything is written
+      InMemoryWsv state;
+      for (const auto &block : blocks) {
+        if (not function(block, state, state)) {
+          return false;
+        }
+      }
+      transaction_->exec("SAVEPOINT savepoint_;");
+      if (not PostgresWsvBulkLoader(*transaction_).load(state)) {
+        transaction_->exec("ROLLBACK TO SAVEPOINT savepoint_;");
+        return false;
+      }
+      transaction_->exec("RELEASE SAVEPOINT savepoint_;");
+      for (const auto &block : blocks) {
+        block_store_.insert(std::make_pair(block.height, block));
+        top_hash_ = block.hash;
+      }
+      return true;
+    }
+
     MutableStorageImpl::MutableStorageImpl(
         hash256_t top_hash, std::unique_ptr<cpp_redis::redis_client> index,
         std::unique_ptr<pqxx::lazyconnection> connection,
@@ -80,6 +106,21 @@ namespace iroha {
       return wsv_->getAccountAsset(account_id, asset_id);
     }
 
+    nonstd::optional<std::vector<model::AccountAsset>>
+    MutableStorageImpl::getAccountAssets(const std::string &account_id) {
+      return wsv_->getAccountAssets(account_id);
+    }
+
+    nonstd::optional<std::vector<model::AccountAsset>>
+    MutableStorageImpl::getAssetHolders(const std::string &asset_id,
+                                        const std::string &after_account_id,
+                                        uint64_t after_balance,
+                                        uint32_t limit,
+                                        bool order_by_balance) {
+      return wsv_->getAssetHolders(
+          asset_id, after_account_id, after_balance, limit, order_by_balance);
+    }
+
     nonstd::optional<std::vector<model::Peer>> MutableStorageImpl::getPeers() {
       return wsv_->getPeers();
     }
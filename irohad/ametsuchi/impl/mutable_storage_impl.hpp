@@ -40,6 +40,10 @@ namespace iroha {
                  std::function<bool(const model::Block &, WsvCommand &,
                                     WsvQuery &, const hash256_t &)>
                      function) override;
+      bool applyBulk(const std::vector<model::Block> &blocks,
+                     std::function<bool(const model::Block &, WsvCommand &,
+                                        WsvQuery &)>
+                         function) override;
       ~MutableStorageImpl() override;
       nonstd::optional<model::Account> getAccount(
           const std::string &account_id) override;
@@ -49,6 +53,14 @@ namespace iroha {
           const std::string &asset_id) override;
       nonstd::optional<model::AccountAsset> getAccountAsset(
           const std::string &account_id, const std::string &asset_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAccountAssets(
+          const std::string &account_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAssetHolders(
+          const std::string &asset_id,
+          const std::string &after_account_id,
+          uint64_t after_balance,
+          uint32_t limit,
+          bool order_by_balance) override;
       nonstd::optional<std::vector<model::Peer>> getPeers() override;
 
      private:
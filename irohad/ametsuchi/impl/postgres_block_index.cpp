@@ -0,0 +1,144 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "crypto/hash.hpp"
+#include "model/converters/json_common.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    const std::string PostgresBlockIndex::init_ =
+        "CREATE TABLE IF NOT EXISTS account_has_tx (\n"
+        "    account_id character varying(197) NOT NULL,\n"
+        "    height bigint NOT NULL,\n"
+        "    tx_index int NOT NULL,\n"
+        "    hash bytea NOT NULL,\n"
+        "    PRIMARY KEY (account_id, height, tx_index)\n"
+        ");\n"
+        "CREATE INDEX IF NOT EXISTS account_has_tx_hash_index\n"
+        "    ON account_has_tx (account_id, hash);\n";
+
+    PostgresBlockIndex::PostgresBlockIndex(pqxx::nontransaction &transaction)
+        : transaction_(transaction),
+          log_(logger::log("PostgresBlockIndex")) {}
+
+    bool PostgresBlockIndex::index(const model::Block &block) {
+      if (block.transactions.empty()) {
+        return true;
+      }
+      std::string values;
+      for (size_t i = 0; i < block.transactions.size(); ++i) {
+        const auto &tx = block.transactions.at(i);
+        auto hash = indexHash(tx);
+        pqxx::binarystring hash_str(hash.data(), hash.size());
+        if (not values.empty()) {
+          values += ",\n";
+        }
+        values += "(" + transaction_.quote(tx.creator_account_id) + ", " +
+            transaction_.quote(block.height) + ", " + transaction_.quote(i) +
+            ", " + transaction_.quote(hash_str) + ")";
+      }
+      try {
+        transaction_.exec(
+            "INSERT INTO account_has_tx(account_id, height, tx_index, hash)\n"
+            "VALUES " +
+            values + ";");
+      } catch (const std::exception &e) {
+        log_->error("Indexing of block {} failed: {}", block.height, e.what());
+        return false;
+      }
+      return true;
+    }
+
+    nonstd::optional<uint32_t> PostgresBlockIndex::lastIndexedHeight() {
+      pqxx::result result;
+      try {
+        result = transaction_.exec(
+            "SELECT COALESCE(MAX(height), 0) AS height FROM account_has_tx;");
+      } catch (const std::exception &e) {
+        log_->error("Reading of indexed height failed: {}", e.what());
+        return nonstd::nullopt;
+      }
+      uint32_t height;
+      result.at(0).at("height") >> height;
+      return height;
+    }
+
+    nonstd::optional<std::vector<PostgresBlockIndex::TxPosition>>
+    PostgresBlockIndex::getAccountTransactions(
+        const std::string &account_id,
+        const nonstd::optional<hash256_t> &after_hash,
+        uint32_t limit) {
+      std::string page_filter;
+      if (after_hash.has_value()) {
+        pqxx::binarystring hash_str(after_hash->data(), after_hash->size());
+        // the same transaction may be committed twice, the cursor points to
+        // its last copy so paging never goes back
+        page_filter =
+            " AND \n"
+            "  (height, tx_index) > (\n"
+            "    SELECT height, tx_index FROM account_has_tx\n"
+            "    WHERE account_id = " +
+            transaction_.quote(account_id) +
+            " AND hash = " + transaction_.quote(hash_str) +
+            "\n"
+            "    ORDER BY height DESC, tx_index DESC LIMIT 1)";
+      }
+      pqxx::result result;
+      try {
+        // unknown cursor makes the row comparison null, so the page is empty
+        result = transaction_.exec(
+            "SELECT \n"
+            "  height, tx_index, hash\n"
+            "FROM \n"
+            "  account_has_tx\n"
+            "WHERE \n"
+            "  account_id = " +
+            transaction_.quote(account_id) + page_filter +
+            "\n"
+            "ORDER BY \n"
+            "  height, tx_index\n"
+            "LIMIT " +
+            transaction_.quote(limit) + ";");
+      } catch (const std::exception &e) {
+        log_->error("Reading of transactions of {} failed: {}",
+                    account_id,
+                    e.what());
+        return nonstd::nullopt;
+      }
+      std::vector<TxPosition> positions;
+      for (const auto &row : result) {
+        TxPosition position;
+        row.at("height") >> position.height;
+        row.at("tx_index") >> position.index;
+        pqxx::binarystring hash_str(row.at("hash"));
+        std::copy(hash_str.begin(), hash_str.end(), position.hash.begin());
+        positions.push_back(position);
+      }
+      return positions;
+    }
+
+    hash256_t PostgresBlockIndex::indexHash(const model::Transaction &tx) {
+      auto json =
+          model::converters::jsonToString(tx_serializer_.serialize(tx));
+      return sha3_256(reinterpret_cast<const uint8_t *>(json.data()),
+                      json.size());
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
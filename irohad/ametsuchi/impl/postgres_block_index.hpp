@@ -0,0 +1,92 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_POSTGRES_BLOCK_INDEX_HPP
+#define IROHA_POSTGRES_BLOCK_INDEX_HPP
+
+#include <nonstd/optional.hpp>
+#include <pqxx/nontransaction>
+#include "common/types.hpp"
+#include "logger/logger.hpp"
+#include "model/block.hpp"
+#include "model/converters/json_transaction_factory.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Index from account to its transactions in the block store, kept in
+     * postgres so it is written in the same transaction as world state view
+     */
+    class PostgresBlockIndex {
+     public:
+      /**
+       * Position of transaction in the block store
+       */
+      struct TxPosition {
+        uint32_t height;
+        size_t index;
+        // hash which stays the same after the transaction is loaded from
+        // the block store, used as the page cursor
+        hash256_t hash;
+      };
+
+      explicit PostgresBlockIndex(pqxx::nontransaction &transaction);
+
+      /**
+       * Add transactions of the block to the index
+       * @param block - block being committed
+       * @return true if the block is indexed, false otherwise
+       */
+      bool index(const model::Block &block);
+
+      /**
+       * @return height of the last block with indexed transactions,
+       * 0 if the index is empty, none on error
+       */
+      nonstd::optional<uint32_t> lastIndexedHeight();
+
+      /**
+       * Get positions of account transactions in order of commit
+       * @param account_id - creator of transactions
+       * @param after_hash - cursor of the last transaction of the previous
+       * page, none for the first page
+       * @param limit - maximum number of positions
+       * @return positions, empty if after_hash is unknown, none on error
+       */
+      nonstd::optional<std::vector<TxPosition>> getAccountTransactions(
+          const std::string &account_id,
+          const nonstd::optional<hash256_t> &after_hash,
+          uint32_t limit);
+
+      /**
+       * Table and indices of the account transactions index
+       */
+      static const std::string init_;
+
+     private:
+      hash256_t indexHash(const model::Transaction &tx);
+
+      pqxx::nontransaction &transaction_;
+      model::converters::JsonTransactionFactory tx_serializer_;
+
+      logger::Logger log_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_BLOCK_INDEX_HPP
@@ -0,0 +1,118 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/postgres_block_query.hpp"
+#include "model/converters/json_common.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    PostgresBlockQuery::PostgresBlockQuery(pqxx::nontransaction &transaction,
+                                           const FlatFile &block_store)
+        : block_index_(transaction),
+          block_store_(block_store),
+          log_(logger::log("PostgresBlockQuery")) {}
+
+    rxcpp::observable<model::Transaction>
+    PostgresBlockQuery::getAccountTransactions(std::string account_id) {
+      return getBlocks(1, getTopHeight())
+          .flat_map([](auto block) {
+            return rxcpp::observable<>::iterate(block.transactions);
+          })
+          .filter([account_id](auto tx) {
+            return tx.creator_account_id == account_id;
+          });
+    }
+
+    nonstd::optional<TransactionPage>
+    PostgresBlockQuery::getAccountTransactions(
+        const std::string &account_id,
+        const nonstd::optional<hash256_t> &after_hash,
+        uint32_t limit) {
+      // one extra position is read to find out if there is a next page
+      auto positions = block_index_.getAccountTransactions(
+          account_id, after_hash, limit + 1);
+      if (not positions.has_value()) {
+        return nonstd::nullopt;
+      }
+      TransactionPage page;
+      if (positions->size() > limit) {
+        positions->resize(limit);
+        if (positions->empty()) {
+          page.next_hash = after_hash;
+        } else {
+          page.next_hash = positions->back().hash;
+        }
+      }
+
+      // each block holding the page is read once
+      auto position = positions->begin();
+      while (position != positions->end()) {
+        auto height = position->height;
+        auto block = loadBlock(height);
+        if (not block.has_value()) {
+          log_->error("Block {} can not be loaded", height);
+          return nonstd::nullopt;
+        }
+        for (; position != positions->end() and position->height == height;
+             ++position) {
+          page.transactions.push_back(block->transactions.at(position->index));
+        }
+      }
+      return page;
+    }
+
+    rxcpp::observable<model::Block> PostgresBlockQuery::getBlocks(
+        uint32_t from, uint32_t to) {
+      auto last_id = block_store_.last_id();
+      if (to > last_id) {
+        to = last_id;
+      }
+      if (from > to) {
+        return rxcpp::observable<>::empty<model::Block>();
+      }
+      return rxcpp::observable<>::range(from, to).flat_map([this](auto i) {
+        auto block = this->loadBlock(i);
+        return rxcpp::observable<>::create<model::Block>(
+            [block](auto s) {
+              if (block.has_value()) {
+                s.on_next(block.value());
+              }
+              s.on_completed();
+            });
+      });
+    }
+
+    uint32_t PostgresBlockQuery::getTopHeight() {
+      return block_store_.last_id();
+    }
+
+    nonstd::optional<model::Block> PostgresBlockQuery::loadBlock(
+        uint32_t height) {
+      auto bytes = block_store_.get(height);
+      if (not bytes.has_value()) {
+        return nonstd::nullopt;
+      }
+      auto document = model::converters::vectorToJson(bytes.value());
+      if (not document.has_value()) {
+        return nonstd::nullopt;
+      }
+      return serializer_.deserialize(document.value());
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,66 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_POSTGRES_BLOCK_QUERY_HPP
+#define IROHA_POSTGRES_BLOCK_QUERY_HPP
+
+#include <pqxx/nontransaction>
+#include "ametsuchi/block_query.hpp"
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "logger/logger.hpp"
+#include "model/converters/json_block_factory.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Reads blocks from the block store and finds them with the account
+     * transactions index in postgres
+     */
+    class PostgresBlockQuery : public BlockQuery {
+     public:
+      PostgresBlockQuery(pqxx::nontransaction &transaction,
+                         const FlatFile &block_store);
+
+      rxcpp::observable<model::Transaction> getAccountTransactions(
+          std::string account_id) override;
+      nonstd::optional<TransactionPage> getAccountTransactions(
+          const std::string &account_id,
+          const nonstd::optional<hash256_t> &after_hash,
+          uint32_t limit) override;
+      rxcpp::observable<model::Block> getBlocks(uint32_t from,
+                                                uint32_t to) override;
+      uint32_t getTopHeight() override;
+
+     private:
+      /**
+       * Read block from the block store
+       * @return block, none if it is missing or malformed
+       */
+      nonstd::optional<model::Block> loadBlock(uint32_t height);
+
+      PostgresBlockIndex block_index_;
+      const FlatFile &block_store_;
+      model::converters::JsonBlockFactory serializer_;
+
+      logger::Logger log_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_BLOCK_QUERY_HPP
@@ -0,0 +1,144 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/postgres_wsv_bulk_loader.hpp"
+#include <pqxx/tablewriter>
+#include <sstream>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    namespace {
+      /**
+       * Text presentation of bytea value for COPY
+       */
+      std::string toBytea(const ed25519::pubkey_t &key) {
+        return "\\x" + key.to_hexstring();
+      }
+
+      std::string toBits(const model::Account::Permissions &permissions) {
+        std::stringstream bits;
+        bits << permissions.add_signatory << permissions.can_transfer
+             << permissions.create_accounts << permissions.create_assets
+             << permissions.create_domains << permissions.issue_assets
+             << permissions.read_all_accounts << permissions.remove_signatory
+             << permissions.set_permissions << permissions.set_quorum;
+        return bits.str();
+      }
+
+      /**
+       * Copy rows into table
+       * @param transaction - transaction to copy in
+       * @param table - name of table
+       * @param columns - names of columns
+       * @param rows - container of elements
+       * @param row - function making row of column values from element
+       */
+      template <typename Rows, typename Row>
+      void copyRows(pqxx::nontransaction &transaction,
+                const std::string &table,
+                const std::vector<std::string> &columns,
+                const Rows &rows,
+                Row row) {
+        pqxx::tablewriter writer(
+            transaction, table, columns.begin(), columns.end());
+        for (const auto &element : rows) {
+          writer << row(element);
+        }
+        writer.complete();
+      }
+    }  // namespace
+
+    const std::string PostgresWsvBulkLoader::create_indices_ =
+        "CREATE INDEX IF NOT EXISTS account_has_asset_holder_idx\n"
+        "    ON account_has_asset (asset_id, account_id);\n"
+        "CREATE INDEX IF NOT EXISTS account_has_asset_top_holder_idx\n"
+        "    ON account_has_asset (asset_id, amount, account_id);\n";
+
+    const std::string PostgresWsvBulkLoader::drop_indices_ =
+        "DROP INDEX IF EXISTS account_has_asset_holder_idx;\n"
+        "DROP INDEX IF EXISTS account_has_asset_top_holder_idx;\n";
+
+    PostgresWsvBulkLoader::PostgresWsvBulkLoader(
+        pqxx::nontransaction &transaction)
+        : transaction_(transaction),
+          log_(logger::log("PostgresWsvBulkLoader")) {}
+
+    bool PostgresWsvBulkLoader::load(const InMemoryWsv &state) {
+      using Strings = std::vector<std::string>;
+      try {
+        transaction_.exec(drop_indices_);
+        // tables are filled in order of their foreign keys
+        copyRows(transaction_, "domain", {"domain_id"}, state.domains_,
+             [](const auto &domain) { return Strings{domain.first}; });
+        copyRows(transaction_, "signatory", {"public_key"}, state.signatories_,
+             [](const auto &key) { return Strings{toBytea(key)}; });
+        copyRows(transaction_,
+             "account",
+             {"account_id", "domain_id", "master_key", "quorum",
+              "permissions"},
+             state.accounts_,
+             [](const auto &account) {
+               return Strings{account.second.account_id,
+                              account.second.domain_name,
+                              toBytea(account.second.master_key),
+                              std::to_string(account.second.quorum),
+                              toBits(account.second.permissions)};
+             });
+        copyRows(transaction_,
+             "account_has_signatory",
+             {"account_id", "public_key"},
+             state.account_signatories_,
+             [](const auto &signatory) {
+               return Strings{signatory.first, toBytea(signatory.second)};
+             });
+        copyRows(transaction_, "peer", {"public_key", "address"}, state.peers_,
+             [](const auto &peer) {
+               return Strings{toBytea(peer.pubkey), peer.address};
+             });
+        copyRows(transaction_,
+             "asset",
+             {"asset_id", "domain_id", "precision"},
+             state.assets_,
+             [](const auto &asset) {
+               return Strings{asset.second.asset_id,
+                              asset.second.domain_id,
+                              std::to_string(asset.second.precision)};
+             });
+        copyRows(transaction_,
+             "account_has_asset",
+             {"account_id", "asset_id", "amount", "permissions"},
+             state.account_assets_,
+             [](const auto &asset) {
+               return Strings{asset.second.account_id,
+                              asset.second.asset_id,
+                              std::to_string(asset.second.balance),
+                              "0"};
+             });
+        transaction_.exec(create_indices_);
+      } catch (const std::exception &e) {
+        log_->error("Bulk load failed: {}", e.what());
+        return false;
+      }
+      log_->info("Loaded {} accounts, {} assets, {} balances",
+                 state.accounts_.size(), state.assets_.size(),
+                 state.account_assets_.size());
+      return true;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_POSTGRES_WSV_BULK_LOADER_HPP
+#define IROHA_POSTGRES_WSV_BULK_LOADER_HPP
+
+#include <pqxx/nontransaction>
+#include "ametsuchi/impl/in_memory_wsv.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Writes world state view to postgres with COPY instead of
+     * per row inserts. Intended for loading empty ledger.
+     */
+    class PostgresWsvBulkLoader {
+     public:
+      explicit PostgresWsvBulkLoader(pqxx::nontransaction &transaction);
+
+      /**
+       * Write given state. Secondary indices are dropped before the load
+       * and built once after it.
+       * @param state - state to write
+       * @return true if state is written, false otherwise
+       */
+      bool load(const InMemoryWsv &state);
+
+      /**
+       * Secondary indices of world state view tables
+       */
+      static const std::string create_indices_;
+
+     private:
+      pqxx::nontransaction &transaction_;
+
+      logger::Logger log_;
+
+      static const std::string drop_indices_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_WSV_BULK_LOADER_HPP
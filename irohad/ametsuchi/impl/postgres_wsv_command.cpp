@@ -22,7 +22,8 @@ namespace iroha {
   namespace ametsuchi {
 
     PostgresWsvCommand::PostgresWsvCommand(pqxx::nontransaction &transaction)
-        : transaction_(transaction) {}
+        : transaction_(transaction),
+          log_(logger::log("PostgresWsvCommand")) {}
 
     bool PostgresWsvCommand::insertAccount(const model::Account &account) {
       pqxx::binarystring master_key(account.master_key.data(),
@@ -100,6 +101,82 @@ namespace iroha {
       return true;
     }
 
+    bool PostgresWsvCommand::addAccountAssetBalance(
+        const std::string &account_id,
+        const std::string &asset_id,
+        uint64_t amount) {
+      pqxx::result result;
+      try {
+        // overflowing update matches no rows instead of failing
+        result = transaction_.exec(
+            "INSERT INTO account_has_asset(\n"
+            "            account_id, asset_id, amount, permissions)\n"
+            "    VALUES (" +
+            transaction_.quote(account_id) + ", " +
+            transaction_.quote(asset_id) + ", " + transaction_.quote(amount) +
+            ", " +
+            /*asset.permissions*/ transaction_.quote(0) +
+            ")\n"
+            "    ON CONFLICT (account_id, asset_id)\n"
+            "    DO UPDATE SET \n"
+            "        amount=account_has_asset.amount + EXCLUDED.amount\n"
+            "    WHERE account_has_asset.amount <= "
+            "9223372036854775807 - EXCLUDED.amount;");
+      } catch (const std::exception &e) {
+        log_->error("Add to {} of {} failed: {}", asset_id, account_id,
+                    e.what());
+        return false;
+      }
+      if (result.affected_rows() != 1) {
+        log_->error("Add to {} of {} failed: balance overflow", asset_id,
+                    account_id);
+        return false;
+      }
+      return true;
+    }
+
+    bool PostgresWsvCommand::transferAccountAsset(
+        const std::string &src_account_id,
+        const std::string &dest_account_id,
+        const std::string &asset_id,
+        uint64_t amount) {
+      pqxx::result result;
+      try {
+        result = transaction_.exec(
+            "SELECT transfer_account_asset(" +
+            transaction_.quote(src_account_id) + ", " +
+            transaction_.quote(dest_account_id) + ", " +
+            transaction_.quote(asset_id) + ", " + transaction_.quote(amount) +
+            ") AS status;");
+      } catch (const std::exception &e) {
+        log_->error("Transfer of {} from {} to {} failed: {}", asset_id,
+                    src_account_id, dest_account_id, e.what());
+        return false;
+      }
+      int status;
+      result.at(0).at("status") >> status;
+      switch (status) {
+        case 0:
+          return true;
+        case 1:
+          log_->error("Transfer of {} from {} failed: no source balance",
+                      asset_id, src_account_id);
+          break;
+        case 2:
+          log_->error("Transfer of {} from {} failed: insufficient balance",
+                      asset_id, src_account_id);
+          break;
+        case 3:
+          log_->error("Transfer of {} to {} failed: balance overflow",
+                      asset_id, dest_account_id);
+          break;
+        default:
+          log_->error("Transfer of {} failed: unknown status {}", asset_id,
+                      status);
+      }
+      return false;
+    }
+
     bool PostgresWsvCommand::insertSignatory(
         const ed25519::pubkey_t &signatory) {
       try {
@@ -20,6 +20,7 @@
 
 #include <pqxx/nontransaction>
 #include "ametsuchi/wsv_command.hpp"
+#include "logger/logger.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -30,6 +31,13 @@ namespace iroha {
       bool updateAccount(const model::Account &account) override;
       bool insertAsset(const model::Asset &asset) override;
       bool upsertAccountAsset(const model::AccountAsset &asset) override;
+      bool addAccountAssetBalance(const std::string &account_id,
+                                  const std::string &asset_id,
+                                  uint64_t amount) override;
+      bool transferAccountAsset(const std::string &src_account_id,
+                                const std::string &dest_account_id,
+                                const std::string &asset_id,
+                                uint64_t amount) override;
       bool insertSignatory(const ed25519::pubkey_t &signatory) override;
       bool insertAccountSignatory(const std::string &account_id,
                                   const ed25519::pubkey_t &signatory) override;
@@ -41,6 +49,8 @@ namespace iroha {
 
      private:
       pqxx::nontransaction &transaction_;
+
+      logger::Logger log_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -29,6 +29,79 @@ namespace iroha {
     using model::AccountAsset;
     using model::Peer;
 
+    namespace {
+      template <typename Row>
+      Account makeAccount(const Row &row) {
+        Account account;
+        row.at("account_id") >> account.account_id;
+        row.at("domain_id") >> account.domain_name;
+        pqxx::binarystring master_key(row.at("master_key"));
+        std::copy(master_key.begin(), master_key.end(),
+                  account.master_key.begin());
+        row.at("quorum") >> account.quorum;
+        //      row.at("status") >> ?
+        //      row.at("transaction_count") >> ?
+        std::string permissions;
+        row.at("permissions") >> permissions;
+        account.permissions.add_signatory = permissions.at(0) - '0';
+        account.permissions.can_transfer = permissions.at(1) - '0';
+        account.permissions.create_accounts = permissions.at(2) - '0';
+        account.permissions.create_assets = permissions.at(3) - '0';
+        account.permissions.create_domains = permissions.at(4) - '0';
+        account.permissions.issue_assets = permissions.at(5) - '0';
+        account.permissions.read_all_accounts = permissions.at(6) - '0';
+        account.permissions.remove_signatory = permissions.at(7) - '0';
+        account.permissions.set_permissions = permissions.at(8) - '0';
+        account.permissions.set_quorum = permissions.at(9) - '0';
+        return account;
+      }
+
+      template <typename Row>
+      Asset makeAsset(const Row &row) {
+        Asset asset;
+        row.at("asset_id") >> asset.asset_id;
+        row.at("domain_id") >> asset.domain_id;
+        int32_t precision;
+        row.at("precision") >> precision;
+        asset.precision = precision;
+        //      row.at("data") >> ?
+        return asset;
+      }
+
+      template <typename Row>
+      AccountAsset makeAccountAsset(const Row &row) {
+        AccountAsset asset;
+        row.at("account_id") >> asset.account_id;
+        row.at("asset_id") >> asset.asset_id;
+        row.at("amount") >> asset.balance;
+        //      row.at("permissions") >> ?
+        return asset;
+      }
+
+      template <typename Row>
+      ed25519::pubkey_t makePubkey(const Row &row) {
+        pqxx::binarystring public_key_str(row.at("public_key"));
+        ed25519::pubkey_t pubkey;
+        std::copy(public_key_str.begin(), public_key_str.end(), pubkey.begin());
+        return pubkey;
+      }
+
+      /**
+       * Make SQL list of quoted values, e.g. ('a', 'b')
+       */
+      string makeList(pqxx::nontransaction &transaction,
+                      const std::set<string> &values) {
+        string list = "(";
+        for (const auto &value : values) {
+          if (list.size() > 1) {
+            list += ", ";
+          }
+          list += transaction.quote(value);
+        }
+        return list + ")";
+      }
+    }  // namespace
+
     PostgresWsvQuery::PostgresWsvQuery(pqxx::nontransaction &transaction)
         : transaction_(transaction) {}
 
@@ -50,29 +123,7 @@ namespace iroha {
       if (result.size() != 1) {
         return nullopt;
       }
-      Account account;
-      auto row = result.at(0);
-      row.at("account_id") >> account.account_id;
-      row.at("domain_id") >> account.domain_name;
-      pqxx::binarystring master_key(row.at("master_key"));
-      std::copy(master_key.begin(), master_key.end(),
-                account.master_key.begin());
-      row.at("quorum") >> account.quorum;
-      //      row.at("status") >> ?
-      //      row.at("transaction_count") >> ?
-      std::string permissions;
-      row.at("permissions") >> permissions;
-      account.permissions.add_signatory = permissions.at(0) - '0';
-      account.permissions.can_transfer = permissions.at(1) - '0';
-      account.permissions.create_accounts = permissions.at(2) - '0';
-      account.permissions.create_assets = permissions.at(3) - '0';
-      account.permissions.create_domains = permissions.at(4) - '0';
-      account.permissions.issue_assets = permissions.at(5) - '0';
-      account.permissions.read_all_accounts = permissions.at(6) - '0';
-      account.permissions.remove_signatory = permissions.at(7) - '0';
-      account.permissions.set_permissions = permissions.at(8) - '0';
-      account.permissions.set_quorum = permissions.at(9) - '0';
-      return account;
+      return makeAccount(result.at(0));
     }
 
     nonstd::optional<std::vector<ed25519::pubkey_t>>
@@ -93,10 +144,7 @@ namespace iroha {
       }
       std::vector<ed25519::pubkey_t> signatories;
       for (const auto &row : result) {
-        pqxx::binarystring public_key_str(row.at("public_key"));
-        ed25519::pubkey_t pubkey;
-        std::copy(public_key_str.begin(), public_key_str.end(), pubkey.begin());
-        signatories.push_back(pubkey);
+        signatories.push_back(makePubkey(row));
       }
       return signatories;
     }
@@ -119,15 +167,7 @@ namespace iroha {
       if (result.size() != 1) {
         return nullopt;
       }
-      Asset asset;
-      auto row = result.at(0);
-      row.at("asset_id") >> asset.asset_id;
-      row.at("domain_id") >> asset.domain_id;
-      int32_t precision;
-      row.at("precision") >> precision;
-      asset.precision = precision;
-      //      row.at("data") >> ?
-      return asset;
+      return makeAsset(result.at(0));
     }
 
     optional<AccountAsset> PostgresWsvQuery::getAccountAsset(
@@ -151,13 +191,92 @@ namespace iroha {
       if (result.size() != 1) {
         return nullopt;
       }
-      model::AccountAsset asset;
-      auto row = result.at(0);
-      row.at("account_id") >> asset.account_id;
-      row.at("asset_id") >> asset.asset_id;
-      row.at("amount") >> asset.balance;
-      //      row.at("permissions") >> ?
-      return asset;
+      return makeAccountAsset(result.at(0));
+    }
+
+    nonstd::optional<std::vector<model::AccountAsset>>
+    PostgresWsvQuery::getAccountAssets(const std::string &account_id) {
+      pqxx::result result;
+      try {
+        // served by primary key (account_id, asset_id) index
+        result = transaction_.exec(
+            "SELECT \n"
+            "  account_has_asset.account_id,\n"
+            "  account_has_asset.asset_id,\n"
+            "  account_has_asset.amount\n"
+            "FROM \n"
+            "  account_has_asset\n"
+            "WHERE \n"
+            "  account_has_asset.account_id = " +
+            transaction_.quote(account_id) +
+            "\n"
+            "ORDER BY \n"
+            "  account_has_asset.asset_id;");
+      } catch (const std::exception &e) {
+        return nullopt;
+      }
+      std::vector<AccountAsset> assets;
+      for (const auto &row : result) {
+        assets.push_back(makeAccountAsset(row));
+      }
+      return assets;
+    }
+
+    nonstd::optional<std::vector<model::AccountAsset>>
+    PostgresWsvQuery::getAssetHolders(const std::string &asset_id,
+                                      const std::string &after_account_id,
+                                      uint64_t after_balance,
+                                      uint32_t limit,
+                                      bool order_by_balance) {
+      // keyset pagination over the asset side indices of account_has_asset
+      std::string page_filter, page_order;
+      if (order_by_balance) {
+        // the cursor carries the balance, so it stays valid when the last
+        // holder of the previous page is gone or its balance has changed
+        if (not after_account_id.empty()) {
+          page_filter =
+              " AND \n"
+              "  (account_has_asset.amount, account_has_asset.account_id) < "
+              "(" +
+              transaction_.quote(after_balance) + ", " +
+              transaction_.quote(after_account_id) + ")";
+        }
+        page_order =
+            "  account_has_asset.amount DESC, "
+            "account_has_asset.account_id DESC";
+      } else {
+        if (not after_account_id.empty()) {
+          page_filter = " AND \n  account_has_asset.account_id > " +
+              transaction_.quote(after_account_id);
+        }
+        page_order = "  account_has_asset.account_id";
+      }
+      pqxx::result result;
+      try {
+        result = transaction_.exec(
+            "SELECT \n"
+            "  account_has_asset.account_id,\n"
+            "  account_has_asset.asset_id,\n"
+            "  account_has_asset.amount\n"
+            "FROM \n"
+            "  account_has_asset\n"
+            "WHERE \n"
+            "  account_has_asset.asset_id = " +
+            transaction_.quote(asset_id) + page_filter +
+            "\n"
+            "ORDER BY \n" +
+            page_order +
+            "\n"
+            "LIMIT " +
+            transaction_.quote(limit) + ";");
+      } catch (const std::exception &e) {
+        return nullopt;
+      }
+      std::vector<AccountAsset> holders;
+      for (const auto &row : result) {
+        holders.push_back(makeAccountAsset(row));
+      }
+      return holders;
     }
 
     nonstd::optional<std::vector<model::Peer>> PostgresWsvQuery::getPeers() {
@@ -174,14 +293,128 @@ namespace iroha {
       std::vector<Peer> peers;
       for (const auto &row : result) {
         model::Peer peer;
-        pqxx::binarystring public_key_str(row.at("public_key"));
-        ed25519::pubkey_t pubkey;
-        std::copy(public_key_str.begin(), public_key_str.end(), pubkey.begin());
-        peer.pubkey = pubkey;
+        peer.pubkey = makePubkey(row);
         row.at("address") >> peer.address;
         peers.push_back(peer);
       }
       return peers;
     }
+
+    nonstd::optional<std::vector<model::Account>>
+    PostgresWsvQuery::getAccounts(const std::set<std::string> &account_ids) {
+      std::vector<Account> accounts;
+      if (account_ids.empty()) {
+        return accounts;
+      }
+      pqxx::result result;
+      try {
+        result = transaction_.exec(
+            "SELECT \n"
+            "  *\n"
+            "FROM \n"
+            "  account\n"
+            "WHERE \n"
+            "  account.account_id IN " +
+            makeList(transaction_, account_ids) + ";");
+      } catch (const std::exception &e) {
+        return nullopt;
+      }
+      for (const auto &row : result) {
+        accounts.push_back(makeAccount(row));
+      }
+      return accounts;
+    }
+
+    nonstd::optional<
+        std::unordered_map<std::string, std::vector<ed25519::pubkey_t>>>
+    PostgresWsvQuery::getSignatories(
+        const std::set<std::string> &account_ids) {
+      std::unordered_map<std::string, std::vector<ed25519::pubkey_t>>
+          signatories;
+      if (account_ids.empty()) {
+        return signatories;
+      }
+      pqxx::result result;
+      try {
+        result = transaction_.exec(
+            "SELECT \n"
+            "  account_has_signatory.account_id,\n"
+            "  account_has_signatory.public_key\n"
+            "FROM \n"
+            "  account_has_signatory\n"
+            "WHERE \n"
+            "  account_has_signatory.account_id IN " +
+            makeList(transaction_, account_ids) + ";");
+      } catch (const std::exception &e) {
+        return nullopt;
+      }
+      for (const auto &row : result) {
+        std::string account_id;
+        row.at("account_id") >> account_id;
+        signatories[account_id].push_back(makePubkey(row));
+      }
+      return signatories;
+    }
+
+    nonstd::optional<std::vector<model::Asset>> PostgresWsvQuery::getAssets(
+        const std::set<std::string> &asset_ids) {
+      std::vector<Asset> assets;
+      if (asset_ids.empty()) {
+        return assets;
+      }
+      pqxx::result result;
+      try {
+        result = transaction_.exec(
+            "SELECT \n"
+            "  * \n"
+            "FROM \n"
+            "  asset\n"
+            "WHERE \n"
+            "  asset.asset_id IN " +
+            makeList(transaction_, asset_ids) + ";");
+      } catch (const std::exception &e) {
+        return nullopt;
+      }
+      for (const auto &row : result) {
+        assets.push_back(makeAsset(row));
+      }
+      return assets;
+    }
+
+    nonstd::optional<std::vector<model::AccountAsset>>
+    PostgresWsvQuery::getAccountAssets(
+        const std::set<std::pair<std::string, std::string>>
+            &account_asset_ids) {
+      std::vector<AccountAsset> assets;
+      if (account_asset_ids.empty()) {
+        return assets;
+      }
+      std::string keys;
+      for (const auto &id : account_asset_ids) {
+        if (not keys.empty()) {
+          keys += ", ";
+        }
+        keys += "(" + transaction_.quote(id.first) + ", " +
+            transaction_.quote(id.second) + ")";
+      }
+      pqxx::result result;
+      try {
+        result = transaction_.exec(
+            "SELECT \n"
+            "  * \n"
+            "FROM \n"
+            "  account_has_asset\n"
+            "WHERE \n"
+            "  (account_has_asset.account_id, account_has_asset.asset_id) IN "
+            "(" +
+            keys + ");");
+      } catch (const std::exception &e) {
+        return nullopt;
+      }
+      for (const auto &row : result) {
+        assets.push_back(makeAccountAsset(row));
+      }
+      return assets;
+    }
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -19,6 +19,8 @@
 #define IROHA_POSTGRES_WSV_QUERY_HPP
 
 #include <pqxx/nontransaction>
+#include <set>
+#include <unordered_map>
 #include "ametsuchi/wsv_query.hpp"
 
 namespace iroha {
@@ -34,8 +36,50 @@ namespace iroha {
           const std::string &asset_id) override;
       nonstd::optional<model::AccountAsset> getAccountAsset(
           const std::string &account_id, const std::string &asset_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAccountAssets(
+          const std::string &account_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAssetHolders(
+          const std::string &asset_id,
+          const std::string &after_account_id,
+          uint64_t after_balance,
+          uint32_t limit,
+          bool order_by_balance) override;
       nonstd::optional<std::vector<model::Peer>> getPeers() override;
 
+      /**
+       * Get existing accounts among given ones in one request
+       * @param account_ids
+       * @return found accounts
+       */
+      nonstd::optional<std::vector<model::Account>> getAccounts(
+          const std::set<std::string> &account_ids);
+
+      /**
+       * Get signatories of given accounts in one request
+       * @param account_ids
+       * @return signatories grouped by account_id
+       */
+      nonstd::optional<
+          std::unordered_map<std::string, std::vector<ed25519::pubkey_t>>>
+      getSignatories(const std::set<std::string> &account_ids);
+
+      /**
+       * Get existing assets among given ones in one request
+       * @param asset_ids
+       * @return found assets
+       */
+      nonstd::optional<std::vector<model::Asset>> getAssets(
+          const std::set<std::string> &asset_ids);
+
+      /**
+       * Get existing account assets among given ones in one request
+       * @param account_asset_ids - pairs of account_id and asset_id
+       * @return found account assets
+       */
+      nonstd::optional<std::vector<model::AccountAsset>> getAccountAssets(
+          const std::set<std::pair<std::string, std::string>>
+              &account_asset_ids);
+
      private:
       pqxx::nontransaction &transaction_;
     };
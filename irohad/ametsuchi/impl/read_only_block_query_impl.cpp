@@ -0,0 +1,57 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/read_only_block_query_impl.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    ReadOnlyBlockQueryImpl::ReadOnlyBlockQueryImpl(
+        std::unique_ptr<pqxx::lazyconnection> connection,
+        std::unique_ptr<pqxx::nontransaction> transaction,
+        std::unique_ptr<PostgresBlockQuery> blocks)
+        : connection_(std::move(connection)),
+          transaction_(std::move(transaction)),
+          blocks_(std::move(blocks)) {
+      transaction_->exec(
+          "SET SESSION CHARACTERISTICS AS TRANSACTION READ ONLY;");
+    }
+
+    rxcpp::observable<model::Transaction>
+    ReadOnlyBlockQueryImpl::getAccountTransactions(std::string account_id) {
+      return blocks_->getAccountTransactions(account_id);
+    }
+
+    nonstd::optional<TransactionPage>
+    ReadOnlyBlockQueryImpl::getAccountTransactions(
+        const std::string &account_id,
+        const nonstd::optional<hash256_t> &after_hash,
+        uint32_t limit) {
+      return blocks_->getAccountTransactions(account_id, after_hash, limit);
+    }
+
+    rxcpp::observable<model::Block> ReadOnlyBlockQueryImpl::getBlocks(
+        uint32_t from, uint32_t to) {
+      return blocks_->getBlocks(from, to);
+    }
+
+    uint32_t ReadOnlyBlockQueryImpl::getTopHeight() {
+      return blocks_->getTopHeight();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
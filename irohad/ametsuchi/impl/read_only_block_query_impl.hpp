@@ -0,0 +1,54 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_READ_ONLY_BLOCK_QUERY_IMPL_HPP
+#define IROHA_READ_ONLY_BLOCK_QUERY_IMPL_HPP
+
+#include <pqxx/connection>
+#include <pqxx/nontransaction>
+#include "ametsuchi/impl/postgres_block_query.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Block query which owns its connection to PostgreSQL
+     */
+    class ReadOnlyBlockQueryImpl : public BlockQuery {
+     public:
+      ReadOnlyBlockQueryImpl(std::unique_ptr<pqxx::lazyconnection> connection,
+                             std::unique_ptr<pqxx::nontransaction> transaction,
+                             std::unique_ptr<PostgresBlockQuery> blocks);
+      rxcpp::observable<model::Transaction> getAccountTransactions(
+          std::string account_id) override;
+      nonstd::optional<TransactionPage> getAccountTransactions(
+          const std::string &account_id,
+          const nonstd::optional<hash256_t> &after_hash,
+          uint32_t limit) override;
+      rxcpp::observable<model::Block> getBlocks(uint32_t from,
+                                                uint32_t to) override;
+      uint32_t getTopHeight() override;
+
+     private:
+      std::unique_ptr<pqxx::lazyconnection> connection_;
+      std::unique_ptr<pqxx::nontransaction> transaction_;
+      std::unique_ptr<PostgresBlockQuery> blocks_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_READ_ONLY_BLOCK_QUERY_IMPL_HPP
@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/read_only_wsv_impl.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    ReadOnlyWsvImpl::ReadOnlyWsvImpl(
+        std::unique_ptr<pqxx::lazyconnection> connection,
+        std::unique_ptr<pqxx::nontransaction> transaction,
+        std::unique_ptr<PostgresWsvQuery> wsv)
+        : connection_(std::move(connection)),
+          transaction_(std::move(transaction)),
+          wsv_(std::move(wsv)) {
+      transaction_->exec(
+          "SET SESSION CHARACTERISTICS AS TRANSACTION READ ONLY;");
+    }
+
+    nonstd::optional<model::Account> ReadOnlyWsvImpl::getAccount(
+        const std::string &account_id) {
+      return wsv_->getAccount(account_id);
+    }
+
+    nonstd::optional<std::vector<ed25519::pubkey_t>>
+    ReadOnlyWsvImpl::getSignatories(const std::string &account_id) {
+      return wsv_->getSignatories(account_id);
+    }
+
+    nonstd::optional<model::Asset> ReadOnlyWsvImpl::getAsset(
+        const std::string &asset_id) {
+      return wsv_->getAsset(asset_id);
+    }
+
+    nonstd::optional<model::AccountAsset> ReadOnlyWsvImpl::getAccountAsset(
+        const std::string &account_id, const std::string &asset_id) {
+      return wsv_->getAccountAsset(account_id, asset_id);
+    }
+
+    nonstd::optional<std::vector<model::AccountAsset>>
+    ReadOnlyWsvImpl::getAccountAssets(const std::string &account_id) {
+      return wsv_->getAccountAssets(account_id);
+    }
+
+    nonstd::optional<std::vector<model::AccountAsset>>
+    ReadOnlyWsvImpl::getAssetHolders(const std::string &asset_id,
+                                     const std::string &after_account_id,
+                                     uint64_t after_balance,
+                                     uint32_t limit,
+                                     bool order_by_balance) {
+      return wsv_->getAssetHolders(
+          asset_id, after_account_id, after_balance, limit, order_by_balance);
+    }
+
+    nonstd::optional<std::vector<model::Peer>> ReadOnlyWsvImpl::getPeers() {
+      return wsv_->getPeers();
+    }
+
+    bool ReadOnlyWsvImpl::snapshot(std::function<void()> function) {
+      try {
+        transaction_->exec("BEGIN ISOLATION LEVEL REPEATABLE READ;");
+      } catch (const pqxx::failure &e) {
+        return false;
+      }
+      try {
+        function();
+      } catch (...) {
+        transaction_->exec("ROLLBACK;");
+        throw;
+      }
+      transaction_->exec("COMMIT;");
+      return true;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,64 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_READ_ONLY_WSV_IMPL_HPP
+#define IROHA_READ_ONLY_WSV_IMPL_HPP
+
+#include <pqxx/connection>
+#include <pqxx/nontransaction>
+#include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/read_only_wsv.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * World state view which owns its connection to PostgreSQL
+     */
+    class ReadOnlyWsvImpl : public ReadOnlyWsv {
+     public:
+      ReadOnlyWsvImpl(std::unique_ptr<pqxx::lazyconnection> connection,
+                      std::unique_ptr<pqxx::nontransaction> transaction,
+                      std::unique_ptr<PostgresWsvQuery> wsv);
+      nonstd::optional<model::Account> getAccount(
+          const std::string &account_id) override;
+      nonstd::optional<std::vector<ed25519::pubkey_t>> getSignatories(
+          const std::string &account_id) override;
+      nonstd::optional<model::Asset> getAsset(
+          const std::string &asset_id) override;
+      nonstd::optional<model::AccountAsset> getAccountAsset(
+          const std::string &account_id, const std::string &asset_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAccountAssets(
+          const std::string &account_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAssetHolders(
+          const std::string &asset_id,
+          const std::string &after_account_id,
+          uint64_t after_balance,
+          uint32_t limit,
+          bool order_by_balance) override;
+      nonstd::optional<std::vector<model::Peer>> getPeers() override;
+      bool snapshot(std::function<void()> function) override;
+
+     private:
+      std::unique_ptr<pqxx::lazyconnection> connection_;
+      std::unique_ptr<pqxx::nontransaction> transaction_;
+      std::unique_ptr<PostgresWsvQuery> wsv_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_READ_ONLY_WSV_IMPL_HPP
@@ -17,8 +17,11 @@
 
 #include "ametsuchi/impl/storage_impl.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/read_only_block_query_impl.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/read_only_wsv_impl.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 #include "model/converters/json_common.hpp"
 
@@ -41,7 +44,8 @@ namespace iroha {
           index_(std::move(index)),
           wsv_connection_(std::move(wsv_connection)),
           wsv_transaction_(std::move(wsv_transaction)),
-          wsv_(std::move(wsv)) {
+          wsv_(std::move(wsv)),
+          block_query_(*wsv_transaction_, *block_store_) {
       log_ = logger::log("StorageImpl");
 
       wsv_transaction_->exec(init_);
@@ -62,8 +66,7 @@ namespace iroha {
       }
       auto wsv_transaction = std::make_unique<pqxx::nontransaction>(
           *postgres_connection, "TemporaryWsv");
-      std::unique_ptr<WsvQuery> wsv =
-          std::make_unique<PostgresWsvQuery>(*wsv_transaction);
+      auto wsv = std::make_unique<PostgresWsvQuery>(*wsv_transaction);
       std::unique_ptr<WsvCommand> executor =
           std::make_unique<PostgresWsvCommand>(*wsv_transaction);
 
@@ -72,6 +75,44 @@ namespace iroha {
           std::move(wsv), std::move(executor));
     }
 
+    std::unique_ptr<ReadOnlyWsv> StorageImpl::createWsvQuery() {
+      auto postgres_connection =
+          std::make_unique<pqxx::lazyconnection>(postgres_options_);
+      try {
+        postgres_connection->activate();
+      } catch (const pqxx::broken_connection &e) {
+        log_->error("Connection to PostgreSQL broken: {}", e.what());
+        return nullptr;
+      }
+      auto wsv_transaction = std::make_unique<pqxx::nontransaction>(
+          *postgres_connection, "ReadOnlyWsv");
+      auto wsv = std::make_unique<PostgresWsvQuery>(*wsv_transaction);
+
+      return std::make_unique<ReadOnlyWsvImpl>(std::move(postgres_connection),
+                                               std::move(wsv_transaction),
+                                               std::move(wsv));
+    }
+
+    std::unique_ptr<BlockQuery> StorageImpl::createBlockQuery() {
+      auto postgres_connection =
+          std::make_unique<pqxx::lazyconnection>(postgres_options_);
+      try {
+        postgres_connection->activate();
+      } catch (const pqxx::broken_connection &e) {
+        log_->error("Connection to PostgreSQL broken: {}", e.what());
+        return nullptr;
+      }
+      auto transaction = std::make_unique<pqxx::nontransaction>(
+          *postgres_connection, "BlockQuery");
+      auto blocks =
+          std::make_unique<PostgresBlockQuery>(*transaction, *block_store_);
+
+      return std::make_unique<ReadOnlyBlockQueryImpl>(
+          std::move(postgres_connection),
+          std::move(transaction),
+          std::move(blocks));
+    }
+
     std::unique_ptr<MutableStorage> StorageImpl::createMutableStorage() {
       // TODO lock
 
@@ -169,17 +210,72 @@ namespace iroha {
           std::make_unique<PostgresWsvQuery>(*wsv_transaction);
       log_->info("transaction to PostgreSQL initialized");
 
-      return std::shared_ptr<StorageImpl>(
+      auto storage = std::shared_ptr<StorageImpl>(
           new StorageImpl(block_store_dir, redis_host, redis_port,
                           postgres_options, std::move(block_store),
                           std::move(index), std::move(postgres_connection),
                           std::move(wsv_transaction), std::move(wsv)));
+      // history of accounts would silently miss not indexed blocks
+      if (not storage->indexBlockStore()) {
+        log_->error("Cannot index transactions of block store");
+        return nullptr;
+      }
+      return storage;
     }
 
-    void StorageImpl::commit(std::unique_ptr<MutableStorage> mutableStorage) {
+    bool StorageImpl::indexBlockStore() {
+      PostgresBlockIndex block_index(*wsv_transaction_);
+      auto indexed = block_index.lastIndexedHeight();
+      if (not indexed.has_value()) {
+        return false;
+      }
+      // trailing blocks without transactions are read again on each start,
+      // they add nothing to the index
+      auto top = block_store_->last_id();
+      if (indexed.value() >= top) {
+        return true;
+      }
+      log_->info("Indexing blocks {} to {}", indexed.value() + 1, top);
+      try {
+        // the session is read only, blocks are indexed in one transaction,
+        // so the index never has gaps
+        wsv_transaction_->exec("BEGIN; SET TRANSACTION READ WRITE;");
+        for (auto height = indexed.value() + 1; height <= top; ++height) {
+          nonstd::optional<model::Block> block;
+          auto blob = block_store_->get(height);
+          if (blob.has_value()) {
+            auto document = model::converters::vectorToJson(blob.value());
+            if (document.has_value()) {
+              block = serializer_.deserialize(document.value());
+            }
+          }
+          if (not block.has_value() or not block_index.index(block.value())) {
+            log_->error("Block {} cannot be indexed", height);
+            wsv_transaction_->exec("ROLLBACK;");
+            return false;
+          }
+        }
+        wsv_transaction_->exec("COMMIT;");
+      } catch (const pqxx::failure &e) {
+        log_->error("Indexing of block store failed: {}", e.what());
+        return false;
+      }
+      return true;
+    }
+
+    bool StorageImpl::commit(std::unique_ptr<MutableStorage> mutableStorage) {
       std::unique_lock<std::shared_timed_mutex> write(rw_lock_);
       auto storage_ptr = std::move(mutableStorage);  // get ownership of storage
       auto storage = static_cast<MutableStorageImpl *>(storage_ptr.get());
+      // index is written in the transaction of world state view, so it is
+      // committed or rolled back together with it
+      PostgresBlockIndex block_index(*storage->transaction_);
+      for (const auto &block : storage->block_store_) {
+        if (not block_index.index(block.second)) {
+          log_->error("Block {} is not committed", block.first);
+          return false;
+        }
+      }
       for (const auto &block : storage->block_store_) {
         block_store_->add(block.first,
                           model::converters::jsonToVector(
@@ -188,47 +284,32 @@ namespace iroha {
       storage->index_->exec();
       storage->transaction_->exec("COMMIT;");
       storage->committed = true;
+      return true;
     }
 
     rxcpp::observable<model::Transaction> StorageImpl::getAccountTransactions(
         std::string account_id) {
-      std::shared_lock<std::shared_timed_mutex> write(rw_lock_);
-      auto last_id = block_store_->last_id();
-      return getBlocks(1, last_id)
-          .flat_map([](auto block) {
-            return rxcpp::observable<>::iterate(block.transactions);
-          })
-          .filter([account_id](auto tx) {
-            return tx.creator_account_id == account_id;
-          });
+      std::shared_lock<std::shared_timed_mutex> read(rw_lock_);
+      return block_query_.getAccountTransactions(account_id);
+    }
+
+    nonstd::optional<TransactionPage> StorageImpl::getAccountTransactions(
+        const std::string &account_id,
+        const nonstd::optional<hash256_t> &after_hash,
+        uint32_t limit) {
+      std::shared_lock<std::shared_timed_mutex> read(rw_lock_);
+      return block_query_.getAccountTransactions(account_id, after_hash, limit);
     }
 
     rxcpp::observable<model::Block> StorageImpl::getBlocks(uint32_t from,
                                                            uint32_t to) {
-      std::shared_lock<std::shared_timed_mutex> write(rw_lock_);
-      auto last_id = block_store_->last_id();
-      if (to > last_id) {
-        to = last_id;
-      }
-      return rxcpp::observable<>::range(from, to).flat_map([this](auto i) {
-        auto bytes = block_store_->get(i);
-        return rxcpp::observable<>::create<model::Block>(
-            [this, bytes](auto s) {
-              if (not bytes.has_value()) {
-                s.on_completed();
-              }
-              auto document = model::converters::vectorToJson(bytes.value());
-              if (not document.has_value()) {
-                s.on_completed();
-              }
-              auto block = serializer_.deserialize(document.value());
-              if (not block.has_value()) {
-                s.on_completed();
-              }
-              s.on_next(block.value());
-              s.on_completed();
-            });
-      });
+      std::shared_lock<std::shared_timed_mutex> read(rw_lock_);
+      return block_query_.getBlocks(from, to);
+    }
+
+    uint32_t StorageImpl::getTopHeight() {
+      std::shared_lock<std::shared_timed_mutex> read(rw_lock_);
+      return block_query_.getTopHeight();
     }
 
     nonstd::optional<model::Account> StorageImpl::getAccount(
@@ -255,6 +336,23 @@ namespace iroha {
       return wsv_->getAccountAsset(account_id, asset_id);
     }
 
+    nonstd::optional<std::vector<model::AccountAsset>>
+    StorageImpl::getAccountAssets(const std::string &account_id) {
+      std::shared_lock<std::shared_timed_mutex> write(rw_lock_);
+      return wsv_->getAccountAssets(account_id);
+    }
+
+    nonstd::optional<std::vector<model::AccountAsset>>
+    StorageImpl::getAssetHolders(const std::string &asset_id,
+                                 const std::string &after_account_id,
+                                 uint64_t after_balance,
+                                 uint32_t limit,
+                                 bool order_by_balance) {
+      std::shared_lock<std::shared_timed_mutex> write(rw_lock_);
+      return wsv_->getAssetHolders(
+          asset_id, after_account_id, after_balance, limit, order_by_balance);
+    }
+
     nonstd::optional<std::vector<model::Peer>> StorageImpl::getPeers() {
       std::shared_lock<std::shared_timed_mutex> write(rw_lock_);
       return wsv_->getPeers();
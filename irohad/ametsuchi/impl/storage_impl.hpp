@@ -25,6 +25,8 @@
 #include <cmath>
 #include "model/converters/json_block_factory.hpp"
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/postgres_block_query.hpp"
+#include "ametsuchi/impl/postgres_wsv_bulk_loader.hpp"
 #include "ametsuchi/storage.hpp"
 #include "logger/logger.hpp"
 
@@ -37,12 +39,19 @@ namespace iroha {
           std::size_t redis_port, std::string postgres_connection);
       std::unique_ptr<TemporaryWsv> createTemporaryWsv() override;
       std::unique_ptr<MutableStorage> createMutableStorage() override;
-      void commit(std::unique_ptr<MutableStorage> mutableStorage) override;
+      std::unique_ptr<ReadOnlyWsv> createWsvQuery() override;
+      std::unique_ptr<BlockQuery> createBlockQuery() override;
+      bool commit(std::unique_ptr<MutableStorage> mutableStorage) override;
 
       rxcpp::observable<model::Transaction> getAccountTransactions(
           std::string account_id) override;
+      nonstd::optional<TransactionPage> getAccountTransactions(
+          const std::string &account_id,
+          const nonstd::optional<hash256_t> &after_hash,
+          uint32_t limit) override;
       rxcpp::observable<model::Block> getBlocks(uint32_t from,
                                                 uint32_t to) override;
+      uint32_t getTopHeight() override;
 
       nonstd::optional<model::Account> getAccount(
           const std::string &account_id) override;
@@ -52,6 +61,14 @@ namespace iroha {
           const std::string &asset_id) override;
       nonstd::optional<model::AccountAsset> getAccountAsset(
           const std::string &account_id, const std::string &asset_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAccountAssets(
+          const std::string &account_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAssetHolders(
+          const std::string &asset_id,
+          const std::string &after_account_id,
+          uint64_t after_balance,
+          uint32_t limit,
+          bool order_by_balance) override;
       nonstd::optional<std::vector<model::Peer>> getPeers() override;
 
      private:
@@ -62,6 +79,15 @@ namespace iroha {
                   std::unique_ptr<pqxx::lazyconnection> wsv_connection,
                   std::unique_ptr<pqxx::nontransaction> wsv_transaction,
                   std::unique_ptr<WsvQuery> wsv);
+
+      /**
+       * Add blocks of the block store which are above the account
+       * transactions index to it, e.g. blocks committed before the index
+       * existed
+       * @return true if the index covers the block store
+       */
+      bool indexBlockStore();
+
       // Storage info
       const std::string block_store_dir_;
       const std::string redis_host_;
@@ -74,6 +100,7 @@ namespace iroha {
       std::unique_ptr<pqxx::lazyconnection> wsv_connection_;
       std::unique_ptr<pqxx::nontransaction> wsv_transaction_;
       std::unique_ptr<WsvQuery> wsv_;
+      PostgresBlockQuery block_query_;
 
       model::converters::JsonBlockFactory serializer_;
 
@@ -126,7 +153,38 @@ namespace iroha {
           "    amount bigint NOT NULL,\n"
           "    permissions bit varying NOT NULL,\n"
           "    PRIMARY KEY (account_id, asset_id)\n"
-          ");\n"
+          ");\n" +
+          PostgresWsvBulkLoader::create_indices_ +
+          PostgresBlockIndex::init_ +
+          "CREATE OR REPLACE FUNCTION transfer_account_asset(\n"
+          "    src character varying, dest character varying,\n"
+          "    asset character varying, transfer_amount bigint)\n"
+          "RETURNS int AS $$\n"
+          "DECLARE\n"
+          "    src_amount bigint;\n"
+          "    dest_amount bigint;\n"
+          "BEGIN\n"
+          "    SELECT amount INTO src_amount FROM account_has_asset\n"
+          "        WHERE account_id = src AND asset_id = asset FOR UPDATE;\n"
+          "    IF NOT FOUND THEN RETURN 1; END IF;\n"
+          "    IF src_amount < transfer_amount THEN RETURN 2; END IF;\n"
+          "    IF src = dest THEN RETURN 0; END IF;\n"
+          "    SELECT amount INTO dest_amount FROM account_has_asset\n"
+          "        WHERE account_id = dest AND asset_id = asset FOR UPDATE;\n"
+          "    IF FOUND AND\n"
+          "        dest_amount > 9223372036854775807 - transfer_amount THEN\n"
+          "        RETURN 3;\n"
+          "    END IF;\n"
+          "    UPDATE account_has_asset SET amount = amount - transfer_amount\n"
+          "        WHERE account_id = src AND asset_id = asset;\n"
+          "    INSERT INTO account_has_asset\n"
+          "        (account_id, asset_id, amount, permissions)\n"
+          "        VALUES (dest, asset, transfer_amount, B'0')\n"
+          "        ON CONFLICT (account_id, asset_id) DO UPDATE\n"
+          "        SET amount = account_has_asset.amount + EXCLUDED.amount;\n"
+          "    RETURN 0;\n"
+          "END;\n"
+          "$$ LANGUAGE plpgsql;\n"
           "CREATE TABLE IF NOT EXISTS exchange (\n"
           "    asset1_id character varying(197) NOT NULL REFERENCES "
           "asset(asset_id),\n"
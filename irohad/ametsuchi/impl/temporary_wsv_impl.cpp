@@ -25,7 +25,7 @@ namespace iroha {
                                                     WsvCommand &, WsvQuery &)>
                                      function) {
       transaction_->exec("SAVEPOINT savepoint_;");
-      auto result = function(transaction, *executor_, *this);
+      auto result = function(transaction, cached_executor_, *this);
       if (result) {
         transaction_->exec("RELEASE SAVEPOINT savepoint_;");
       } else {
@@ -37,36 +37,106 @@ namespace iroha {
     TemporaryWsvImpl::TemporaryWsvImpl(
         std::unique_ptr<pqxx::lazyconnection> connection,
         std::unique_ptr<pqxx::nontransaction> transaction,
-        std::unique_ptr<WsvQuery> wsv, std::unique_ptr<WsvCommand> executor)
+        std::unique_ptr<PostgresWsvQuery> wsv,
+        std::unique_ptr<WsvCommand> executor)
         : connection_(std::move(connection)),
           transaction_(std::move(transaction)),
           wsv_(std::move(wsv)),
-          executor_(std::move(executor)) {
+          executor_(std::move(executor)),
+          cached_executor_(*executor_, cache_) {
       transaction_->exec("BEGIN;");
     }
 
+    void TemporaryWsvImpl::prefetch(const PrefetchKeys &keys) {
+      // keys are marked as absent first, so missing entries are not
+      // requested again one by one
+      auto accounts = wsv_->getAccounts(keys.account_ids);
+      auto signatories = wsv_->getSignatories(keys.account_ids);
+      if (accounts and signatories) {
+        for (const auto &account_id : keys.account_ids) {
+          cache_.accounts[account_id] = nonstd::nullopt;
+          cache_.signatories[account_id] = {};
+        }
+        for (auto &account : *accounts) {
+          cache_.accounts[account.account_id] = account;
+        }
+        for (auto &signatory : *signatories) {
+          cache_.signatories[signatory.first] = std::move(signatory.second);
+        }
+      }
+      auto assets = wsv_->getAssets(keys.asset_ids);
+      if (assets) {
+        for (const auto &asset_id : keys.asset_ids) {
+          cache_.assets[asset_id] = nonstd::nullopt;
+        }
+        for (auto &asset : *assets) {
+          cache_.assets[asset.asset_id] = asset;
+        }
+      }
+      auto account_assets = wsv_->getAccountAssets(keys.account_asset_ids);
+      if (account_assets) {
+        for (const auto &id : keys.account_asset_ids) {
+          cache_.account_assets[id] = nonstd::nullopt;
+        }
+        for (auto &asset : *account_assets) {
+          cache_.account_assets[{asset.account_id, asset.asset_id}] = asset;
+        }
+      }
+    }
+
     TemporaryWsvImpl::~TemporaryWsvImpl() { transaction_->exec("ROLLBACK;"); }
 
     nonstd::optional<model::Account> TemporaryWsvImpl::getAccount(
         const std::string &account_id) {
+      auto it = cache_.accounts.find(account_id);
+      if (it != cache_.accounts.end()) {
+        return it->second;
+      }
       return wsv_->getAccount(account_id);
     }
 
     nonstd::optional<std::vector<ed25519::pubkey_t>>
     TemporaryWsvImpl::getSignatories(const std::string &account_id) {
+      auto it = cache_.signatories.find(account_id);
+      if (it != cache_.signatories.end()) {
+        return it->second;
+      }
       return wsv_->getSignatories(account_id);
     }
 
     nonstd::optional<model::Asset> TemporaryWsvImpl::getAsset(
         const std::string &asset_id) {
+      auto it = cache_.assets.find(asset_id);
+      if (it != cache_.assets.end()) {
+        return it->second;
+      }
       return wsv_->getAsset(asset_id);
     }
 
     nonstd::optional<model::AccountAsset> TemporaryWsvImpl::getAccountAsset(
         const std::string &account_id, const std::string &asset_id) {
+      auto it = cache_.account_assets.find({account_id, asset_id});
+      if (it != cache_.account_assets.end()) {
+        return it->second;
+      }
       return wsv_->getAccountAsset(account_id, asset_id);
     }
 
+    nonstd::optional<std::vector<model::AccountAsset>>
+    TemporaryWsvImpl::getAccountAssets(const std::string &account_id) {
+      return wsv_->getAccountAssets(account_id);
+    }
+
+    nonstd::optional<std::vector<model::AccountAsset>>
+    TemporaryWsvImpl::getAssetHolders(const std::string &asset_id,
+                                      const std::string &after_account_id,
+                                      uint64_t after_balance,
+                                      uint32_t limit,
+                                      bool order_by_balance) {
+      return wsv_->getAssetHolders(
+          asset_id, after_account_id, after_balance, limit, order_by_balance);
+    }
+
     nonstd::optional<std::vector<model::Peer>> TemporaryWsvImpl::getPeers() {
       return wsv_->getPeers();
     }
@@ -20,6 +20,8 @@
 
 #include <pqxx/connection>
 #include <pqxx/nontransaction>
+#include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "ametsuchi/temporary_wsv.hpp"
 
 namespace iroha {
@@ -28,8 +30,9 @@ namespace iroha {
      public:
       TemporaryWsvImpl(std::unique_ptr<pqxx::lazyconnection> connection,
                        std::unique_ptr<pqxx::nontransaction> transaction,
-                       std::unique_ptr<WsvQuery> wsv,
+                       std::unique_ptr<PostgresWsvQuery> wsv,
                        std::unique_ptr<WsvCommand> executor);
+      void prefetch(const PrefetchKeys &keys) override;
       bool apply(const model::Transaction &transaction,
                  std::function<bool(const model::Transaction &, WsvCommand &,
                                     WsvQuery &)>
@@ -42,14 +45,25 @@ namespace iroha {
           const std::string &asset_id) override;
       nonstd::optional<model::AccountAsset> getAccountAsset(
           const std::string &account_id, const std::string &asset_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAccountAssets(
+          const std::string &account_id) override;
+      nonstd::optional<std::vector<model::AccountAsset>> getAssetHolders(
+          const std::string &asset_id,
+          const std::string &after_account_id,
+          uint64_t after_balance,
+          uint32_t limit,
+          bool order_by_balance) override;
       nonstd::optional<std::vector<model::Peer>> getPeers() override;
       ~TemporaryWsvImpl() override;
 
      private:
       std::unique_ptr<pqxx::lazyconnection> connection_;
       std::unique_ptr<pqxx::nontransaction> transaction_;
-      std::unique_ptr<WsvQuery> wsv_;
+      std::unique_ptr<PostgresWsvQuery> wsv_;
       std::unique_ptr<WsvCommand> executor_;
+
+      WsvCache cache_;
+      CacheEvictingWsvCommand cached_executor_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    CacheEvictingWsvCommand::CacheEvictingWsvCommand(WsvCommand &command,
+                                                     WsvCache &cache)
+        : command_(command), cache_(cache) {}
+
+    bool CacheEvictingWsvCommand::insertAccount(const model::Account &account) {
+      cache_.accounts.erase(account.account_id);
+      cache_.signatories.erase(account.account_id);
+      return command_.insertAccount(account);
+    }
+
+    bool CacheEvictingWsvCommand::updateAccount(const model::Account &account) {
+      cache_.accounts.erase(account.account_id);
+      return command_.updateAccount(account);
+    }
+
+    bool CacheEvictingWsvCommand::insertAsset(const model::Asset &asset) {
+      cache_.assets.erase(asset.asset_id);
+      return command_.insertAsset(asset);
+    }
+
+    bool CacheEvictingWsvCommand::upsertAccountAsset(
+        const model::AccountAsset &asset) {
+      cache_.account_assets.erase({asset.account_id, asset.asset_id});
+      return command_.upsertAccountAsset(asset);
+    }
+
+    bool CacheEvictingWsvCommand::addAccountAssetBalance(
+        const std::string &account_id,
+        const std::string &asset_id,
+        uint64_t amount) {
+      cache_.account_assets.erase({account_id, asset_id});
+      return command_.addAccountAssetBalance(account_id, asset_id, amount);
+    }
+
+    bool CacheEvictingWsvCommand::transferAccountAsset(
+        const std::string &src_account_id,
+        const std::string &dest_account_id,
+        const std::string &asset_id,
+        uint64_t amount) {
+      cache_.account_assets.erase({src_account_id, asset_id});
+      cache_.account_assets.erase({dest_account_id, asset_id});
+      return command_.transferAccountAsset(
+          src_account_id, dest_account_id, asset_id, amount);
+    }
+
+    bool CacheEvictingWsvCommand::insertSignatory(
+        const ed25519::pubkey_t &signatory) {
+      return command_.insertSignatory(signatory);
+    }
+
+    bool CacheEvictingWsvCommand::insertAccountSignatory(
+        const std::string &account_id, const ed25519::pubkey_t &signatory) {
+      cache_.signatories.erase(account_id);
+      return command_.insertAccountSignatory(account_id, signatory);
+    }
+
+    bool CacheEvictingWsvCommand::deleteAccountSignatory(
+        const std::string &account_id, const ed25519::pubkey_t &signatory) {
+      cache_.signatories.erase(account_id);
+      return command_.deleteAccountSignatory(account_id, signatory);
+    }
+
+    bool CacheEvictingWsvCommand::insertPeer(const model::Peer &peer) {
+      return command_.insertPeer(peer);
+    }
+
+    bool CacheEvictingWsvCommand::deletePeer(const model::Peer &peer) {
+      return command_.deletePeer(peer);
+    }
+
+    bool CacheEvictingWsvCommand::insertDomain(const model::Domain &domain) {
+      return command_.insertDomain(domain);
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,82 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_WSV_CACHE_HPP
+#define IROHA_WSV_CACHE_HPP
+
+#include <map>
+#include <nonstd/optional.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "ametsuchi/wsv_command.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Proposal-scoped cache of world state view entries.
+     * Entry with nullopt value means that the key is known to be absent.
+     */
+    struct WsvCache {
+      std::unordered_map<std::string, nonstd::optional<model::Account>>
+          accounts;
+      std::unordered_map<std::string, std::vector<ed25519::pubkey_t>>
+          signatories;
+      std::unordered_map<std::string, nonstd::optional<model::Asset>> assets;
+      std::map<std::pair<std::string, std::string>,
+               nonstd::optional<model::AccountAsset>>
+          account_assets;
+    };
+
+    /**
+     * Wsv command, which evicts modified entries from cache before
+     * forwarding the write to underlying command.
+     * Evicted entries are read from storage afterwards, so cache stays
+     * consistent with both applied and rolled back transactions.
+     */
+    class CacheEvictingWsvCommand : public WsvCommand {
+     public:
+      CacheEvictingWsvCommand(WsvCommand &command, WsvCache &cache);
+      bool insertAccount(const model::Account &account) override;
+      bool updateAccount(const model::Account &account) override;
+      bool insertAsset(const model::Asset &asset) override;
+      bool upsertAccountAsset(const model::AccountAsset &asset) override;
+      bool addAccountAssetBalance(const std::string &account_id,
+                                  const std::string &asset_id,
+                                  uint64_t amount) override;
+      bool transferAccountAsset(const std::string &src_account_id,
+                                const std::string &dest_account_id,
+                                const std::string &asset_id,
+                                uint64_t amount) override;
+      bool insertSignatory(const ed25519::pubkey_t &signatory) override;
+      bool insertAccountSignatory(const std::string &account_id,
+                                  const ed25519::pubkey_t &signatory) override;
+      bool deleteAccountSignatory(const std::string &account_id,
+                                  const ed25519::pubkey_t &signatory) override;
+      bool insertPeer(const model::Peer &peer) override;
+      bool deletePeer(const model::Peer &peer) override;
+      bool insertDomain(const model::Domain &domain) override;
+
+     private:
+      WsvCommand &command_;
+      WsvCache &cache_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_CACHE_HPP
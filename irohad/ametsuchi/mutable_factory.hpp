@@ -38,8 +38,9 @@ namespace iroha {
        * This transforms Ametsuchi to the new state consistent with
        * MutableStorage.
        * @param mutableStorage
+       * @return false if storage is not committed and is rolled back
        */
-      virtual void commit(std::unique_ptr<MutableStorage> mutableStorage) = 0;
+      virtual bool commit(std::unique_ptr<MutableStorage> mutableStorage) = 0;
 
       virtual ~MutableFactory() = default;
     };
@@ -51,6 +51,27 @@ namespace iroha {
           std::function<bool(const model::Block &, WsvCommand &, WsvQuery &,
                              const hash256_t &)>
               function) = 0;
+
+      /**
+       * Applies blocks to empty mutable state in bulk.
+       * Function is called for every block against in-memory state first,
+       * and the resulting state is written at once only if it succeeds
+       * for all blocks.
+       * @param blocks Blocks to be applied
+       * @param function Function that specifies the logic used to apply a
+       * block
+       * Function parameters:
+       *  - Block @see block
+       *  - CommandExecutor
+       *  - WsvQuery
+       * Function returns true if the block is successfully applied, false
+       * otherwise.
+       * @return True if all blocks were successfully applied, false otherwise.
+       */
+      virtual bool applyBulk(
+          const std::vector<model::Block> &blocks,
+          std::function<bool(const model::Block &, WsvCommand &, WsvQuery &)>
+              function) = 0;
     };
 
   }  // namespace ametsuchi
@@ -0,0 +1,45 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_READ_ONLY_WSV_HPP
+#define IROHA_READ_ONLY_WSV_HPP
+
+#include <functional>
+#include "ametsuchi/wsv_query.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * World state view which is only read and may be read as of one moment
+     */
+    class ReadOnlyWsv : public WsvQuery {
+     public:
+      /**
+       * Runs function so that all queries made from it read the state of
+       * ledger as of its start, blocks committed meanwhile are not seen
+       * @param function - queries to run on the snapshot
+       * @return true if function was run on the snapshot, false otherwise
+       */
+      virtual bool snapshot(std::function<void()> function) = 0;
+
+      virtual ~ReadOnlyWsv() = default;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+#endif  // IROHA_READ_ONLY_WSV_HPP
@@ -20,8 +20,10 @@
 
 #include <ametsuchi/block_query.hpp>
 #include <ametsuchi/wsv_query.hpp>
+#include "ametsuchi/block_query_factory.hpp"
 #include "ametsuchi/temporary_factory.hpp"
 #include "ametsuchi/mutable_factory.hpp"
+#include "ametsuchi/wsv_query_factory.hpp"
 
 namespace iroha {
 
@@ -32,7 +34,8 @@ namespace iroha {
      * creation of state which can be mutated with blocks and transactions
      */
     class Storage : public WsvQuery, public BlockQuery, public TemporaryFactory,
-                    public MutableFactory {
+                    public MutableFactory, public WsvQueryFactory,
+                    public BlockQueryFactory {
      public:
       virtual ~Storage() = default;
     };
@@ -23,11 +23,31 @@
 #include <functional>
 #include <model/block.hpp>
 #include <model/transaction.hpp>
+#include <set>
+#include <string>
+#include <utility>
 
 namespace iroha {
 
   namespace ametsuchi {
 
+    /**
+     * Keys of world state view, which are going to be read
+     */
+    struct PrefetchKeys {
+      /**
+       * Accounts, including their signatories
+       */
+      std::set<std::string> account_ids;
+
+      std::set<std::string> asset_ids;
+
+      /**
+       * Pairs of account_id and asset_id
+       */
+      std::set<std::pair<std::string, std::string>> account_asset_ids;
+    };
+
     /**
      * Temporary world state view
      * Allows to query the temporary world state view
@@ -35,6 +55,15 @@ namespace iroha {
     class TemporaryWsv : public WsvQuery {
      public:
       virtual ~TemporaryWsv() = default;
+
+      /**
+       * Load state of given keys at once, so following queries of these keys
+       * are served without requests to storage.
+       * Loaded state stays valid while transactions are applied.
+       * @param keys - keys which are going to be queried
+       */
+      virtual void prefetch(const PrefetchKeys &keys) = 0;
+
       /**
        * Applies a transaction to current state
        * using logic specified in function
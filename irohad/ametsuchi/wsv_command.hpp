@@ -64,6 +64,33 @@ namespace iroha {
        */
       virtual bool upsertAccountAsset(const model::AccountAsset &asset) = 0;
 
+      /**
+       * Add amount to balance of account asset, create account asset if it
+       * does not exist
+       * @param account_id
+       * @param asset_id
+       * @param amount - amount in minimal units of the asset
+       * @return false if balance overflows or account does not exist
+       */
+      virtual bool addAccountAssetBalance(const std::string &account_id,
+                                          const std::string &asset_id,
+                                          uint64_t amount) = 0;
+
+      /**
+       * Move amount between account assets of two accounts, create
+       * destination account asset if it does not exist
+       * @param src_account_id
+       * @param dest_account_id
+       * @param asset_id
+       * @param amount - amount in minimal units of the asset
+       * @return false if source has insufficient balance, destination balance
+       * overflows or destination account does not exist
+       */
+      virtual bool transferAccountAsset(const std::string &src_account_id,
+                                        const std::string &dest_account_id,
+                                        const std::string &asset_id,
+                                        uint64_t amount) = 0;
+
       /**
        *
        * @param signatory
@@ -70,6 +70,33 @@ namespace iroha {
       virtual nonstd::optional<model::AccountAsset> getAccountAsset(
           const std::string &account_id, const std::string &asset_id) = 0;
 
+      /**
+       * Get all assets of account, ordered by asset_id
+       * @param account_id
+       * @return account assets, empty if account has no assets
+       */
+      virtual nonstd::optional<std::vector<model::AccountAsset>>
+      getAccountAssets(const std::string &account_id) = 0;
+
+      /**
+       * Get one page of accounts holding the asset
+       * @param asset_id
+       * @param after_account_id - last account of previous page, empty for
+       * the first page
+       * @param after_balance - balance of the last account of previous page,
+       * used when ordered by balance
+       * @param limit - maximum number of holders to return
+       * @param order_by_balance - order by balance descending instead of
+       * account_id
+       * @return account assets of holders
+       */
+      virtual nonstd::optional<std::vector<model::AccountAsset>>
+      getAssetHolders(const std::string &asset_id,
+                      const std::string &after_account_id,
+                      uint64_t after_balance,
+                      uint32_t limit,
+                      bool order_by_balance) = 0;
+
       /**
        *
        * @return
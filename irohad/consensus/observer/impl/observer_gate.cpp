@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "consensus/observer/observer_gate.hpp"
+#include <endpoint.grpc.pb.h>
+
+namespace iroha {
+  namespace consensus {
+
+    ObserverGate::ObserverGate(
+        std::vector<std::string> validators,
+        std::shared_ptr<ametsuchi::BlockQuery> block_query,
+        std::chrono::milliseconds retry_delay)
+        : validators_(std::move(validators)),
+          block_query_(std::move(block_query)),
+          retry_delay_(retry_delay) {
+      log_ = logger::log("ObserverGate");
+    }
+
+    ObserverGate::~ObserverGate() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+        if (context_) {
+          context_->TryCancel();
+        }
+      }
+      cv_.notify_all();
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+    }
+
+    void ObserverGate::start() {
+      if (validators_.empty()) {
+        log_->error("no validators to follow");
+        return;
+      }
+      thread_ = std::thread([this] { this->follow(); });
+    }
+
+    void ObserverGate::vote(model::Block block) {
+      log_->warn("observer does not vote, block {} is ignored", block.height);
+    }
+
+    rxcpp::observable<model::Block> ObserverGate::on_commit() {
+      return notifier_.get_observable();
+    }
+
+    void ObserverGate::follow() {
+      size_t validator = 0;
+      while (true) {
+        const auto &address = validators_.at(validator);
+        log_->info("following validator {}", address);
+        auto status = followValidator(address);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (stopped_) {
+          return;
+        }
+        log_->warn("block stream of {} is over: {}",
+                   address,
+                   status.error_message());
+        validator = (validator + 1) % validators_.size();
+        if (cv_.wait_for(lock, retry_delay_, [this] { return stopped_; })) {
+          return;
+        }
+      }
+    }
+
+    grpc::Status ObserverGate::followValidator(const std::string &address) {
+      auto stub = protocol::QueryService::NewStub(
+          grpc::CreateChannel(address, grpc::InsecureChannelCredentials()));
+      grpc::ClientContext context;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_) {
+          return grpc::Status::CANCELLED;
+        }
+        context_ = &context;
+      }
+
+      // synchronizer applies each block before the next one is read,
+      // so the stream continues right after the top of the ledger
+      protocol::BlocksSubscription request;
+      request.set_from_height(block_query_->getTopHeight() + 1);
+      auto reader = stub->SubscribeBlocks(&context, request);
+      protocol::BlockEvent event;
+      grpc::Status rejected;
+      while (reader->Read(&event)) {
+        auto block = block_factory_.deserialize(event.block());
+        notifier_.get_subscriber().on_next(block);
+        // block which is not applied breaks the chain, the rest of the
+        // stream can not be applied either
+        if (block_query_->getTopHeight() < block.height) {
+          rejected = grpc::Status(
+              grpc::StatusCode::ABORTED,
+              "block " + std::to_string(block.height) + " is not applied");
+          context.TryCancel();
+          break;
+        }
+      }
+      auto status = reader->Finish();
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      context_ = nullptr;
+      return rejected.ok() ? status : rejected;
+    }
+
+  }  // namespace consensus
+}  // namespace iroha
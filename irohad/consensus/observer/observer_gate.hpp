@@ -0,0 +1,105 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_OBSERVER_GATE_HPP
+#define IROHA_OBSERVER_GATE_HPP
+
+#include <grpc++/grpc++.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ametsuchi/block_query.hpp"
+#include "logger/logger.hpp"
+#include "model/converters/pb_block_factory.hpp"
+#include "network/consensus_gate.hpp"
+
+namespace iroha {
+  namespace consensus {
+
+    /**
+     * Consensus gate of observer peer. Observer is not in the peer set and
+     * does not vote, it follows blocks committed by validators through
+     * their block stream, synchronizer validates and applies them.
+     */
+    class ObserverGate : public network::ConsensusGate {
+     public:
+      /**
+       * @param validators - torii addresses of validators, host:port,
+       * the next one is followed when the stream of current one breaks
+       * @param block_query - ledger of observer, stream continues after
+       * its top block
+       * @param retry_delay - pause before following the next validator
+       */
+      ObserverGate(std::vector<std::string> validators,
+                   std::shared_ptr<ametsuchi::BlockQuery> block_query,
+                   std::chrono::milliseconds retry_delay =
+                       std::chrono::milliseconds(1000));
+
+      /**
+       * Stops following validators
+       */
+      ~ObserverGate() override;
+
+      /**
+       * Start following validators, blocks are emitted from another thread
+       */
+      void start();
+
+      /**
+       * Observer does not take part in consensus, the block is ignored
+       */
+      void vote(model::Block block) override;
+
+      rxcpp::observable<model::Block> on_commit() override;
+
+     private:
+      /**
+       * Read blocks from validators until the gate is stopped
+       */
+      void follow();
+
+      /**
+       * Read blocks from one validator until the stream is over, or until
+       * an emitted block is not applied to the ledger
+       * @param address - torii address of validator
+       * @return status of the stream
+       */
+      grpc::Status followValidator(const std::string &address);
+
+      std::vector<std::string> validators_;
+      std::shared_ptr<ametsuchi::BlockQuery> block_query_;
+      std::chrono::milliseconds retry_delay_;
+      model::converters::PbBlockFactory block_factory_;
+      rxcpp::subjects::subject<model::Block> notifier_;
+
+      std::mutex mutex_;
+      std::condition_variable cv_;
+      bool stopped_ = false;
+      // context of the stream being read, cancelled on stop
+      grpc::ClientContext *context_ = nullptr;
+      std::thread thread_;
+
+      logger::Logger log_;
+    };
+
+  }  // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_OBSERVER_GATE_HPP
@@ -25,12 +25,14 @@ namespace iroha {
   namespace consensus {
     namespace yac {
 
-      NetworkImpl::NetworkImpl(const std::string &address,
-                               const std::vector<model::Peer> &peers)
+      NetworkImpl::NetworkImpl(
+          const std::string &address,
+          const std::vector<model::Peer> &peers,
+          std::shared_ptr<network::ChannelRegistry> channels)
           : address_(address) {
         for (const auto &peer : peers) {
-          peers_[peer] = proto::Yac::NewStub(grpc::CreateChannel(
-              peer.address, grpc::InsecureChannelCredentials()));
+          peers_[peer] =
+              proto::Yac::NewStub(channels->getChannel(peer.address));
           peers_addresses_[peer.address] = peer;
         }
       }
@@ -54,14 +56,15 @@ namespace iroha {
                                 vote.signature.pubkey.size());
         }
 
-        auto call = new AsyncClientCall;
+        auto call = makeCall();
 
         call->context.AddMetadata("address", address_);
 
         call->response_reader =
-            peers_.at(to)->AsyncSendCommit(&call->context, request, &cq_);
+            peers_.at(to)->AsyncSendCommit(&call->context, request, queue());
 
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        call->response_reader->Finish(
+            &call->reply, &call->status, call->tag());
       }
 
       void NetworkImpl::send_reject(model::Peer to, RejectMessage reject) {
@@ -78,14 +81,15 @@ namespace iroha {
                                 vote.signature.pubkey.size());
         }
 
-        auto call = new AsyncClientCall;
+        auto call = makeCall();
 
         call->context.AddMetadata("address", address_);
 
         call->response_reader =
-            peers_.at(to)->AsyncSendReject(&call->context, request, &cq_);
+            peers_.at(to)->AsyncSendReject(&call->context, request, queue());
 
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        call->response_reader->Finish(
+            &call->reply, &call->status, call->tag());
       }
 
       void NetworkImpl::send_vote(model::Peer to, VoteMessage vote) {
@@ -99,14 +103,15 @@ namespace iroha {
         signature->set_pubkey(vote.signature.pubkey.data(),
                               vote.signature.pubkey.size());
 
-        auto call = new AsyncClientCall;
+        auto call = makeCall();
 
         call->context.AddMetadata("address", address_);
 
         call->response_reader =
-            peers_.at(to)->AsyncSendVote(&call->context, request, &cq_);
+            peers_.at(to)->AsyncSendVote(&call->context, request, queue());
 
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        call->response_reader->Finish(
+            &call->reply, &call->status, call->tag());
       }
 
       grpc::Status NetworkImpl::SendVote(
@@ -22,6 +22,7 @@
 #include <thread>
 #include <unordered_map>
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/channel_registry.hpp"
 #include "consensus/yac/yac_network_interface.hpp"
 #include "yac.grpc.pb.h"
 
@@ -33,8 +34,10 @@ namespace iroha {
                           public proto::Yac::Service,
                           network::AsyncGrpcClient<google::protobuf::Empty> {
        public:
-        explicit NetworkImpl(const std::string &address,
-                             const std::vector<model::Peer> &peers);
+        NetworkImpl(const std::string &address,
+                    const std::vector<model::Peer> &peers,
+                    std::shared_ptr<network::ChannelRegistry> channels =
+                        network::ChannelRegistry::getDefault());
         void subscribe(
             std::shared_ptr<YacNetworkNotifications> handler) override;
         void send_commit(model::Peer to, CommitMessage commit) override;
@@ -15,6 +15,7 @@ limitations under the License.
 */
 
 #include "main/application.hpp"
+#include <algorithm>
 #include <synchronizer/impl/synchronizer_impl.hpp>
 #include <validation/impl/chain_validator_impl.hpp>
 #include <gmock/gmock.h>
@@ -45,12 +46,22 @@ using namespace iroha::consensus::yac;
 Irohad::Irohad(const std::string &block_store_dir,
                const std::string &redis_host, size_t redis_port,
                const std::string &pg_conn, size_t torii_port,
-               uint64_t peer_number)
+               uint64_t peer_number, size_t torii_queues,
+               size_t torii_threads, size_t query_workers,
+               iroha::ordering::BatchingBounds batching_bounds,
+               iroha::ordering::AdmissionLimits admission_limits,
+               const std::vector<std::string> &observed_validators)
     : block_store_dir_(block_store_dir),
       redis_host_(redis_host),
       redis_port_(redis_port),
       pg_conn_(pg_conn),
       torii_port_(torii_port),
+      torii_queues_(torii_queues),
+      torii_threads_(torii_threads),
+      query_workers_(std::max<size_t>(query_workers, 1)),
+      batching_bounds_(batching_bounds),
+      admission_limits_(admission_limits),
+      observed_validators_(observed_validators),
       storage(StorageImpl::create(block_store_dir, redis_host, redis_port,
                                   pg_conn)),
       peer_number_(peer_number) {
@@ -59,10 +70,16 @@ Irohad::Irohad(const std::string &block_store_dir,
 }
 
 Irohad::~Irohad() {
-  internal_server->Shutdown();
+  if (internal_server) {
+    internal_server->Shutdown();
+  }
   torii_server->shutdown();
-  internal_thread.join();
-  server_thread.join();
+  if (internal_thread.joinable()) {
+    internal_thread.join();
+  }
+  if (server_thread.joinable()) {
+    server_thread.join();
+  }
 }
 
 class MockBlockLoader : public iroha::network::BlockLoader {
@@ -84,8 +101,8 @@ class MockCryptoProvider : public ModelCryptoProvider {
 void Irohad::run() {
   loop = uvw::Loop::create();
 
-  torii_server =
-      std::make_unique<ServerRunner>("0.0.0.0:" + std::to_string(torii_port_));
+  torii_server = std::make_unique<ServerRunner>(
+      "0.0.0.0:" + std::to_string(torii_port_), torii_queues_, torii_threads_);
 
   // Protobuf converters
   auto pb_tx_factory = std::make_shared<PbTransactionFactory>();
@@ -115,14 +132,25 @@ void Irohad::run() {
   auto chain_validator = std::make_shared<ChainValidatorImpl>(crypto_verifier);
   log_->info("[Init] => validators");
 
-  auto orderer = std::make_shared<PeerOrdererImpl>(storage);
-  log_->info("[Init] => peer orderer");
-
+  // observer is not in the peer set, it follows blocks of validators
+  // and takes no part in ordering and consensus
+  auto observer = not observed_validators_.empty();
   auto wsv = std::make_shared<ametsuchi::PeerQueryWsv>(storage);
-  auto peer_address = wsv->getLedgerPeers().value().at(peer_number_).address;
+  std::string peer_address;
+  if (not observer) {
+    peer_address = wsv->getLedgerPeers().value().at(peer_number_).address;
+  }
 
   // Ordering gate
-  auto ordering_gate = ordering_init.initOrderingGate(wsv, loop, 10, 5000);
+  auto ordering_gate = observer
+      ? ordering_init.initObserverOrderingGate(wsv)
+      : ordering_init.initOrderingGate(
+            wsv,
+            peer_address,
+            loop,
+            batching_bounds_,
+            admission_limits_,
+            storage->getTopHeight());
   log_->info("[Init] => init ordering gate - [{}]",
               logger::logBool(ordering_gate));
 
@@ -131,10 +159,20 @@ void Irohad::run() {
                                    storage, hash_provider);
 
   // Consensus gate
-  auto consensus_gate = yac_init.initConsensusGate(peer_address,
-                                                   loop,
-                                                   orderer,
-                                                   simulator);
+  std::shared_ptr<ConsensusGate> consensus_gate;
+  if (observer) {
+    observer_gate = std::make_shared<iroha::consensus::ObserverGate>(
+        observed_validators_, storage);
+    consensus_gate = observer_gate;
+    log_->info("[Init] => observer of {} validators",
+               observed_validators_.size());
+  } else {
+    auto orderer = std::make_shared<PeerOrdererImpl>(storage);
+    log_->info("[Init] => peer orderer");
+
+    consensus_gate =
+        yac_init.initConsensusGate(peer_address, loop, orderer, simulator);
+  }
 
   // Block loader
   auto block_loader = std::make_shared<MockBlockLoader>();
@@ -150,41 +188,60 @@ void Irohad::run() {
     log_->info("~~~~~~~~~| PROPOSAL ^_^ |~~~~~~~~~ ");
   });
 
-  pcs->on_commit().subscribe([this](auto) {
+  pcs->on_commit().subscribe([this](auto commit) {
     log_->info("~~~~~~~~~| COMMIT =^._.^= |~~~~~~~~~ ");
+    commit.subscribe([this](const auto &block) {
+      if (ordering_init.ordering_service) {
+        ordering_init.ordering_service->onCommit(block.height);
+      }
+    });
   });
 
   // Torii:
   // --- Transactions:
-  auto tx_processor = createTransactionProcessor(pcs, stateless_validator);
+  auto tx_processor =
+      createTransactionProcessor(pcs, stateless_validator, simulator);
 
   command_service = createCommandService(pb_tx_factory, tx_processor);
 
   // --- Queries
-  auto query_proccessing_factory =
-      createQueryProcessingFactory(storage, storage);
+  auto query_proccessing_factories =
+      createQueryProcessingFactories(storage, pcs);
 
   auto query_processor = createQueryProcessor(
-      std::move(query_proccessing_factory), stateless_validator);
-
-  query_service = createQueryService(
-      pb_query_factory, pb_query_response_factory, query_processor);
-
-  grpc::ServerBuilder builder;
-  int port = 0;
-  builder.AddListeningPort(peer_address,
-                           grpc::InsecureServerCredentials(), &port);
-  builder.RegisterService(ordering_init.ordering_gate.get());
-  builder.RegisterService(ordering_init.ordering_service.get());
-  builder.RegisterService(yac_init.consensus_network.get());
-  internal_server = builder.BuildAndStart();
-  internal_thread = std::thread([this] { internal_server->Wait(); });
+      std::move(query_proccessing_factories), stateless_validator);
+
+  auto block_streamer = createBlockStreamer(storage, pcs);
+
+  query_service = createQueryService(pb_query_factory,
+                                     pb_query_response_factory,
+                                     query_processor,
+                                     block_streamer);
+
+  if (not observer) {
+    grpc::ServerBuilder builder;
+    int port = 0;
+    builder.AddListeningPort(peer_address,
+                             grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(ordering_init.ordering_gate.get());
+    builder.RegisterService(ordering_init.ordering_service.get());
+    builder.RegisterService(yac_init.consensus_network.get());
+    internal_server = builder.BuildAndStart();
+    internal_thread = std::thread([this] { internal_server->Wait(); });
+  }
   server_thread = std::thread([this] {
     torii_server->run(std::move(command_service), std::move(query_service));
   });
   log_->info("===> iroha initialized");
   torii_server->waitForServersReady();
-  loop->run();
+  if (observer) {
+    // commits are followed once all their subscribers are ready
+    observer_gate->start();
+    // no timers of ordering and consensus keep the loop running
+    server_thread.join();
+  } else {
+    loop->run();
+  }
 }
 
 std::shared_ptr<Simulator> Irohad::createSimulator(
@@ -224,22 +281,35 @@ std::unique_ptr<::torii::CommandService> Irohad::createCommandService(
 std::unique_ptr<::torii::QueryService> Irohad::createQueryService(
     std::shared_ptr<PbQueryFactory> pb_query_factory,
     std::shared_ptr<PbQueryResponseFactory> pb_query_response_factory,
-    std::shared_ptr<QueryProcessor> query_processor) {
-  return std::make_unique<::torii::QueryService>(
-      pb_query_factory, pb_query_response_factory, query_processor);
+    std::shared_ptr<QueryProcessor> query_processor,
+    std::shared_ptr<BlockStreamer> block_streamer) {
+  return std::make_unique<::torii::QueryService>(pb_query_factory,
+                                                 pb_query_response_factory,
+                                                 query_processor,
+                                                 block_streamer);
+}
+
+std::shared_ptr<BlockStreamer> Irohad::createBlockStreamer(
+    std::shared_ptr<BlockQuery> block_query,
+    std::shared_ptr<PeerCommunicationService> pcs) {
+  return std::make_shared<BlockStreamer>(block_query, pcs);
 }
 
 std::shared_ptr<QueryProcessor> Irohad::createQueryProcessor(
-    std::unique_ptr<QueryProcessingFactory> qpf,
+    std::vector<std::unique_ptr<QueryProcessingFactory>> qpfs,
     std::shared_ptr<StatelessValidator> stateless_validator) {
-  return std::make_shared<QueryProcessorImpl>(std::move(qpf),
-                                              stateless_validator);
+  auto workers = qpfs.size();
+  return std::make_shared<QueryProcessorImpl>(
+      std::move(qpfs), stateless_validator,
+      QueryProcessorImpl::defaultLimits(workers));
 }
 
 std::shared_ptr<TransactionProcessor> Irohad::createTransactionProcessor(
     std::shared_ptr<PeerCommunicationService> pcs,
-    std::shared_ptr<StatelessValidator> validator) {
-  return std::make_shared<TransactionProcessorImpl>(pcs, validator);
+    std::shared_ptr<StatelessValidator> validator,
+    std::shared_ptr<VerifiedProposalCreator> proposal_creator) {
+  return std::make_shared<TransactionProcessorImpl>(pcs, validator,
+                                                    proposal_creator);
 }
 
 std::shared_ptr<StatelessValidator> Irohad::createStatelessValidator(
@@ -247,8 +317,34 @@ std::shared_ptr<StatelessValidator> Irohad::createStatelessValidator(
   return std::make_shared<StatelessValidatorImpl>(crypto_provider);
 }
 
-std::unique_ptr<QueryProcessingFactory> Irohad::createQueryProcessingFactory(
-    std::shared_ptr<WsvQuery> wsvQuery,
-    std::shared_ptr<BlockQuery> blockQuery) {
-  return std::make_unique<QueryProcessingFactory>(wsvQuery, blockQuery);
+std::vector<std::unique_ptr<QueryProcessingFactory>>
+Irohad::createQueryProcessingFactories(
+    std::shared_ptr<Storage> storage,
+    std::shared_ptr<PeerCommunicationService> pcs) {
+  // workers share cached query results, they are evicted by committed blocks
+  auto cache = std::make_shared<QueryResultCache>(
+      size_t{QueryProcessingFactory::MAX_CACHED_RESULTS});
+  pcs->on_commit().subscribe([cache](Commit commit) {
+    commit.subscribe([cache](const Block &block) { cache->commit(block); });
+  });
+
+  // each worker reads world state view and history through its own
+  // connections, so queries neither wait for each other nor for commits
+  std::vector<std::unique_ptr<QueryProcessingFactory>> qpfs;
+  for (size_t i = 0; i < query_workers_; ++i) {
+    std::shared_ptr<WsvQuery> wsv = storage->createWsvQuery();
+    std::shared_ptr<BlockQuery> blocks = storage->createBlockQuery();
+    if (not wsv or not blocks) {
+      log_->error("Cannot connect query worker {} to PostgreSQL", i);
+      break;
+    }
+    qpfs.push_back(
+        std::make_unique<QueryProcessingFactory>(wsv, blocks, cache));
+  }
+  if (qpfs.empty()) {
+    log_->warn("Queries are executed with the storage connection");
+    qpfs.push_back(
+        std::make_unique<QueryProcessingFactory>(storage, storage, cache));
+  }
+  return qpfs;
 }
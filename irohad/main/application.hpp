@@ -25,6 +25,7 @@
 #include <ametsuchi/impl/storage_impl.hpp>
 #include <crypto/crypto.hpp>
 #include <uvw/loop.hpp>
+#include "consensus/observer/observer_gate.hpp"
 #include "network/consensus_gate.hpp"
 #include "network/block_loader.hpp"
 #include "synchronizer/synchronizer.hpp"
@@ -33,6 +34,7 @@
 #include "main/server_runner.hpp"
 #include "model/model_crypto_provider_impl.hpp"
 #include "torii/command_service.hpp"
+#include "torii/processor/block_streamer.hpp"
 
 #include "simulator/block_creator.hpp"
 #include "network/ordering_gate.hpp"
@@ -57,10 +59,22 @@ class Irohad {
    * @param pg_conn - initialization string for postgre
    * @param torii_port - port for torii binding
    * @param peer_number - number of peer in ledger // todo replace with pub key
+   * @param torii_queues - number of completion queues serving torii
+   * @param torii_threads - number of threads handling torii requests
+   * @param query_workers - number of threads executing queries, each has
+   * its own connection to PostgreSQL
+   * @param batching_bounds - limits of proposals made by ordering service
+   * @param admission_limits - limits of ordering service queue
+   * @param observed_validators - torii addresses of validators to follow,
+   * if not empty the peer runs as observer out of consensus
    */
   Irohad(const std::string &block_store_dir, const std::string &redis_host,
          size_t redis_port, const std::string &pg_conn, size_t torii_port,
-         uint64_t peer_number);
+         uint64_t peer_number, size_t torii_queues = 1,
+         size_t torii_threads = 1, size_t query_workers = 1,
+         iroha::ordering::BatchingBounds batching_bounds = {},
+         iroha::ordering::AdmissionLimits admission_limits = {},
+         const std::vector<std::string> &observed_validators = {});
   void run();
   ~Irohad();
 
@@ -93,32 +107,45 @@ class Irohad {
       pb_query_factory,
       std::shared_ptr<iroha::model::converters::PbQueryResponseFactory>
       pb_query_response_factory,
-      std::shared_ptr<iroha::torii::QueryProcessor> query_processor);
+      std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
+      std::shared_ptr<iroha::torii::BlockStreamer> block_streamer);
+
+  std::shared_ptr<iroha::torii::BlockStreamer> createBlockStreamer(
+      std::shared_ptr<iroha::ametsuchi::BlockQuery> block_query,
+      std::shared_ptr<iroha::network::PeerCommunicationService> pcs);
 
   std::shared_ptr<iroha::torii::QueryProcessor> createQueryProcessor(
-      std::unique_ptr<iroha::model::QueryProcessingFactory> qpf,
+      std::vector<std::unique_ptr<iroha::model::QueryProcessingFactory>> qpfs,
       std::shared_ptr<iroha::validation::StatelessValidator>
       stateless_validator);
 
   std::shared_ptr<iroha::torii::TransactionProcessor>
   createTransactionProcessor(
       std::shared_ptr<iroha::network::PeerCommunicationService> pcs,
-      std::shared_ptr<iroha::validation::StatelessValidator> validator);
+      std::shared_ptr<iroha::validation::StatelessValidator> validator,
+      std::shared_ptr<iroha::simulator::VerifiedProposalCreator>
+          proposal_creator);
 
   std::shared_ptr<iroha::validation::StatelessValidator>
   createStatelessValidator(
       std::shared_ptr<iroha::model::ModelCryptoProvider> crypto_provider);
 
-  std::unique_ptr<iroha::model::QueryProcessingFactory>
-  createQueryProcessingFactory(
-      std::shared_ptr<iroha::ametsuchi::WsvQuery> wsvQuery,
-      std::shared_ptr<iroha::ametsuchi::BlockQuery> blockQuery);
+  std::vector<std::unique_ptr<iroha::model::QueryProcessingFactory>>
+  createQueryProcessingFactories(
+      std::shared_ptr<iroha::ametsuchi::Storage> storage,
+      std::shared_ptr<iroha::network::PeerCommunicationService> pcs);
 
   std::string block_store_dir_;
   std::string redis_host_;
   size_t redis_port_;
   std::string pg_conn_;
   size_t torii_port_;
+  size_t torii_queues_;
+  size_t torii_threads_;
+  size_t query_workers_;
+  iroha::ordering::BatchingBounds batching_bounds_;
+  iroha::ordering::AdmissionLimits admission_limits_;
+  std::vector<std::string> observed_validators_;
   std::shared_ptr<uvw::Loop> loop;
 
   std::unique_ptr<::torii::CommandService> command_service;
@@ -128,6 +155,7 @@ class Irohad {
   std::unique_ptr<grpc::Server> internal_server;
   iroha::network::OrderingInit ordering_init;
   iroha::consensus::yac::YacInit yac_init;
+  std::shared_ptr<iroha::consensus::ObserverGate> observer_gate;
 
   std::thread internal_thread, server_thread;
 
@@ -25,8 +25,9 @@ namespace iroha {
 
     auto ms = mutable_factory_.createMutableStorage();
 
-    auto result = ms->apply(block, [](const auto &blk, auto &executor,
-                                      auto &query, const auto &top_hash) {
+    // genesis block is applied to empty ledger, so it is loaded in bulk
+    auto result = ms->applyBulk({block}, [](const auto &blk, auto &executor,
+                                            auto &query) {
       for (const auto &tx : blk.transactions) {
         for (const auto &command : tx.commands) {
           auto valid = command->execute(query, executor);
@@ -39,7 +40,7 @@ namespace iroha {
     });
 
     if (result) {
-      mutable_factory_.commit(std::move(ms));
+      result = mutable_factory_.commit(std::move(ms));
     }
 
     return result;
@@ -19,28 +19,47 @@
 
 namespace iroha {
   namespace network {
-    auto OrderingInit::createGate(std::string network_address) {
-      return std::make_shared<ordering::OrderingGateImpl>(network_address);
+    auto OrderingInit::createGate(std::string network_address,
+                                  std::string own_address) {
+      return std::make_shared<ordering::OrderingGateImpl>(
+          network_address,
+          ChannelRegistry::getDefault(),
+          500,
+          std::chrono::microseconds(2000),
+          own_address);
     }
 
-    auto OrderingInit::createService(std::shared_ptr<ametsuchi::PeerQuery> wsv,
-                                     size_t max_size,
-                                     size_t delay_milliseconds,
-                                     std::shared_ptr<uvw::Loop> loop) {
+    auto OrderingInit::createService(
+        std::shared_ptr<ametsuchi::PeerQuery> wsv,
+        std::shared_ptr<ordering::BatchingPolicy> policy,
+        std::shared_ptr<uvw::Loop> loop,
+        ordering::AdmissionLimits limits,
+        size_t ledger_height) {
 
-      return std::make_shared<ordering::OrderingServiceImpl>(wsv,
-                                                             max_size,
-                                                             delay_milliseconds,
-                                                             loop);
+      return std::make_shared<ordering::OrderingServiceImpl>(
+          wsv, policy, loop, ChannelRegistry::getDefault(), limits,
+          ledger_height);
     }
 
     std::shared_ptr<ordering::OrderingGateImpl> OrderingInit::initOrderingGate(
         std::shared_ptr<ametsuchi::PeerQuery> wsv,
+        const std::string &own_address,
         std::shared_ptr<uvw::Loop> loop,
-        size_t max_size,
-        size_t delay_milliseconds) {
-      ordering_service =
-          createService(wsv, max_size, delay_milliseconds, loop);
+        ordering::BatchingBounds bounds,
+        ordering::AdmissionLimits limits,
+        size_t ledger_height) {
+      batching_policy =
+          std::make_shared<ordering::AdaptiveBatchingPolicy>(bounds);
+      ordering_service = createService(
+          wsv, batching_policy, loop, limits, ledger_height);
+      ordering_gate = createGate(
+          wsv->getLedgerPeers().value().front().address, own_address);
+      return ordering_gate;
+    }
+
+    std::shared_ptr<ordering::OrderingGateImpl>
+    OrderingInit::initObserverOrderingGate(
+        std::shared_ptr<ametsuchi::PeerQuery> wsv) {
       ordering_gate = createGate(wsv->getLedgerPeers().value().front().address);
       return ordering_gate;
     }
@@ -19,6 +19,7 @@
 #define IROHA_ORDERING_INIT_HPP
 
 #include <uvw.hpp>
+#include "ordering/impl/adaptive_batching_policy.hpp"
 #include "ordering/impl/ordering_gate_impl.hpp"
 #include "ordering/impl/ordering_service_impl.hpp"
 #include "ametsuchi/peer_query.hpp"
@@ -35,37 +36,56 @@ namespace iroha {
       /**
        * Init effective realisation of ordering gate (client of ordering service)
        * @param network_address - address of ordering service
+       * @param own_address - address of this peer, empty for observer
        */
-      auto createGate(std::string network_address);
+      auto createGate(std::string network_address,
+                      std::string own_address = "");
 
       /**
        * Init ordering service
        * @param peers - endpoints of peers for connection
-       * @param max_size - limitation of proposal size
-       * @param delay_milliseconds - delay before emitting proposal
+       * @param policy - policy of batching transactions into proposals
        * @param loop - handler of async events
+       * @param limits - limits of ordering queue
+       * @param ledger_height - height of top block in ledger
        */
       auto createService(std::shared_ptr<ametsuchi::PeerQuery> wsv,
-                         size_t max_size,
-                         size_t delay_milliseconds,
-                         std::shared_ptr<uvw::Loop> loop);
+                         std::shared_ptr<ordering::BatchingPolicy> policy,
+                         std::shared_ptr<uvw::Loop> loop,
+                         ordering::AdmissionLimits limits,
+                         size_t ledger_height);
 
      public:
 
       /**
        * Initialization of ordering gate(client) and ordering service (service)
        * @param peers - endpoints of peers for connection
+       * @param own_address - address of this peer
        * @param loop - handler of async events
-       * @param max_size - limitation of proposal size
-       * @param delay_milliseconds - delay before emitting proposal
+       * @param bounds - limitations of proposal
+       * @param limits - limits of ordering queue
+       * @param ledger_height - height of top block in ledger, proposals
+       * start above it
        * @return effective realisation of OrderingGate
        */
       std::shared_ptr<ordering::OrderingGateImpl> initOrderingGate(
           std::shared_ptr<ametsuchi::PeerQuery> wsv,
+          const std::string &own_address,
           std::shared_ptr<uvw::Loop> loop,
-          size_t max_size,
-          size_t delay_milliseconds);
+          ordering::BatchingBounds bounds,
+          ordering::AdmissionLimits limits,
+          size_t ledger_height);
 
+      /**
+       * Initialization of ordering gate of observer peer, it forwards
+       * transactions to ordering service and runs no service of its own
+       * @param wsv - provides ledger peers, the first one orders transactions
+       * @return effective realisation of OrderingGate
+       */
+      std::shared_ptr<ordering::OrderingGateImpl> initObserverOrderingGate(
+          std::shared_ptr<ametsuchi::PeerQuery> wsv);
+
+      std::shared_ptr<ordering::AdaptiveBatchingPolicy> batching_policy;
       std::shared_ptr<ordering::OrderingServiceImpl> ordering_service;
       std::shared_ptr<ordering::OrderingGateImpl> ordering_gate;
 
@@ -54,9 +54,33 @@ namespace iroha {
                          return true;
                        });
       }
-      factory_->commit(std::move(storage));
+      if (not factory_->commit(std::move(storage))) {
+        log_->error("Blocks are not committed");
+      }
     };
 
+    bool BlockInserter::bulkApplyToLedger(std::vector<model::Block> blocks) {
+      auto storage = factory_->createMutableStorage();
+      auto result = storage->applyBulk(
+          blocks,
+          [this](const auto &current_block, auto &executor, auto &query) {
+            for (const auto &tx : current_block.transactions) {
+              for (const auto &command : tx.commands) {
+                if (not command->execute(query, executor)) {
+                  log_->error("Command of block {} failed",
+                              current_block.height);
+                  return false;
+                }
+              }
+            }
+            return true;
+          });
+      if (result) {
+        result = factory_->commit(std::move(storage));
+      }
+      return result;
+    }
+
     nonstd::optional<std::string> BlockInserter::loadFile(std::string path) {
       std::ifstream file(path);
       std::string str((std::istreambuf_iterator<char>(file)),
@@ -16,7 +16,9 @@ limitations under the License.
 
 #include <gflags/gflags.h>
 #include <grpc++/grpc++.h>
+#include <algorithm>
 #include <fstream>
+#include <sstream>
 #include <thread>
 #include "common/config.hpp"
 #include "main/application.hpp"
@@ -41,6 +43,56 @@ DEFINE_validator(genesis_block, &validate_genesis_path);
 
 DEFINE_uint64(peer_number, 0, "Specify peer number");
 
+DEFINE_bool(bulk_genesis, false, "Load genesis block in bulk");
+
+DEFINE_uint64(torii_queues, 2, "Specify number of torii completion queues");
+
+DEFINE_uint64(torii_threads,
+              std::max(2u, std::thread::hardware_concurrency()),
+              "Specify number of torii worker threads");
+
+DEFINE_uint64(query_workers, 2,
+              "Specify number of threads executing queries, each of them "
+              "has its own connection to PostgreSQL");
+
+DEFINE_uint64(proposal_max_txs, 10000,
+              "Specify maximum number of transactions in proposal");
+
+DEFINE_uint64(proposal_max_bytes, 3 * 1024 * 1024,
+              "Specify maximum size of transactions in proposal in bytes");
+
+DEFINE_uint64(proposal_max_wait, 5000,
+              "Specify maximum time in milliseconds a transaction waits "
+              "for proposal");
+
+DEFINE_uint64(ordering_queue_max_txs, 100000,
+              "Specify maximum number of transactions waiting in ordering "
+              "queue, further ones are rejected as overload");
+
+DEFINE_uint64(ordering_queue_max_bytes, 256 * 1024 * 1024,
+              "Specify maximum size of transactions waiting in ordering "
+              "queue in bytes");
+
+DEFINE_string(observe, "",
+              "Specify comma-separated torii addresses of validators to "
+              "follow, peer runs as observer out of consensus then");
+
+/**
+ * @param list - comma-separated values
+ * @return non-empty values of the list
+ */
+std::vector<std::string> split_list(const std::string &list) {
+  std::vector<std::string> values;
+  std::stringstream stream(list);
+  std::string value;
+  while (std::getline(stream, value, ',')) {
+    if (not value.empty()) {
+      values.push_back(value);
+    }
+  }
+  return values;
+}
+
 int main(int argc, char *argv[]) {
   auto log = logger::log("MAIN");
   log->info("start");
@@ -51,11 +103,22 @@ int main(int argc, char *argv[]) {
 
   auto config = parse_iroha_config(FLAGS_config);
   log->info("config initialized");
+  iroha::ordering::BatchingBounds batching_bounds;
+  batching_bounds.max_txs = FLAGS_proposal_max_txs;
+  batching_bounds.max_bytes = FLAGS_proposal_max_bytes;
+  batching_bounds.max_wait =
+      std::chrono::milliseconds(FLAGS_proposal_max_wait);
+  iroha::ordering::AdmissionLimits admission_limits;
+  admission_limits.max_txs = FLAGS_ordering_queue_max_txs;
+  admission_limits.max_bytes = FLAGS_ordering_queue_max_bytes;
   Irohad irohad(config[mbr::BlockStorePath].GetString(),
                 config[mbr::RedisHost].GetString(),
                 config[mbr::RedisPort].GetUint(),
                 config[mbr::PgOpt].GetString(),
-                config[mbr::ToriiPort].GetUint(), FLAGS_peer_number);
+                config[mbr::ToriiPort].GetUint(), FLAGS_peer_number,
+                FLAGS_torii_queues, FLAGS_torii_threads,
+                FLAGS_query_workers, batching_bounds, admission_limits,
+                split_list(FLAGS_observe));
   log->info("storage initialized: {}", logger::logBool(irohad.storage));
 
   iroha::main::BlockInserter inserter(irohad.storage);
@@ -63,7 +126,14 @@ int main(int argc, char *argv[]) {
   auto block = inserter.parseBlock(file.value());
   log->info("Block is parsed");
 
-  if (block.has_value()) {
+  if (block.has_value() and FLAGS_bulk_genesis) {
+    if (not inserter.bulkApplyToLedger({block.value()})) {
+      log->error("Genesis block is not inserted");
+      return 1;
+    }
+    log->info("Genesis block inserted in bulk, number of transactions: {}",
+              block.value().transactions.size());
+  } else if (block.has_value()) {
     inserter.applyToLedger({block.value()});
     log->info("Genesis block inserted, number of transactions: {}",
                block.value().transactions.size());
@@ -52,6 +52,15 @@ namespace iroha {
        */
       void applyToLedger(std::vector<model::Block> blocks);
 
+      /**
+       * Apply blocks to empty ledger in bulk.
+       * All commands are checked first, then resulting state is written
+       * at once.
+       * @param blocks - list of blocks for insertion
+       * @return true if blocks are inserted, false otherwise
+       */
+      bool bulkApplyToLedger(std::vector<model::Block> blocks);
+
       /**
        * Additional method
        * Loading file from target path
@@ -20,8 +20,10 @@ limitations under the License.
 #include <logger/logger.hpp>
 #include <main/server_runner.hpp>
 
-ServerRunner::ServerRunner(const std::string &address)
-    : serverAddress_(address) {}
+ServerRunner::ServerRunner(const std::string &address,
+                           size_t queues,
+                           size_t threads)
+    : serverAddress_(address), queues_(queues), threads_(threads) {}
 
 ServerRunner::~ServerRunner() { toriiServiceHandler_->shutdown(); }
 
@@ -32,7 +34,8 @@ void ServerRunner::run(std::unique_ptr<torii::CommandService> command_service,
   builder.AddListeningPort(serverAddress_, grpc::InsecureServerCredentials());
 
   // Register services.
-  toriiServiceHandler_ = std::make_unique<torii::ToriiServiceHandler>(builder);
+  toriiServiceHandler_ = std::make_unique<torii::ToriiServiceHandler>(
+      builder, queues_, threads_);
   toriiServiceHandler_->assignCommandHandler(std::move(command_service));
   toriiServiceHandler_->assignQueryHandler(std::move(query_service));
 
@@ -44,12 +47,14 @@ void ServerRunner::run(std::unique_ptr<torii::CommandService> command_service,
 }
 
 void ServerRunner::shutdown() {
-  serverInstance_->Shutdown();
+  // streaming calls are cancelled if not finished in time
+  serverInstance_->Shutdown(std::chrono::system_clock::now()
+                            + std::chrono::seconds(1));
+  toriiServiceHandler_->shutdown();
 
   while (not toriiServiceHandler_->isShutdownCompletionQueue()) {
-    usleep(1);  // wait for shutting down completion queue
+    usleep(1);  // wait for draining completion queues
   }
-  toriiServiceHandler_->shutdown();
 }
 
 void ServerRunner::waitForServersReady() {
@@ -28,7 +28,14 @@ namespace torii {
 
 class ServerRunner {
  public:
-  explicit ServerRunner(const std::string &address);
+  /**
+   * @param address - address to bind torii to
+   * @param queues - number of completion queues serving rpcs
+   * @param threads - number of worker threads draining the queues
+   */
+  explicit ServerRunner(const std::string &address,
+                        size_t queues = 1,
+                        size_t threads = 1);
   ~ServerRunner();
   void run(std::unique_ptr<torii::CommandService> commandService,
            std::unique_ptr<torii::QueryService> queryService);
@@ -41,6 +48,8 @@ class ServerRunner {
   std::condition_variable serverInstanceCV_;
 
   std::string serverAddress_;
+  size_t queues_;
+  size_t threads_;
   std::unique_ptr<torii::ToriiServiceHandler> toriiServiceHandler_;
 };
 
@@ -16,6 +16,7 @@
  */
 
 #include "model/converters/json_query_factory.hpp"
+#include "common/types.hpp"
 #include <algorithm>
 
 namespace iroha {
@@ -34,6 +35,8 @@ namespace iroha {
             &JsonQueryFactory::deserializeGetAccountTransactions;
         deserializers_["GetAccountSignatories"] =
             &JsonQueryFactory::deserializeGetSignatories;
+        deserializers_["GetAssetHolders"] =
+            &JsonQueryFactory::deserializeGetAssetHolders;
       }
 
       nonstd::optional<iroha::protocol::Query> JsonQueryFactory::deserialize(
@@ -131,6 +134,16 @@ namespace iroha {
             pb_query.mutable_get_account_transactions();
         pb_get_account_transactions->set_account_id(
             obj_query["account_id"].GetString());
+        // paging parameters are optional
+        if (obj_query.HasMember("after_tx_hash")) {
+          auto after_hash = hex2bytes(obj_query["after_tx_hash"].GetString());
+          pb_get_account_transactions->set_after_tx_hash(after_hash.data(),
+                                                         after_hash.size());
+        }
+        if (obj_query.HasMember("page_size")) {
+          pb_get_account_transactions->set_page_size(
+              obj_query["page_size"].GetUint());
+        }
 
         return true;
       }
@@ -157,15 +170,48 @@ namespace iroha {
       bool JsonQueryFactory::deserializeGetAccountAssets(
           rapidjson::GenericValue<rapidjson::UTF8<char>>::Object &obj_query,
           protocol::Query &pb_query) {
-        if (not(obj_query.HasMember("account_id") &&
-                obj_query.HasMember("asset_id"))) {
-          log_->error("No account, asset id in json");
+        if (not obj_query.HasMember("account_id")) {
+          log_->error("No account id in json");
           return false;
         }
         auto pb_get_account_assets = pb_query.mutable_get_account_assets();
         pb_get_account_assets->set_account_id(
             obj_query["account_id"].GetString());
-        pb_get_account_assets->set_asset_id(obj_query["asset_id"].GetString());
+        // asset id is optional, all assets of account are requested without it
+        if (obj_query.HasMember("asset_id")) {
+          pb_get_account_assets->set_asset_id(
+              obj_query["asset_id"].GetString());
+        }
+
+        return true;
+      }
+
+      bool JsonQueryFactory::deserializeGetAssetHolders(
+          rapidjson::GenericValue<rapidjson::UTF8<char>>::Object &obj_query,
+          protocol::Query &pb_query) {
+        if (not obj_query.HasMember("asset_id")) {
+          log_->error("No asset id in json");
+          return false;
+        }
+        auto pb_get_asset_holders = pb_query.mutable_get_asset_holders();
+        pb_get_asset_holders->set_asset_id(obj_query["asset_id"].GetString());
+        // paging parameters are optional
+        if (obj_query.HasMember("after_account_id")) {
+          pb_get_asset_holders->set_after_account_id(
+              obj_query["after_account_id"].GetString());
+        }
+        if (obj_query.HasMember("after_balance")) {
+          pb_get_asset_holders->set_after_balance(
+              obj_query["after_balance"].GetUint64());
+        }
+        if (obj_query.HasMember("page_size")) {
+          pb_get_asset_holders->set_page_size(
+              obj_query["page_size"].GetUint());
+        }
+        if (obj_query.HasMember("order_by_balance")) {
+          pb_get_asset_holders->set_order_by_balance(
+              obj_query["order_by_balance"].GetBool());
+        }
 
         return true;
       }
@@ -19,6 +19,7 @@
 #include "model/converters/pb_query_factory.hpp"
 #include "model/queries/get_account.hpp"
 #include "model/queries/get_account_assets.hpp"
+#include "model/queries/get_asset_holders.hpp"
 #include "model/queries/get_signatories.hpp"
 #include "model/queries/get_transactions.hpp"
 
@@ -59,8 +60,32 @@ namespace iroha {
           auto pb_cast = pb_query.get_account_transactions();
           auto query = GetAccountTransactions();
           query.account_id = pb_cast.account_id();
+          if (not pb_cast.after_tx_hash().empty()) {
+            if (pb_cast.after_tx_hash().size() != hash256_t::size()) {
+              // malformed cursor
+              return nullptr;
+            }
+            hash256_t after_hash;
+            std::copy(pb_cast.after_tx_hash().begin(),
+                      pb_cast.after_tx_hash().end(),
+                      after_hash.begin());
+            query.after_hash = after_hash;
+          }
+          query.page_size = pb_cast.page_size();
           val = std::make_shared<model::GetAccountTransactions>(query);
         }
+
+        if (pb_query.has_get_asset_holders()) {
+          // Convert to get Asset Holders
+          auto pb_cast = pb_query.get_asset_holders();
+          auto query = GetAssetHolders();
+          query.asset_id = pb_cast.asset_id();
+          query.after_account_id = pb_cast.after_account_id();
+          query.after_balance = pb_cast.after_balance();
+          query.page_size = pb_cast.page_size();
+          query.order_by_balance = pb_cast.order_by_balance();
+          val = std::make_shared<model::GetAssetHolders>(query);
+        }
         if (!val) {
           // Query not implemented
           return nullptr;
@@ -80,6 +105,39 @@ namespace iroha {
         val->query_hash = hashProvider.get_hash(val);
         return val;
       }
+
+      std::shared_ptr<model::QueryBatch> PbQueryFactory::deserialize(
+          const protocol::QueryBatch &pb_batch) {
+        auto batch = std::make_shared<model::QueryBatch>();
+        Signature sign;
+        auto pb_sign = pb_batch.header().signature();
+        std::copy(pb_sign.pubkey().begin(), pb_sign.pubkey().end(),
+                  sign.pubkey.begin());
+        std::copy(pb_sign.signature().begin(), pb_sign.signature().end(),
+                  sign.signature.begin());
+        batch->query_counter = pb_batch.query_counter();
+        batch->signature = sign;
+        batch->created_ts = pb_batch.header().created_time();
+        batch->creator_account_id = pb_batch.creator_account_id();
+
+        model::HashProviderImpl hashProvider;
+        for (const auto &pb_query : pb_batch.queries()) {
+          auto query = deserialize(pb_query);
+          if (not query) {
+            // Query not implemented
+            return nullptr;
+          }
+          // queries are authorized by the signature of the batch
+          query->query_counter = batch->query_counter;
+          query->signature = batch->signature;
+          query->created_ts = batch->created_ts;
+          query->creator_account_id = batch->creator_account_id;
+          query->query_hash = hashProvider.get_hash(query);
+          batch->queries.push_back(query);
+        }
+        batch->query_hash = hashProvider.get_hash(batch);
+        return batch;
+      }
     }
   }
 }
@@ -38,6 +38,20 @@ namespace iroha {
               serializeAccountAssetResponse(
                   static_cast<model::AccountAssetResponse &>(*query_response)));
         }
+        if (instanceof <model::AccountAssetsResponse>(*query_response)) {
+          response = nonstd::make_optional<protocol::QueryResponse>();
+          response->mutable_account_assets_response()->CopyFrom(
+              serializeAccountAssetsResponse(
+                  static_cast<model::AccountAssetsResponse &>(
+                      *query_response)));
+        }
+        if (instanceof <model::AssetHoldersResponse>(*query_response)) {
+          response = nonstd::make_optional<protocol::QueryResponse>();
+          response->mutable_asset_holders_response()->CopyFrom(
+              serializeAssetHoldersResponse(
+                  static_cast<model::AssetHoldersResponse &>(
+                      *query_response)));
+        }
         if (instanceof <model::AccountResponse>(*query_response)) {
           response = nonstd::make_optional<protocol::QueryResponse>();
           response->mutable_account_response()->CopyFrom(
@@ -174,6 +188,52 @@ namespace iroha {
         return res;
       }
 
+      protocol::AccountAssetResponse
+      PbQueryResponseFactory::serializeAccountAssetsResponse(
+          const model::AccountAssetsResponse &accountAssetsResponse) const {
+        protocol::AccountAssetResponse pb_response;
+        for (const auto &account_asset : accountAssetsResponse.acct_assets) {
+          pb_response.add_account_assets()->CopyFrom(
+              serializeAccountAsset(account_asset));
+        }
+        return pb_response;
+      }
+
+      model::AccountAssetsResponse
+      PbQueryResponseFactory::deserializeAccountAssetsResponse(
+          const protocol::AccountAssetResponse &account_assets_response) const {
+        model::AccountAssetsResponse res;
+        for (const auto &account_asset :
+             account_assets_response.account_assets()) {
+          res.acct_assets.push_back(deserializeAccountAsset(account_asset));
+        }
+        return res;
+      }
+
+      protocol::AssetHoldersResponse
+      PbQueryResponseFactory::serializeAssetHoldersResponse(
+          const model::AssetHoldersResponse &assetHoldersResponse) const {
+        protocol::AssetHoldersResponse pb_response;
+        for (const auto &holder : assetHoldersResponse.holders) {
+          pb_response.add_holders()->CopyFrom(serializeAccountAsset(holder));
+        }
+        pb_response.set_next_account_id(assetHoldersResponse.next_account_id);
+        pb_response.set_next_balance(assetHoldersResponse.next_balance);
+        return pb_response;
+      }
+
+      model::AssetHoldersResponse
+      PbQueryResponseFactory::deserializeAssetHoldersResponse(
+          const protocol::AssetHoldersResponse &asset_holders_response) const {
+        model::AssetHoldersResponse res;
+        for (const auto &holder : asset_holders_response.holders()) {
+          res.holders.push_back(deserializeAccountAsset(holder));
+        }
+        res.next_account_id = asset_holders_response.next_account_id();
+        res.next_balance = asset_holders_response.next_balance();
+        return res;
+      }
+
       protocol::SignatoriesResponse
       PbQueryResponseFactory::serializeSignatoriesResponse(
           const model::SignatoriesResponse &signatoriesResponse) const {
@@ -203,16 +263,22 @@ namespace iroha {
         PbTransactionFactory pb_transaction_factory;
 
         // converting observable to the vector using reduce
-        return transactionsResponse.transactions
-            .reduce(protocol::TransactionsResponse(),
-                    [&pb_transaction_factory](auto &&response, auto tx) {
-                      response.add_transactions()->CopyFrom(
-                          pb_transaction_factory.serialize(tx));
-                      return response;
-                    },
-                    [](auto &&response) { return response; })
-            .as_blocking()  // we need to wait when on_complete happens
-            .first();
+        auto pb_response =
+            transactionsResponse.transactions
+                .reduce(protocol::TransactionsResponse(),
+                        [&pb_transaction_factory](auto &&response, auto tx) {
+                          response.add_transactions()->CopyFrom(
+                              pb_transaction_factory.serialize(tx));
+                          return response;
+                        },
+                        [](auto &&response) { return response; })
+                .as_blocking()  // we need to wait when on_complete happens
+                .first();
+        if (transactionsResponse.next_tx_hash.has_value()) {
+          pb_response.set_next_tx_hash(
+              transactionsResponse.next_tx_hash.value().to_string());
+        }
+        return pb_response;
       }
 
       protocol::ErrorResponse PbQueryResponseFactory::serializeErrorResponse(
@@ -237,6 +303,40 @@ namespace iroha {
           case ErrorResponse::NOT_SUPPORTED:
             pb_response.set_reason(protocol::ErrorResponse::NOT_SUPPORTED);
             break;
+          case ErrorResponse::WRONG_FORMAT:
+            pb_response.set_reason(protocol::ErrorResponse::WRONG_FORMAT);
+            break;
+          case ErrorResponse::OVERLOADED:
+            pb_response.set_reason(protocol::ErrorResponse::OVERLOADED);
+            break;
+          case ErrorResponse::DEADLINE_EXCEEDED:
+            pb_response.set_reason(
+                protocol::ErrorResponse::DEADLINE_EXCEEDED);
+            break;
+        }
+        return pb_response;
+      }
+
+      protocol::QueryBatchResponse PbQueryResponseFactory::serializeBatch(
+          const std::shared_ptr<QueryResponse> query_response) const {
+        protocol::QueryBatchResponse pb_response;
+        if (instanceof <model::ErrorResponse>(*query_response)) {
+          pb_response.mutable_error_response()->CopyFrom(
+              serializeErrorResponse(
+                  static_cast<model::ErrorResponse &>(*query_response)));
+        }
+        if (instanceof <model::QueryBatchResponse>(*query_response)) {
+          const auto &batch_response =
+              static_cast<model::QueryBatchResponse &>(*query_response);
+          for (const auto &response : batch_response.responses) {
+            auto pb_query_response = serialize(response);
+            if (pb_query_response) {
+              pb_response.add_responses()->CopyFrom(*pb_query_response);
+            } else {
+              // keep position of the response to the query
+              pb_response.add_responses();
+            }
+          }
         }
         return pb_response;
       }
@@ -72,6 +72,10 @@ namespace iroha {
         bool deserializeGetAccountAssets(
             GenericValue<UTF8<char>>::Object &obj_query,
             iroha::protocol::Query &pb_query);
+
+        bool deserializeGetAssetHolders(
+            GenericValue<UTF8<char>>::Object &obj_query,
+            iroha::protocol::Query &pb_query);
         // Logger
         std::shared_ptr<spdlog::logger> log_;
 
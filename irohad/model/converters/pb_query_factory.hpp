@@ -17,6 +17,7 @@
 #ifndef IROHA_PB_QUERY_FACTORY_HPP
 #define IROHA_PB_QUERY_FACTORY_HPP
 
+#include "model/queries/query_batch.hpp"
 #include "model/query.hpp"
 #include "queries.pb.h"
 
@@ -37,6 +38,15 @@ namespace iroha {
          */
         std::shared_ptr<model::Query> deserialize(const protocol::Query &pb_query);
 
+        /**
+         * Convert proto query batch to model query batch.
+         * Header, creator and counter of the batch are set to its queries
+         * @param pb_batch - reference to proto query batch
+         * @return model QueryBatch, nullptr if any query is not supported
+         */
+        std::shared_ptr<model::QueryBatch> deserialize(
+            const protocol::QueryBatch &pb_batch);
+
 
       };
 
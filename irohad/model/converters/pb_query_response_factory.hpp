@@ -22,8 +22,10 @@
 #include <model/account_asset.hpp>
 #include <model/queries/responses/account_assets_response.hpp>
 #include <model/queries/responses/account_response.hpp>
+#include <model/queries/responses/asset_holders_response.hpp>
 #include <nonstd/optional.hpp>
 #include "model/queries/responses/error_response.hpp"
+#include "model/queries/responses/query_batch_response.hpp"
 #include "model/queries/responses/signatories_response.hpp"
 #include "model/queries/responses/transactions_response.hpp"
 
@@ -58,6 +60,17 @@ namespace iroha {
         model::AccountAssetResponse deserializeAccountAssetResponse(
             const protocol::AccountAssetResponse &account_asset_response) const;
 
+        protocol::AccountAssetResponse serializeAccountAssetsResponse(
+            const model::AccountAssetsResponse &accountAssetsResponse) const;
+        model::AccountAssetsResponse deserializeAccountAssetsResponse(
+            const protocol::AccountAssetResponse &account_assets_response)
+            const;
+
+        protocol::AssetHoldersResponse serializeAssetHoldersResponse(
+            const model::AssetHoldersResponse &assetHoldersResponse) const;
+        model::AssetHoldersResponse deserializeAssetHoldersResponse(
+            const protocol::AssetHoldersResponse &asset_holders_response) const;
+
         protocol::SignatoriesResponse serializeSignatoriesResponse(
             const model::SignatoriesResponse &signatoriesResponse) const;
         model::SignatoriesResponse deserializeSignatoriesResponse(
@@ -70,6 +83,13 @@ namespace iroha {
 
         protocol::ErrorResponse serializeErrorResponse(
             const model::ErrorResponse &errorResponse) const;
+
+        /**
+         * Convert response to query batch, error response rejecting the
+         * whole batch is set as error of the batch
+         */
+        protocol::QueryBatchResponse serializeBatch(
+            const std::shared_ptr<QueryResponse> query_response) const;
       };
     }
   }
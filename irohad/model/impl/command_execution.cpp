@@ -36,6 +36,9 @@ namespace iroha {
 
     bool AddAssetQuantity::execute(ametsuchi::WsvQuery &queries,
                                    ametsuchi::WsvCommand &commands) {
+      // precision is needed to scale the amount before storage checks the
+      // balance; in stateful validation asset comes from prefetched keys,
+      // only applying of block reads it separately
       auto asset = queries.getAsset(asset_id);
       if (!asset)
         // No such asset
@@ -43,29 +46,10 @@ namespace iroha {
       auto precision = asset.value().precision;
       // Amount is wrongly formed
       if (amount.get_frac_number() > precision) return false;
-      if (!queries.getAccount(account_id))
-        // No such account
-        return false;
-      auto account_asset = queries.getAccountAsset(account_id, asset_id);
-      AccountAsset accountAsset;
-      // Such accountAsset not found
-      if (!account_asset) {
-        // No wallet found -> create new
-        accountAsset = AccountAsset();
-        accountAsset.asset_id = asset_id;
-        accountAsset.account_id = account_id;
-        accountAsset.balance = amount.get_joint_amount(precision);
-      } else {
-        accountAsset = account_asset.value();
-        // TODO: handle non trivial arithmetic
-        auto new_balance =
-            account_asset.value().balance + amount.get_joint_amount(precision);
-        // TODO: handle overflow
-        accountAsset.balance = new_balance;
-      }
-
-      // accountAsset.value().balance += amount;
-      return commands.upsertAccountAsset(accountAsset);
+      // Balance is updated in storage, which creates new wallet if needed and
+      // fails on overflow or when there is no such account
+      return commands.addAccountAssetBalance(
+          account_id, asset_id, amount.get_joint_amount(precision));
     }
 
     bool AddPeer::execute(ametsuchi::WsvQuery &queries,
@@ -156,16 +140,8 @@ namespace iroha {
 
     bool TransferAsset::execute(ametsuchi::WsvQuery &queries,
                                 ametsuchi::WsvCommand &commands) {
-      auto src_account_asset =
-          queries.getAccountAsset(src_account_id, asset_id);
-      if (!src_account_asset) {
-        // There is no src AccountAsset
-        return false;
-      }
-
-      AccountAsset dest_AccountAsset;
-      auto dest_account_asset =
-          queries.getAccountAsset(dest_account_id, asset_id);
+      // precision is read first as in AddAssetQuantity, reason of failed
+      // transfer is reported by storage to the log only
       auto asset = queries.getAsset(asset_id);
       if (!asset)
         // No asset found
@@ -175,34 +151,11 @@ namespace iroha {
       if (amount.get_frac_number() > precision)
         // Precision is wrong
         return false;
-      // Get src balance
-      auto src_balance = src_account_asset.value().balance;
-      // TODO: handle non-trivial arithmetic
-      src_balance -= amount.get_joint_amount(precision);
-      // Set new balance for source account
-      src_account_asset.value().balance = src_balance;
-
-      if (!dest_account_asset) {
-        // This assert is new for this account - create new AccountAsset
-        dest_AccountAsset = AccountAsset();
-        dest_AccountAsset.asset_id = asset_id;
-        dest_AccountAsset.account_id = dest_account_id;
-        // Set new balance for dest account
-        dest_AccountAsset.balance = amount.get_joint_amount(precision);
-
-      } else {
-        // Account already has such asset
-        dest_AccountAsset = dest_account_asset.value();
-        // Get balance dest account
-        auto dest_balance = dest_account_asset.value().balance;
-
-        dest_balance += amount.get_joint_amount(precision);
-        // Set new balance for dest
-        dest_AccountAsset.balance = dest_balance;
-      }
-
-      return commands.upsertAccountAsset(dest_AccountAsset) &&
-             commands.upsertAccountAsset(src_account_asset.value());
+      // Both balances are checked and updated in storage at once
+      return commands.transferAccountAsset(src_account_id,
+                                           dest_account_id,
+                                           asset_id,
+                                           amount.get_joint_amount(precision));
     }
   }
 }
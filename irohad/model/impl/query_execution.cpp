@@ -16,16 +16,91 @@
  */
 
 #include "model/query_execution.hpp"
+#include <algorithm>
+#include "ametsuchi/read_only_wsv.hpp"
 #include "model/queries/responses/account_assets_response.hpp"
 #include "model/queries/responses/account_response.hpp"
+#include "model/queries/responses/asset_holders_response.hpp"
 #include "model/queries/responses/error_response.hpp"
+#include "model/queries/responses/query_batch_response.hpp"
 #include "model/queries/responses/signatories_response.hpp"
 #include "model/queries/responses/transactions_response.hpp"
 
+namespace {
+  template <typename T>
+  std::shared_ptr<iroha::model::QueryResponse> copyAs(
+      const iroha::model::QueryResponse& response) {
+    return std::make_shared<T>(static_cast<const T&>(response));
+  }
+
+  /**
+   * @return copy of response which can be cached, nullptr otherwise.
+   * Errors are not cached, so an entry created after the error is seen
+   * at once
+   */
+  std::shared_ptr<iroha::model::QueryResponse> copyResponse(
+      const iroha::model::QueryResponse& response) {
+    using namespace iroha::model;
+    if (iroha::instanceof <AccountResponse>(response)) {
+      return copyAs<AccountResponse>(response);
+    }
+    if (iroha::instanceof <AccountAssetResponse>(response)) {
+      return copyAs<AccountAssetResponse>(response);
+    }
+    if (iroha::instanceof <AccountAssetsResponse>(response)) {
+      return copyAs<AccountAssetsResponse>(response);
+    }
+    if (iroha::instanceof <SignatoriesResponse>(response)) {
+      return copyAs<SignatoriesResponse>(response);
+    }
+    return nullptr;
+  }
+}  // namespace
+
 iroha::model::QueryProcessingFactory::QueryProcessingFactory(
     std::shared_ptr<ametsuchi::WsvQuery> wsvQuery,
     std::shared_ptr<ametsuchi::BlockQuery> blockQuery)
-    : _wsvQuery(wsvQuery), _blockQuery(blockQuery) {}
+    : QueryProcessingFactory(
+          wsvQuery,
+          blockQuery,
+          std::make_shared<QueryResultCache>(size_t{MAX_CACHED_RESULTS})) {}
+
+iroha::model::QueryProcessingFactory::QueryProcessingFactory(
+    std::shared_ptr<ametsuchi::WsvQuery> wsvQuery,
+    std::shared_ptr<ametsuchi::BlockQuery> blockQuery,
+    std::shared_ptr<QueryResultCache> cache)
+    : _wsvQuery(wsvQuery), _blockQuery(blockQuery), _cache(cache) {}
+
+void iroha::model::QueryProcessingFactory::onCommit(
+    const model::Block& block) {
+  _cache->commit(block);
+}
+
+std::shared_ptr<iroha::model::QueryResponse>
+iroha::model::QueryProcessingFactory::executeCached(
+    const std::string& account_id,
+    const std::string& key,
+    const hash256_t& query_hash,
+    std::function<std::shared_ptr<QueryResponse>()> execute) {
+  if (_snapshot) {
+    return execute();
+  }
+  auto cached = _cache->get(key);
+  if (cached) {
+    auto response = copyResponse(*cached);
+    response->query_hash = query_hash;
+    return response;
+  }
+  // a block committed while reading makes the result stale, the height
+  // lets the cache drop it
+  auto height = _cache->height();
+  auto response = execute();
+  auto copy = copyResponse(*response);
+  if (copy) {
+    _cache->put(account_id, key, height, copy);
+  }
+  return response;
+}
 
 bool iroha::model::QueryProcessingFactory::validate(
     const model::GetAccount& query) {
@@ -83,6 +158,16 @@ bool iroha::model::QueryProcessingFactory::validate(
        query.account_id == query.creator_account_id);
 }
 
+bool iroha::model::QueryProcessingFactory::validate(
+    const model::GetAssetHolders& query) {
+  auto creator = _wsvQuery->getAccount(query.creator_account_id);
+  return
+      // Creator account exits
+      creator.has_value() &&
+      // Creator has permission to read balances of all accounts
+      creator.value().permissions.read_all_accounts;
+}
+
 std::shared_ptr<iroha::model::QueryResponse>
 iroha::model::QueryProcessingFactory::executeGetAccount(
     const model::GetAccount& query) {
@@ -117,6 +202,22 @@ iroha::model::QueryProcessingFactory::executeGetAccountAssets(
   return std::make_shared<iroha::model::AccountAssetResponse>(response);
 }
 
+std::shared_ptr<iroha::model::QueryResponse>
+iroha::model::QueryProcessingFactory::executeGetAllAccountAssets(
+    const model::GetAccountAssets& query) {
+  auto acct_assets = _wsvQuery->getAccountAssets(query.account_id);
+  if (!acct_assets.has_value() || acct_assets.value().empty()) {
+    iroha::model::ErrorResponse response;
+    response.query_hash = query.query_hash;
+    response.reason = iroha::model::ErrorResponse::NO_ACCOUNT_ASSETS;
+    return std::make_shared<iroha::model::ErrorResponse>(response);
+  }
+  iroha::model::AccountAssetsResponse response;
+  response.acct_assets = acct_assets.value();
+  response.query_hash = query.query_hash;
+  return std::make_shared<iroha::model::AccountAssetsResponse>(response);
+}
+
 std::shared_ptr<iroha::model::QueryResponse>
 iroha::model::QueryProcessingFactory::executeGetAccountAssetTransactions(
     const model::GetAccountAssetTransactions& query) {
@@ -131,13 +232,55 @@ iroha::model::QueryProcessingFactory::executeGetAccountAssetTransactions(
 std::shared_ptr<iroha::model::QueryResponse>
 iroha::model::QueryProcessingFactory::executeGetAccountTransactions(
     const model::GetAccountTransactions& query) {
-  auto acc_tx = _blockQuery->getAccountTransactions(query.account_id);
+  auto page_size = query.page_size;
+  if (page_size == 0 || page_size > MAX_ACCOUNT_TRANSACTIONS_PAGE) {
+    page_size = MAX_ACCOUNT_TRANSACTIONS_PAGE;
+  }
+  auto page = _blockQuery->getAccountTransactions(
+      query.account_id, query.after_hash, page_size);
+  if (not page.has_value()) {
+    iroha::model::ErrorResponse response;
+    response.query_hash = query.query_hash;
+    response.reason = ErrorResponse::NOT_SUPPORTED;
+    return std::make_shared<iroha::model::ErrorResponse>(response);
+  }
   iroha::model::TransactionsResponse response;
   response.query_hash = query.query_hash;
-  response.transactions = acc_tx;
+  response.next_tx_hash = page->next_hash;
+  response.transactions = rxcpp::observable<>::iterate(page->transactions);
   return std::make_shared<iroha::model::TransactionsResponse>(response);
 }
 
+std::shared_ptr<iroha::model::QueryResponse>
+iroha::model::QueryProcessingFactory::executeGetAssetHolders(
+    const model::GetAssetHolders& query) {
+  auto page_size = query.page_size;
+  if (page_size == 0 || page_size > MAX_ASSET_HOLDERS_PAGE) {
+    page_size = MAX_ASSET_HOLDERS_PAGE;
+  }
+  // one extra holder is read to find out if there is a next page
+  auto holders = _wsvQuery->getAssetHolders(query.asset_id,
+                                            query.after_account_id,
+                                            query.after_balance,
+                                            page_size + 1,
+                                            query.order_by_balance);
+  if (!holders.has_value()) {
+    iroha::model::ErrorResponse response;
+    response.query_hash = query.query_hash;
+    response.reason = iroha::model::ErrorResponse::NO_ACCOUNT_ASSETS;
+    return std::make_shared<iroha::model::ErrorResponse>(response);
+  }
+  iroha::model::AssetHoldersResponse response;
+  response.query_hash = query.query_hash;
+  response.holders = holders.value();
+  if (response.holders.size() > page_size) {
+    response.holders.resize(page_size);
+    response.next_account_id = response.holders.back().account_id;
+    response.next_balance = response.holders.back().balance;
+  }
+  return std::make_shared<iroha::model::AssetHoldersResponse>(response);
+}
+
 std::shared_ptr<iroha::model::QueryResponse>
 iroha::model::QueryProcessingFactory::executeGetSignatories(
     const model::GetSignatories& query) {
@@ -154,6 +297,50 @@ iroha::model::QueryProcessingFactory::executeGetSignatories(
   return std::make_shared<iroha::model::SignatoriesResponse>(response);
 }
 
+std::shared_ptr<iroha::model::QueryResponse>
+iroha::model::QueryProcessingFactory::executeQueryBatch(
+    const model::QueryBatch& batch) {
+  if (batch.queries.size() > MAX_BATCH_QUERIES) {
+    iroha::model::ErrorResponse response;
+    response.query_hash = batch.query_hash;
+    response.reason = model::ErrorResponse::WRONG_FORMAT;
+    return std::make_shared<iroha::model::ErrorResponse>(response);
+  }
+  auto reads_blocks = std::any_of(
+      batch.queries.begin(), batch.queries.end(), [](const auto& query) {
+        return instanceof <model::GetAccountTransactions>(query.get())
+            or instanceof <model::GetAccountAssetTransactions>(query.get());
+      });
+  auto wsv = std::dynamic_pointer_cast<ametsuchi::ReadOnlyWsv>(_wsvQuery);
+  if (not wsv or _snapshot or reads_blocks) {
+    iroha::model::ErrorResponse response;
+    response.query_hash = batch.query_hash;
+    response.reason = model::ErrorResponse::NOT_SUPPORTED;
+    return std::make_shared<iroha::model::ErrorResponse>(response);
+  }
+  iroha::model::QueryBatchResponse response;
+  response.query_hash = batch.query_hash;
+  // snapshot rethrows errors of storage, flag is cleared on any exit
+  struct SnapshotGuard {
+    bool& snapshot;
+    ~SnapshotGuard() { snapshot = false; }
+  } guard{_snapshot};
+  _snapshot = true;
+  auto executed = wsv->snapshot([this, &batch, &response] {
+    for (const auto& query : batch.queries) {
+      response.responses.push_back(execute(query));
+    }
+  });
+  if (not executed) {
+    // storage could not open the snapshot, the batch may be retried
+    iroha::model::ErrorResponse error;
+    error.query_hash = batch.query_hash;
+    error.reason = model::ErrorResponse::OVERLOADED;
+    return std::make_shared<iroha::model::ErrorResponse>(error);
+  }
+  return std::make_shared<iroha::model::QueryBatchResponse>(response);
+}
+
 std::shared_ptr<iroha::model::QueryResponse>
 iroha::model::QueryProcessingFactory::execute(
     std::shared_ptr<const model::Query> query) {
@@ -166,7 +353,11 @@ iroha::model::QueryProcessingFactory::execute(
       response.reason = model::ErrorResponse::STATEFUL_INVALID;
       return std::make_shared<ErrorResponse>(response);
     }
-    return executeGetAccount(*qry);
+    // permissions are checked per creator above, the result is shared
+    return executeCached(qry->account_id,
+                         "GetAccount/" + qry->account_id,
+                         qry->query_hash,
+                         [this, &qry] { return executeGetAccount(*qry); });
   }
   if (instanceof <iroha::model::GetAccountAssets>(query.get())) {
     auto qry =
@@ -177,7 +368,16 @@ iroha::model::QueryProcessingFactory::execute(
       response.reason = model::ErrorResponse::STATEFUL_INVALID;
       return std::make_shared<iroha::model::ErrorResponse>(response);
     }
-    return executeGetAccountAssets(*qry);
+    return executeCached(
+        qry->account_id,
+        "GetAccountAssets/" + qry->account_id + "/" + qry->asset_id,
+        qry->query_hash,
+        [this, &qry] {
+          if (qry->asset_id.empty()) {
+            return executeGetAllAccountAssets(*qry);
+          }
+          return executeGetAccountAssets(*qry);
+        });
   }
   if (instanceof <iroha::model::GetSignatories>(query.get())) {
     auto qry =
@@ -188,7 +388,10 @@ iroha::model::QueryProcessingFactory::execute(
       response.reason = model::ErrorResponse::STATEFUL_INVALID;
       return std::make_shared<iroha::model::ErrorResponse>(response);
     }
-    return executeGetSignatories(*qry);
+    return executeCached(qry->account_id,
+                         "GetSignatories/" + qry->account_id,
+                         qry->query_hash,
+                         [this, &qry] { return executeGetSignatories(*qry); });
   }
   if (instanceof <iroha::model::GetAccountTransactions>(query.get())) {
     auto qry =
@@ -213,6 +416,21 @@ iroha::model::QueryProcessingFactory::execute(
     }
     return executeGetAccountAssetTransactions(*qry);
   }
+  if (instanceof <iroha::model::GetAssetHolders>(query.get())) {
+    auto qry =
+        std::static_pointer_cast<const iroha::model::GetAssetHolders>(query);
+    if (!validate(*qry)) {
+      iroha::model::ErrorResponse response;
+      response.query_hash = qry->query_hash;
+      response.reason = model::ErrorResponse::STATEFUL_INVALID;
+      return std::make_shared<iroha::model::ErrorResponse>(response);
+    }
+    return executeGetAssetHolders(*qry);
+  }
+  if (instanceof <iroha::model::QueryBatch>(query.get())) {
+    auto qry = std::static_pointer_cast<const iroha::model::QueryBatch>(query);
+    return executeQueryBatch(*qry);
+  }
   iroha::model::ErrorResponse response;
   response.query_hash = query->query_hash;
   response.reason = model::ErrorResponse::NOT_SUPPORTED;
@@ -0,0 +1,161 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "model/query_result_cache.hpp"
+#include "model/commands/add_asset_quantity.hpp"
+#include "model/commands/add_peer.hpp"
+#include "model/commands/add_signatory.hpp"
+#include "model/commands/assign_master_key.hpp"
+#include "model/commands/create_account.hpp"
+#include "model/commands/create_asset.hpp"
+#include "model/commands/create_domain.hpp"
+#include "model/commands/remove_signatory.hpp"
+#include "model/commands/set_permissions.hpp"
+#include "model/commands/set_quorum.hpp"
+#include "model/commands/transfer_asset.hpp"
+
+namespace iroha {
+  namespace model {
+
+    namespace {
+      /**
+       * Collect accounts whose state the command may change
+       * @return false if the command is unknown
+       */
+      bool touchedAccounts(const Command &command,
+                           std::unordered_set<std::string> &accounts) {
+        if (instanceof <AddAssetQuantity>(command)) {
+          accounts.insert(
+              static_cast<const AddAssetQuantity &>(command).account_id);
+        } else if (instanceof <TransferAsset>(command)) {
+          auto &transfer = static_cast<const TransferAsset &>(command);
+          accounts.insert(transfer.src_account_id);
+          accounts.insert(transfer.dest_account_id);
+        } else if (instanceof <CreateAccount>(command)) {
+          auto &create = static_cast<const CreateAccount &>(command);
+          accounts.insert(create.account_name + "@" + create.domain_id);
+        } else if (instanceof <AddSignatory>(command)) {
+          accounts.insert(
+              static_cast<const AddSignatory &>(command).account_id);
+        } else if (instanceof <RemoveSignatory>(command)) {
+          accounts.insert(
+              static_cast<const RemoveSignatory &>(command).account_id);
+        } else if (instanceof <AssignMasterKey>(command)) {
+          accounts.insert(
+              static_cast<const AssignMasterKey &>(command).account_id);
+        } else if (instanceof <SetQuorum>(command)) {
+          accounts.insert(static_cast<const SetQuorum &>(command).account_id);
+        } else if (instanceof <SetAccountPermissions>(command)) {
+          accounts.insert(
+              static_cast<const SetAccountPermissions &>(command).account_id);
+        } else if (not(instanceof <CreateAsset>(command)
+                       or instanceof <CreateDomain>(command)
+                       or instanceof <AddPeer>(command))) {
+          return false;
+        }
+        return true;
+      }
+    }  // namespace
+
+    QueryResultCache::QueryResultCache(size_t capacity)
+        : capacity_(capacity) {}
+
+    uint64_t QueryResultCache::height() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return height_;
+    }
+
+    std::shared_ptr<const QueryResponse> QueryResultCache::get(
+        const std::string &key) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto entry = entries_.find(key);
+      if (entry == entries_.end()) {
+        ++metrics_.misses;
+        return nullptr;
+      }
+      ++metrics_.hits;
+      return entry->second.response;
+    }
+
+    void QueryResultCache::put(const std::string &account_id,
+                               const std::string &key,
+                               uint64_t height,
+                               std::shared_ptr<const QueryResponse> response) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (height != height_ or capacity_ == 0) {
+        return;
+      }
+      erase(key);
+      if (entries_.size() >= capacity_) {
+        // any entry goes, the cache is refilled by the next reads anyway
+        erase(entries_.begin()->first);
+        ++metrics_.evicted;
+      }
+      entries_.emplace(key, Entry{account_id, std::move(response)});
+      account_keys_[account_id].insert(key);
+    }
+
+    void QueryResultCache::commit(const Block &block) {
+      std::unordered_set<std::string> accounts;
+      bool known = true;
+      for (const auto &tx : block.transactions) {
+        for (const auto &command : tx.commands) {
+          known = known and touchedAccounts(*command, accounts);
+        }
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      height_ = block.height;
+      if (not known) {
+        metrics_.invalidated += entries_.size();
+        entries_.clear();
+        account_keys_.clear();
+        return;
+      }
+      for (const auto &account : accounts) {
+        auto keys = account_keys_.find(account);
+        if (keys == account_keys_.end()) {
+          continue;
+        }
+        metrics_.invalidated += keys->second.size();
+        for (const auto &key : keys->second) {
+          entries_.erase(key);
+        }
+        account_keys_.erase(keys);
+      }
+    }
+
+    const QueryResultCacheMetrics &QueryResultCache::metrics() const {
+      return metrics_;
+    }
+
+    void QueryResultCache::erase(const std::string &key) {
+      auto entry = entries_.find(key);
+      if (entry == entries_.end()) {
+        return;
+      }
+      auto keys = account_keys_.find(entry->second.account_id);
+      if (keys != account_keys_.end()) {
+        keys->second.erase(key);
+        if (keys->second.empty()) {
+          account_keys_.erase(keys);
+        }
+      }
+      entries_.erase(entry);
+    }
+  }  // namespace model
+}  // namespace iroha
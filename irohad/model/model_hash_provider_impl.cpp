@@ -20,8 +20,10 @@
 #include <iostream>
 #include "common/types.hpp"
 #include "model/queries/get_account_assets.hpp"
+#include "model/queries/get_asset_holders.hpp"
 #include "model/queries/get_signatories.hpp"
 #include "model/queries/get_transactions.hpp"
+#include "model/queries/query_batch.hpp"
 
 namespace iroha {
   namespace model {
@@ -123,6 +125,26 @@ namespace iroha {
       if (instanceof <model::GetAccountTransactions>(query)) {
         auto cast = static_cast<const GetAccountTransactions &>(*query);
         result_hash += cast.account_id;
+        // the cursor is not signed, so one signed query pages through
+        // the whole history
+        result_hash += std::to_string(cast.page_size);
+        result_hash += cast.creator_account_id;
+      }
+      if (instanceof <model::GetAssetHolders>(query)) {
+        auto cast = static_cast<const GetAssetHolders &>(*query);
+        result_hash += cast.asset_id;
+        result_hash += cast.after_account_id;
+        result_hash += std::to_string(cast.after_balance);
+        result_hash += std::to_string(cast.page_size);
+        result_hash += cast.order_by_balance ? "1" : "0";
+        result_hash += cast.creator_account_id;
+      }
+      if (instanceof <model::QueryBatch>(query)) {
+        // hashes of queries carry their content and the batch creator
+        const auto &cast = static_cast<const QueryBatch &>(*query);
+        for (const auto &batch_query : cast.queries) {
+          result_hash += get_hash(batch_query).to_string();
+        }
         result_hash += cast.creator_account_id;
       }
       result_hash += query->query_counter;
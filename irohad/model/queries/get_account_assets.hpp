@@ -29,6 +29,10 @@ namespace iroha {
      */
     struct GetAccountAssets : Query {
       std::string account_id;
+
+      /**
+       * Asset identifier, empty to request all assets of the account
+       */
       std::string asset_id;
     };
   }  // namespace model
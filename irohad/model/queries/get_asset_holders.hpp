@@ -0,0 +1,58 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_GET_ASSET_HOLDERS_HPP
+#define IROHA_GET_ASSET_HOLDERS_HPP
+
+#include <model/query.hpp>
+#include <string>
+
+namespace iroha {
+  namespace model {
+
+    /**
+     * Query for getting one page of accounts holding given asset
+     */
+    struct GetAssetHolders : Query {
+      /**
+       * Asset identifier
+       */
+      std::string asset_id;
+
+      /**
+       * Last account of the previous page, empty for the first page
+       */
+      std::string after_account_id;
+
+      /**
+       * Balance of the last account of the previous page
+       */
+      uint64_t after_balance = 0;
+
+      /**
+       * Maximum number of holders in the page, 0 for the largest page
+       */
+      uint32_t page_size = 0;
+
+      /**
+       * Order holders by balance descending instead of account identifier
+       */
+      bool order_by_balance = false;
+    };
+  }  // namespace model
+}  // namespace iroha
+#endif  // IROHA_GET_ASSET_HOLDERS_HPP
@@ -19,6 +19,7 @@
 #define IROHA_GET_TRANSACTIONS_HPP
 
 #include <model/query.hpp>
+#include <nonstd/optional.hpp>
 #include <string>
 
 namespace iroha {
@@ -47,6 +48,16 @@ namespace iroha {
        * Account identifier
        */
       std::string account_id;
+
+      /**
+       * Last transaction of the previous page, none for the first page
+       */
+      nonstd::optional<hash256_t> after_hash;
+
+      /**
+       * Maximum number of transactions in the page
+       */
+      uint32_t page_size = 0;
     };
   }  // namespace model
 }  // namespace iroha
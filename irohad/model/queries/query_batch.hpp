@@ -0,0 +1,40 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_QUERY_BATCH_HPP
+#define IROHA_QUERY_BATCH_HPP
+
+#include <memory>
+#include <model/query.hpp>
+#include <vector>
+
+namespace iroha {
+  namespace model {
+
+    /**
+     * Queries signed and executed together against one state of ledger.
+     * Creator, timestamp and counter of the batch apply to all its queries
+     */
+    struct QueryBatch : Query {
+      /**
+       * Queries in order of execution
+       */
+      std::vector<std::shared_ptr<Query>> queries;
+    };
+  }  // namespace model
+}  // namespace iroha
+#endif  // IROHA_QUERY_BATCH_HPP
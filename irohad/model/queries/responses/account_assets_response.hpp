@@ -28,6 +28,16 @@ namespace iroha {
     struct AccountAssetResponse : public QueryResponse {
       AccountAsset acct_asset;
     };
+
+    /**
+     * Provide all assets of the account
+     */
+    struct AccountAssetsResponse : public QueryResponse {
+      /**
+       * Account assets ordered by asset identifier
+       */
+      std::vector<AccountAsset> acct_assets;
+    };
   }  // namespace model
 }  // namespace iroha
 #endif  // IROHA_ACCOUNT_ASSETS_RESPONSE_HPP
@@ -0,0 +1,50 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_ASSET_HOLDERS_RESPONSE_HPP
+#define IROHA_ASSET_HOLDERS_RESPONSE_HPP
+
+#include <string>
+#include <vector>
+#include "model/account_asset.hpp"
+#include "model/query_response.hpp"
+
+namespace iroha {
+  namespace model {
+
+    /**
+     * Provide one page of accounts holding the asset
+     */
+    struct AssetHoldersResponse : public QueryResponse {
+      /**
+       * Account assets of holders in requested order
+       */
+      std::vector<AccountAsset> holders;
+
+      /**
+       * Cursor to request the next page, empty if this page is the last
+       */
+      std::string next_account_id;
+
+      /**
+       * Balance of the last holder, part of the cursor
+       */
+      uint64_t next_balance = 0;
+    };
+  }  // namespace model
+}  // namespace iroha
+#endif  // IROHA_ASSET_HOLDERS_RESPONSE_HPP
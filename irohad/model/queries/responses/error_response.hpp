@@ -55,7 +55,19 @@ namespace iroha {
         /**
          * when unidentified request was received
          */
-        NOT_SUPPORTED
+        NOT_SUPPORTED,
+        /**
+         * when request is malformed or exceeds its limits
+         */
+        WRONG_FORMAT,
+        /**
+         * when too many queries of the same class are pending
+         */
+        OVERLOADED,
+        /**
+         * when query was not started before its deadline
+         */
+        DEADLINE_EXCEEDED
       };
       Reason reason;
     };
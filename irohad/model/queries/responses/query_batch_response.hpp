@@ -0,0 +1,39 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_QUERY_BATCH_RESPONSE_HPP
+#define IROHA_QUERY_BATCH_RESPONSE_HPP
+
+#include <memory>
+#include <vector>
+#include "model/query_response.hpp"
+
+namespace iroha {
+  namespace model {
+
+    /**
+     * Provide responses to queries of a batch
+     */
+    struct QueryBatchResponse : public QueryResponse {
+      /**
+       * Responses in order of queries
+       */
+      std::vector<std::shared_ptr<QueryResponse>> responses;
+    };
+  }  // namespace model
+}  // namespace iroha
+#endif  // IROHA_QUERY_BATCH_RESPONSE_HPP
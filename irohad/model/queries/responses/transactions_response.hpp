@@ -18,6 +18,7 @@
 #ifndef IROHA_TRANSACTIONS_RESPONSE_HPP
 #define IROHA_TRANSACTIONS_RESPONSE_HPP
 
+#include <nonstd/optional.hpp>
 #include <rxcpp/rx-observable.hpp>
 #include "model/transaction.hpp"
 
@@ -33,6 +34,11 @@ namespace iroha {
        * Observable contains transactions
        */
       rxcpp::observable <Transaction> transactions;
+
+      /**
+       * Cursor to request the next page, none if this page is the last
+       */
+      nonstd::optional<hash256_t> next_tx_hash;
     };
   }  // namespace model
 }  // namespace iroha
@@ -17,14 +17,18 @@
 #ifndef IROHA_QUERY_EXECUTION_HPP
 #define IROHA_QUERY_EXECUTION_HPP
 
+#include <functional>
 #include <nonstd/optional.hpp>
 #include "model/query.hpp"
 #include "model/query_response.hpp"
+#include "model/query_result_cache.hpp"
 
 #include "model/queries/get_account.hpp"
 #include "model/queries/get_account_assets.hpp"
+#include "model/queries/get_asset_holders.hpp"
 #include "model/queries/get_signatories.hpp"
 #include "model/queries/get_transactions.hpp"
+#include "model/queries/query_batch.hpp"
 
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/wsv_query.hpp"
@@ -53,6 +57,43 @@ namespace iroha {
       QueryProcessingFactory(std::shared_ptr<ametsuchi::WsvQuery> wsvQuery,
                              std::shared_ptr<ametsuchi::BlockQuery> blockQuery);
 
+      /**
+       * Factory sharing the query result cache with other factories
+       * @param wsvQuery
+       * @param blockQuery
+       * @param cache - query result cache
+       */
+      QueryProcessingFactory(std::shared_ptr<ametsuchi::WsvQuery> wsvQuery,
+                             std::shared_ptr<ametsuchi::BlockQuery> blockQuery,
+                             std::shared_ptr<QueryResultCache> cache);
+
+      /**
+       * Upper bound of holders returned in one GetAssetHolders page
+       */
+      static constexpr uint32_t MAX_ASSET_HOLDERS_PAGE = 1000;
+
+      /**
+       * Upper bound of transactions returned in one GetAccountTransactions
+       * page
+       */
+      static constexpr uint32_t MAX_ACCOUNT_TRANSACTIONS_PAGE = 1000;
+
+      /**
+       * Upper bound of queries in one batch
+       */
+      static constexpr size_t MAX_BATCH_QUERIES = 100;
+
+      /**
+       * Upper bound of results kept in the query result cache
+       */
+      static constexpr size_t MAX_CACHED_RESULTS = 100000;
+
+      /**
+       * Evicts cached results touched by the committed block
+       * @param block - committed block
+       */
+      void onCommit(const model::Block& block);
+
      private:
       bool validate(const model::GetAccountAssets& query);
 
@@ -64,9 +105,14 @@ namespace iroha {
 
       bool validate(const model::GetAccountTransactions& query);
 
+      bool validate(const model::GetAssetHolders& query);
+
       std::shared_ptr<iroha::model::QueryResponse> executeGetAccountAssets(
           const model::GetAccountAssets& query);
 
+      std::shared_ptr<iroha::model::QueryResponse> executeGetAllAccountAssets(
+          const model::GetAccountAssets& query);
+
       std::shared_ptr<iroha::model::QueryResponse> executeGetAccount(
           const model::GetAccount& query);
 
@@ -80,8 +126,41 @@ namespace iroha {
       std::shared_ptr<iroha::model::QueryResponse>
       executeGetAccountTransactions(const model::GetAccountTransactions& query);
 
+      std::shared_ptr<iroha::model::QueryResponse> executeGetAssetHolders(
+          const model::GetAssetHolders& query);
+
+      /**
+       * Executes queries of the batch in order on one snapshot of ledger.
+       * Batch is not supported if the world state view can not provide
+       * snapshots, if it is nested into another batch, or if it reads
+       * transactions, as the block store is not part of the snapshot.
+       * Batch of more than MAX_BATCH_QUERIES queries has wrong format
+       */
+      std::shared_ptr<iroha::model::QueryResponse> executeQueryBatch(
+          const model::QueryBatch& batch);
+
+      /**
+       * Returns cached result of query or executes it and caches the result
+       * @param account_id - account the result depends on
+       * @param key - normalized content of query without its creator
+       * @param query_hash - hash of query being answered
+       * @param execute - reads the result from storage
+       */
+      std::shared_ptr<iroha::model::QueryResponse> executeCached(
+          const std::string& account_id,
+          const std::string& key,
+          const hash256_t& query_hash,
+          std::function<std::shared_ptr<iroha::model::QueryResponse>()>
+              execute);
+
       std::shared_ptr<ametsuchi::WsvQuery> _wsvQuery;
       std::shared_ptr<ametsuchi::BlockQuery> _blockQuery;
+      std::shared_ptr<QueryResultCache> _cache;
+
+      /**
+       * Queries are executed on a snapshot, cached results may be newer
+       */
+      bool _snapshot = false;
     };
 
   }  // namespace model
@@ -0,0 +1,110 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_QUERY_RESULT_CACHE_HPP
+#define IROHA_QUERY_RESULT_CACHE_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include "model/block.hpp"
+#include "model/query_response.hpp"
+
+namespace iroha {
+  namespace model {
+
+    /**
+     * Counters of query result cache
+     */
+    struct QueryResultCacheMetrics {
+      std::atomic<uint64_t> hits{0};
+      std::atomic<uint64_t> misses{0};
+      std::atomic<uint64_t> invalidated{0};
+      std::atomic<uint64_t> evicted{0};
+    };
+
+    /**
+     * Thread-safe cache of query results over committed state.
+     * Each result belongs to an account and stays valid until a block
+     * touching the account is committed.
+     */
+    class QueryResultCache {
+     public:
+      /**
+       * @param capacity - maximum number of cached results
+       */
+      explicit QueryResultCache(size_t capacity);
+
+      /**
+       * @return height of the last committed block seen by the cache
+       */
+      uint64_t height() const;
+
+      /**
+       * @param key - normalized content of query
+       * @return cached result, nullptr if there is none
+       */
+      std::shared_ptr<const QueryResponse> get(const std::string &key);
+
+      /**
+       * Store result of query. Result is dropped if a block has been
+       * committed since it was read, as it may be stale
+       * @param account_id - account the result depends on
+       * @param key - normalized content of query
+       * @param height - height() before the result was read
+       * @param response - result of query
+       */
+      void put(const std::string &account_id,
+               const std::string &key,
+               uint64_t height,
+               std::shared_ptr<const QueryResponse> response);
+
+      /**
+       * Evict results of accounts touched by the committed block
+       * @param block - committed block
+       */
+      void commit(const Block &block);
+
+      /**
+       * @return counters of the cache
+       */
+      const QueryResultCacheMetrics &metrics() const;
+
+     private:
+      struct Entry {
+        std::string account_id;
+        std::shared_ptr<const QueryResponse> response;
+      };
+
+      // must be called with mutex_ locked
+      void erase(const std::string &key);
+
+      size_t capacity_;
+      uint64_t height_ = 0;
+      std::unordered_map<std::string, Entry> entries_;
+      std::unordered_map<std::string, std::unordered_set<std::string>>
+          account_keys_;
+      QueryResultCacheMetrics metrics_;
+      mutable std::mutex mutex_;
+    };
+  }  // namespace model
+}  // namespace iroha
+
+#endif  // IROHA_QUERY_RESULT_CACHE_HPP
@@ -32,6 +32,12 @@ namespace iroha {
        * Is stateless validation passed
        */
       bool passed;
+
+      /**
+       * Is transaction not propagated because network or validation queue
+       * is overloaded
+       */
+      bool overloaded = false;
     };
   } // namespace model
 } // namespace iroha
@@ -22,6 +22,9 @@ namespace network {
   template <typename ServiceHandler, typename AsyncService, typename RequestType, typename ResponseType>
   class Call;
 
+  template <typename ServiceHandler, typename AsyncService, typename RequestType, typename ResponseType>
+  class ServerStreamCall;
+
   /**
    * interface of handling rpcs in a service.
    */
@@ -67,6 +70,24 @@ namespace network {
   using RpcHandler = void (ServiceHandler::*)(
     Call<ServiceHandler, AsyncService, RequestType, ResponseType>*);
 
+  /**
+   * to refer a method that requests one server streaming rpc.
+   * e.g. iroha::protocol::AsyncService::RequestStatusStream
+   */
+  template <typename AsyncService, typename RequestType, typename ResponseType>
+  using StreamRequestMethod = void (AsyncService::*)(
+    ::grpc::ServerContext*, RequestType*,
+    ::grpc::ServerAsyncWriter<ResponseType>*,
+    ::grpc::CompletionQueue*, ::grpc::ServerCompletionQueue*, void*);
+
+  /**
+   * to refer a method that starts serving ServerStreamCall instance
+   * and creates a new one to serve new clients.
+   */
+  template <typename ServiceHandler, typename AsyncService, typename RequestType, typename ResponseType>
+  using StreamRpcHandler = void (ServiceHandler::*)(
+    ServerStreamCall<ServiceHandler, AsyncService, RequestType, ResponseType>*);
+
 }  // namespace network
 
 #endif  // NETWORK_GRPC_ASYNC_SERVICE_HPP
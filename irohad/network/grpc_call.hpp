@@ -19,6 +19,9 @@ limitations under the License.
 
 #include <grpc++/grpc++.h>
 #include <assert.h>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <network/grpc_async_service.hpp>
 
 namespace network {
@@ -32,7 +35,7 @@ namespace network {
   public:
     virtual ~UntypedCall() {}
 
-    enum class State { RequestCreated, ResponseSent };
+    enum class State { RequestCreated, ResponseSent, WriteDone, Done };
 
     /**
      * invokes when state is RequestReceivedTag.
@@ -45,6 +48,18 @@ namespace network {
      */
     virtual void responseSent() = 0;
 
+    /**
+     * invokes when state is WriteDoneTag. used by streaming calls only.
+     * @param ok - false if the stream is broken
+     */
+    virtual void writeDone(bool ok) {}
+
+    /**
+     * invokes when state is DoneTag, i.e. the rpc is finished or cancelled.
+     * used by streaming calls only.
+     */
+    virtual void done() {}
+
     /**
      * owns concrete Call type and executes derived functions.
      * container for vtable to work if casts UntypedCall<> from void*
@@ -58,17 +73,29 @@ namespace network {
        * selects a procedure by state and invokes it by using polymorphism.
        * this is called from ServiceHandler::handleRpcs()
        * @param serviceHandler - an instance that has all rpc handlers. e.g. CommandService
+       * @param ok - result of the operation reported by completion queue
        */
-      void onCompleted(ServiceHandler *serviceHandler) {
+      void onCompleted(ServiceHandler *serviceHandler, bool ok = true) {
         switch (state_) {
           case UntypedCall::State::RequestCreated: {
-            call_->requestReceived(serviceHandler);
+            // not ok if the request was cancelled by server shutdown
+            if (ok) {
+              call_->requestReceived(serviceHandler);
+            }
             break;
           }
           case UntypedCall::State::ResponseSent: {
             call_->responseSent();
             break;
           }
+          case UntypedCall::State::WriteDone: {
+            call_->writeDone(ok);
+            break;
+          }
+          case UntypedCall::State::Done: {
+            call_->done();
+            break;
+          }
         }
       }
 
@@ -140,6 +167,7 @@ namespace network {
                                RequestMethodType requestMethod,
                                RpcHandlerType rpcHandler) {
       auto call = new CallType(rpcHandler);
+      call->cq_ = cq;
 
       (asyncService->*requestMethod)(&call->ctx_, &call->request(),
                                      &call->responder_, cq, cq,
@@ -150,6 +178,12 @@ namespace network {
     auto& request()  { return request_; }
     auto& response() { return response_; }
 
+    /**
+     * @return completion queue this call has been enqueued to.
+     * a handler spawns the next Call instance on the same queue.
+     */
+    ::grpc::ServerCompletionQueue* completionQueue() { return cq_; }
+
   private:
     CallOwnerType RequestReceivedTag { this, UntypedCallType::State::RequestCreated };
     CallOwnerType ResponseSentTag { this, UntypedCallType::State::ResponseSent };
@@ -158,10 +192,230 @@ namespace network {
     RpcHandlerType rpcHandler_;
     RequestType request_;
     ResponseType response_;
+    ::grpc::ServerCompletionQueue* cq_ = nullptr;
     ::grpc::ServerContext ctx_;
     ::grpc::ServerAsyncResponseWriter<ResponseType> responder_;
   };
 
+  /**
+   * to manage the state of one server streaming rpc.
+   * responses can be written from any thread, they are sent one by one.
+   * the instance deletes itself when the rpc is over and no operation is
+   * pending.
+   * @tparam ServiceHandler - class that has interface GrpcAsyncService.
+   * @tparam AsyncService - [SomeService]::AsyncService in *.grpc.pb.h
+   * @tparam RequestType - type of a request from client
+   * @tparam ResponseType - type of a streamed response to client
+   */
+  template <typename ServiceHandler, typename AsyncService, typename RequestType, typename ResponseType>
+  class ServerStreamCall : public UntypedCall<ServiceHandler> {
+  public:
+
+    using RpcHandlerType    = network::StreamRpcHandler<ServiceHandler, AsyncService, RequestType, ResponseType>;
+    using RequestMethodType = network::StreamRequestMethod<AsyncService, RequestType, ResponseType>;
+    using CallType          = ServerStreamCall<ServiceHandler, AsyncService, RequestType, ResponseType>;
+    using UntypedCallType   = UntypedCall<ServiceHandler>;
+    using CallOwnerType     = typename UntypedCallType::CallOwner;
+
+    ServerStreamCall(RpcHandlerType rpcHandler)
+      : rpcHandler_(rpcHandler), writer_(&ctx_) {}
+
+    virtual ~ServerStreamCall() {}
+
+    /**
+     * invokes rpc handler. done() waits for the handler to return,
+     * so the handler can safely set a callback with setOnDone().
+     * @param serviceHandler - an instance that has all rpc handlers. e.g. CommandService
+     */
+    void requestReceived(ServiceHandler* serviceHandler) override {
+      std::lock_guard<std::mutex> lock(handlerMutex_);
+      started_ = true;
+      (serviceHandler->*rpcHandler_)(this);
+    }
+
+    /**
+     * enqueues response to the stream.
+     * ignored after finish() or when the rpc is over.
+     * @param response
+     */
+    void write(const ResponseType& response) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (finishing_ or done_) {
+        return;
+      }
+      pending_.push_back(response);
+      if (not writing_) {
+        writeNext();
+      }
+    }
+
+    /**
+     * finishes the stream after all enqueued responses are sent.
+     * @param status
+     */
+    void finish(::grpc::Status status) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (finishing_ or done_) {
+        return;
+      }
+      finishing_ = true;
+      status_ = status;
+      if (not writing_) {
+        finishNow();
+      }
+    }
+
+    /**
+     * sets callback invoked once the rpc is over (finished or cancelled).
+     * after the callback returns write() and finish() must not be called.
+     * @param onDone
+     */
+    void setOnDone(std::function<void()> onDone) {
+      onDone_ = std::move(onDone);
+    }
+
+    /**
+     * sets callback invoked each time a response is delivered to the
+     * client. lets a producer pace itself by the speed of the client.
+     * must be set by the rpc handler.
+     * @param onWritten
+     */
+    void setOnWritten(std::function<void()> onWritten) {
+      onWritten_ = std::move(onWritten);
+    }
+
+    void writeDone(bool ok) override {
+      {
+        // the handler may write before it sets onWritten_
+        std::lock_guard<std::mutex> handlerLock(handlerMutex_);
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      writing_ = false;
+      if (not ok) {
+        // client has gone, nothing more can be sent
+        pending_.clear();
+      }
+      if (not pending_.empty()) {
+        writeNext();
+      } else if (finishing_ and not finished_ and not done_) {
+        finishNow();
+      }
+      if (ok and onWritten_ and not done_) {
+        // the callback may write, so it is invoked without the lock
+        ++callbacks_;
+        lock.unlock();
+        onWritten_();
+        lock.lock();
+        --callbacks_;
+      }
+      deleteIfOver(lock);
+    }
+
+    void responseSent() override {
+      std::unique_lock<std::mutex> lock(mutex_);
+      finishSent_ = true;
+      deleteIfOver(lock);
+    }
+
+    void done() override {
+      {
+        // wait for rpc handler which sets onDone_
+        std::lock_guard<std::mutex> handlerLock(handlerMutex_);
+        if (not started_) {
+          return;
+        }
+      }
+      if (onDone_) {
+        onDone_();
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      done_ = true;
+      pending_.clear();
+      deleteIfOver(lock);
+    }
+
+    /**
+     * creates a ServerStreamCall instance for one rpc and enqueues it
+     * to the completion queue.
+     * @param asyncService
+     * @param cq
+     * @param requestMethod
+     * @param rpcHandler
+     */
+    static void enqueueRequest(AsyncService* asyncService,
+                               ::grpc::ServerCompletionQueue* cq,
+                               RequestMethodType requestMethod,
+                               RpcHandlerType rpcHandler) {
+      auto call = new CallType(rpcHandler);
+      call->cq_ = cq;
+
+      call->ctx_.AsyncNotifyWhenDone(&call->DoneTag);
+      (asyncService->*requestMethod)(&call->ctx_, &call->request(),
+                                     &call->writer_, cq, cq,
+                                     &call->RequestReceivedTag);
+    }
+
+  public:
+    auto& request() { return request_; }
+
+    /**
+     * @return completion queue this call has been enqueued to.
+     */
+    ::grpc::ServerCompletionQueue* completionQueue() { return cq_; }
+
+  private:
+    // must be called with mutex_ locked
+    void writeNext() {
+      writing_ = true;
+      current_ = std::move(pending_.front());
+      pending_.pop_front();
+      writer_.Write(current_, &WriteDoneTag);
+    }
+
+    // must be called with mutex_ locked
+    void finishNow() {
+      finished_ = true;
+      writer_.Finish(status_, &ResponseSentTag);
+    }
+
+    // must be called with mutex_ locked, the lock is released on delete
+    void deleteIfOver(std::unique_lock<std::mutex>& lock) {
+      if (done_ and not writing_ and callbacks_ == 0
+          and (not finished_ or finishSent_)) {
+        lock.unlock();
+        delete this;
+      }
+    }
+
+    CallOwnerType RequestReceivedTag { this, UntypedCallType::State::RequestCreated };
+    CallOwnerType ResponseSentTag { this, UntypedCallType::State::ResponseSent };
+    CallOwnerType WriteDoneTag { this, UntypedCallType::State::WriteDone };
+    CallOwnerType DoneTag { this, UntypedCallType::State::Done };
+
+  private:
+    RpcHandlerType rpcHandler_;
+    RequestType request_;
+    ::grpc::ServerCompletionQueue* cq_ = nullptr;
+    ::grpc::ServerContext ctx_;
+    ::grpc::ServerAsyncWriter<ResponseType> writer_;
+
+    std::mutex handlerMutex_;
+    bool started_ = false;
+    std::function<void()> onDone_;
+    std::function<void()> onWritten_;
+
+    std::mutex mutex_;
+    std::deque<ResponseType> pending_;
+    ResponseType current_;  // response being written
+    ::grpc::Status status_;
+    bool writing_ = false;      // Write() is in flight
+    bool finishing_ = false;    // finish() is requested
+    bool finished_ = false;     // Finish() is called
+    bool finishSent_ = false;   // Finish() is completed
+    bool done_ = false;         // rpc is over
+    size_t callbacks_ = 0;      // onWritten_ calls in progress
+  };
+
 }  // namespace network
 
 #endif  // NETWORK_GRPC_CALL_HPP
@@ -0,0 +1,71 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "network/impl/async_client_runtime.hpp"
+#include <algorithm>
+
+namespace {
+  /**
+   * upper bound of completion queues in default runtime
+   */
+  const size_t MAX_DEFAULT_QUEUES = 4;
+}  // namespace
+
+namespace iroha {
+  namespace network {
+
+    AsyncClientRuntime::AsyncClientRuntime(size_t queues) : next_(0) {
+      queues = std::max<size_t>(queues, 1);
+      for (size_t i = 0; i < queues; ++i) {
+        queues_.push_back(std::make_unique<grpc::CompletionQueue>());
+      }
+      for (const auto &queue : queues_) {
+        threads_.emplace_back(&AsyncClientRuntime::dispatch, queue.get());
+      }
+    }
+
+    AsyncClientRuntime::~AsyncClientRuntime() {
+      for (const auto &queue : queues_) {
+        queue->Shutdown();
+      }
+      for (auto &thread : threads_) {
+        if (thread.joinable()) {
+          thread.join();
+        }
+      }
+    }
+
+    std::shared_ptr<AsyncClientRuntime> AsyncClientRuntime::getDefault() {
+      static auto runtime = std::make_shared<AsyncClientRuntime>(
+          std::min<size_t>(std::thread::hardware_concurrency(),
+                           MAX_DEFAULT_QUEUES));
+      return runtime;
+    }
+
+    grpc::CompletionQueue *AsyncClientRuntime::queue() {
+      return queues_[next_++ % queues_.size()].get();
+    }
+
+    void AsyncClientRuntime::dispatch(grpc::CompletionQueue *queue) {
+      void *got_tag;
+      auto ok = false;
+      while (queue->Next(&got_tag, &ok)) {
+        static_cast<AsyncCall *>(got_tag)->onComplete(ok);
+      }
+    }
+  }  // namespace network
+}  // namespace iroha
@@ -0,0 +1,87 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_ASYNC_CLIENT_RUNTIME_HPP
+#define IROHA_ASYNC_CLIENT_RUNTIME_HPP
+
+#include <atomic>
+#include <grpc++/grpc++.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Asynchronous call which is notified when its completion queue
+     * event arrives
+     */
+    class AsyncCall {
+     public:
+      /**
+       * Handle completion of call
+       * @param ok - result of completion queue event
+       */
+      virtual void onComplete(bool ok) = 0;
+
+      /**
+       * @return tag to pass to gRPC asynchronous operation
+       */
+      void *tag() { return this; }
+
+      virtual ~AsyncCall() = default;
+    };
+
+    /**
+     * Fixed pool of completion queues with one thread each, shared by
+     * asynchronous gRPC clients.
+     * Every queue event is dispatched to the AsyncCall passed as its tag.
+     * @param queues - number of completion queues
+     */
+    class AsyncClientRuntime {
+     public:
+      explicit AsyncClientRuntime(size_t queues);
+
+      ~AsyncClientRuntime();
+
+      /**
+       * @return runtime shared by the whole process
+       */
+      static std::shared_ptr<AsyncClientRuntime> getDefault();
+
+      /**
+       * Select completion queue for new call in round robin manner
+       * @return completion queue
+       */
+      grpc::CompletionQueue *queue();
+
+     private:
+      /**
+       * Dispatch events of queue until it is shut down
+       * @param queue - completion queue to drain
+       */
+      static void dispatch(grpc::CompletionQueue *queue);
+
+      std::vector<std::unique_ptr<grpc::CompletionQueue>> queues_;
+      std::vector<std::thread> threads_;
+      std::atomic<size_t> next_;
+    };
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_CLIENT_RUNTIME_HPP
@@ -18,49 +18,52 @@
 #ifndef IROHA_ASYNC_GRPC_CLIENT_HPP
 #define IROHA_ASYNC_GRPC_CLIENT_HPP
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <google/protobuf/empty.pb.h>
 #include <grpc++/grpc++.h>
-#include <thread>
+#include <mutex>
+#include "network/impl/async_client_runtime.hpp"
 
 namespace iroha {
   namespace network {
 
     /**
-     * Asynchronous gRPC client which does no processing of server responses
+     * Counters of calls made by asynchronous client
+     */
+    struct AsyncCallMetrics {
+      std::atomic<uint64_t> started{0};
+      std::atomic<uint64_t> succeeded{0};
+      std::atomic<uint64_t> failed{0};
+      std::atomic<uint64_t> last_latency_microseconds{0};
+    };
+
+    /**
+     * Asynchronous gRPC client running on shared completion queues
+     * Each request gets a call object of its own, since ClientContext
+     * can not be reused.
+     * Destruction waits for calls in flight.
      * @tparam Response type of server response
+     * @param runtime completion queues shared between clients
      */
     template <typename Response>
     class AsyncGrpcClient {
      public:
-      AsyncGrpcClient() : thread_(&AsyncGrpcClient::asyncCompleteRpc, this) {}
-
-      /**
-      * Listen to gRPC server responses
-      */
-      void asyncCompleteRpc() {
-        void *got_tag;
-        auto ok = false;
-        while (cq_.Next(&got_tag, &ok)) {
-          auto call = static_cast<AsyncClientCall *>(got_tag);
-
-          delete call;
-        }
-      }
+      explicit AsyncGrpcClient(std::shared_ptr<AsyncClientRuntime> runtime =
+                                   AsyncClientRuntime::getDefault())
+          : runtime_(std::move(runtime)), in_flight_(0) {}
 
       ~AsyncGrpcClient() {
-        cq_.Shutdown();
-        if (thread_.joinable()) {
-          thread_.join();
-        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        finished_.wait(lock, [this] { return in_flight_ == 0; });
       }
 
-      grpc::CompletionQueue cq_;
-      std::thread thread_;
-
       /**
        * State and data information of gRPC call
        */
-      struct AsyncClientCall {
+      struct AsyncClientCall : AsyncCall {
         Response reply;
 
         grpc::ClientContext context;
@@ -69,7 +72,78 @@ namespace iroha {
 
         std::unique_ptr<grpc::ClientAsyncResponseReader<Response>>
             response_reader;
+
+        /**
+         * optional handler of call status, reply and latency
+         */
+        std::function<void(const grpc::Status &,
+                           const Response &,
+                           std::chrono::microseconds)>
+            on_response;
+
+        void onComplete(bool ok) override { client->complete(this); }
+
+        AsyncGrpcClient *client;
+        std::chrono::steady_clock::time_point started;
       };
+
+      /**
+       * Create call object
+       * @return call, which is deleted when completed
+       */
+      AsyncClientCall *makeCall() {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          ++in_flight_;
+        }
+        auto call = std::make_unique<AsyncClientCall>();
+        call->client = this;
+        call->started = std::chrono::steady_clock::now();
+        ++metrics_.started;
+        return call.release();
+      }
+
+      /**
+       * @return completion queue for new call
+       */
+      grpc::CompletionQueue *queue() { return runtime_->queue(); }
+
+      /**
+       * @return counters of calls
+       */
+      const AsyncCallMetrics &callMetrics() const { return metrics_; }
+
+     private:
+      /**
+       * Account and delete finished call
+       * @param raw_call - finished call
+       */
+      void complete(AsyncClientCall *raw_call) {
+        std::unique_ptr<AsyncClientCall> call(raw_call);
+        auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - call->started);
+        metrics_.last_latency_microseconds = latency.count();
+        if (call->status.ok()) {
+          ++metrics_.succeeded;
+        } else {
+          ++metrics_.failed;
+        }
+        if (call->on_response) {
+          call->on_response(call->status, call->reply, latency);
+        }
+        call.reset();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--in_flight_ == 0) {
+          finished_.notify_all();
+        }
+      }
+
+      std::shared_ptr<AsyncClientRuntime> runtime_;
+      size_t in_flight_;
+      std::mutex mutex_;
+      std::condition_variable finished_;
+      AsyncCallMetrics metrics_;
     };
   }  // namespace network
 }  // namespace iroha
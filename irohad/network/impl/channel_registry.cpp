@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "network/impl/channel_registry.hpp"
+#include <algorithm>
+
+namespace iroha {
+  namespace network {
+
+    ChannelRegistry::ChannelRegistry() : log_(logger::log("ChannelRegistry")) {}
+
+    std::shared_ptr<ChannelRegistry> ChannelRegistry::getDefault() {
+      static auto registry = std::make_shared<ChannelRegistry>();
+      return registry;
+    }
+
+    std::shared_ptr<grpc::Channel> ChannelRegistry::getChannel(
+        const std::string &address) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &channel = channels_[address];
+      if (channel == nullptr
+          or channel->GetState(false) == GRPC_CHANNEL_SHUTDOWN) {
+        log_->info("open channel to {}", address);
+        channel =
+            grpc::CreateChannel(address, grpc::InsecureChannelCredentials());
+      }
+      return channel;
+    }
+
+    void ChannelRegistry::retain(
+        const std::string &owner,
+        const std::unordered_set<std::string> &addresses) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto released = std::move(retained_[owner]);
+      retained_[owner] = addresses;
+      for (const auto &address : released) {
+        auto kept = std::any_of(
+            retained_.begin(), retained_.end(), [&address](const auto &other) {
+              return other.second.count(address) != 0;
+            });
+        if (not kept and channels_.erase(address) != 0) {
+          log_->info("evict channel to {}", address);
+        }
+      }
+    }
+
+  }  // namespace network
+}  // namespace iroha
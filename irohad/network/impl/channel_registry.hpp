@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_CHANNEL_REGISTRY_HPP
+#define IROHA_CHANNEL_REGISTRY_HPP
+
+#include <grpc++/grpc++.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Registry of gRPC channels to peers, keyed by peer address.
+     * Channel to a peer is created once and shared by all internal clients,
+     * so connections are not established again for every request round.
+     */
+    class ChannelRegistry {
+     public:
+      ChannelRegistry();
+
+      /**
+       * @return registry shared by the whole process
+       */
+      static std::shared_ptr<ChannelRegistry> getDefault();
+
+      /**
+       * Get channel to given address.
+       * Channel is created on first request and created again
+       * if previous one was shut down.
+       * @param address - peer address in form of host:port
+       * @return channel to the address
+       */
+      std::shared_ptr<grpc::Channel> getChannel(const std::string &address);
+
+      /**
+       * Set addresses the owner keeps channels to. Channels the owner kept
+       * before and no other owner keeps now are evicted, channels which
+       * were never retained are not touched.
+       * Evicted channels are closed when their last client releases them.
+       * @param owner - name of subsystem retaining the channels
+       * @param addresses - current peer addresses of the owner
+       */
+      void retain(const std::string &owner,
+                  const std::unordered_set<std::string> &addresses);
+
+     private:
+      std::mutex mutex_;
+      std::unordered_map<std::string, std::shared_ptr<grpc::Channel>>
+          channels_;
+      std::unordered_map<std::string, std::unordered_set<std::string>>
+          retained_;
+      logger::Logger log_;
+    };
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_CHANNEL_REGISTRY_HPP
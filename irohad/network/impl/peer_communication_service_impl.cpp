@@ -37,6 +37,15 @@ namespace iroha {
       return ordering_gate_->on_proposal();
     }
 
+    bool PeerCommunicationServiceImpl::is_overloaded() {
+      return ordering_gate_->is_overloaded();
+    }
+
+    rxcpp::observable<model::Transaction>
+    PeerCommunicationServiceImpl::on_rejected() {
+      return ordering_gate_->on_rejected();
+    }
+
     rxcpp::observable<Commit> PeerCommunicationServiceImpl::on_commit() {
       return synchronizer_->on_commit_chain();
     }
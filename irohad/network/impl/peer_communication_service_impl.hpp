@@ -37,6 +37,10 @@ namespace iroha {
 
       rxcpp::observable<model::Proposal> on_proposal() override;
 
+      bool is_overloaded() override;
+
+      rxcpp::observable<model::Transaction> on_rejected() override;
+
       rxcpp::observable<Commit> on_commit() override;
 
      private:
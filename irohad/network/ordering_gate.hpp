@@ -43,6 +43,19 @@ namespace iroha {
        */
       virtual rxcpp::observable<model::Proposal> on_proposal() = 0;
 
+      /**
+       * Check whether ordering service rejects transactions due to overload
+       * @return true if transactions should not be propagated now
+       */
+      virtual bool is_overloaded() = 0;
+
+      /**
+       * Return observable of propagated transactions which ordering service
+       * did not accept, they will not appear in any proposal
+       * @return observable with rejected transactions
+       */
+      virtual rxcpp::observable<model::Transaction> on_rejected() = 0;
+
       virtual ~OrderingGate() = default;
     };
   }//namespace network
@@ -47,6 +47,19 @@ namespace iroha {
        */
       virtual rxcpp::observable<model::Proposal> on_proposal() = 0;
 
+      /**
+       * Check whether network can not accept more transactions now
+       * @return true if transaction propagation is overloaded
+       */
+      virtual bool is_overloaded() = 0;
+
+      /**
+       * Event is triggered when propagated transaction is not accepted by
+       * ordering service, e.g. due to its overload
+       * @return observable with rejected transactions
+       */
+      virtual rxcpp::observable<model::Transaction> on_rejected() = 0;
+
       /**
         * Event is triggered when commit block arrives.
         * @return observable with sequence of committed blocks.
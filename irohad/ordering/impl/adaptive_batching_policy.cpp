@@ -0,0 +1,133 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/adaptive_batching_policy.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace iroha {
+  namespace ordering {
+
+    namespace {
+      /**
+       * Weight of new sample in smoothed values
+       */
+      const double SMOOTHING = 0.3;
+
+      /**
+       * Min interval of arrival rate sampling
+       */
+      const std::chrono::milliseconds RATE_WINDOW(100);
+
+      /**
+       * Max number of uncommitted proposals to track
+       */
+      const size_t MAX_TRACKED_PROPOSALS = 100;
+    }  // namespace
+
+    AdaptiveBatchingPolicy::AdaptiveBatchingPolicy(BatchingBounds bounds)
+        : bounds_(bounds),
+          arrivals_(0),
+          last_sample_(Clock::now()),
+          arrival_rate_(0),
+          commit_latency_(0),
+          log_(logger::log("AdaptiveBatching")) {}
+
+    void AdaptiveBatchingPolicy::onTransaction(size_t bytes) { ++arrivals_; }
+
+    void AdaptiveBatchingPolicy::onProposal(size_t height,
+                                            size_t txs,
+                                            size_t bytes) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        proposal_times_[height] = Clock::now();
+        if (proposal_times_.size() > MAX_TRACKED_PROPOSALS) {
+          proposal_times_.erase(proposal_times_.begin());
+        }
+      }
+      ++metrics_.proposals;
+      metrics_.last_proposal_txs = txs;
+      metrics_.last_proposal_bytes = bytes;
+      log_->info(
+          "proposal {}: {} txs, {} bytes, target {} txs, {} tx/s, "
+          "commit latency {} ms",
+          height, txs, bytes, metrics_.target_txs.load(),
+          metrics_.arrival_rate.load(),
+          metrics_.commit_latency_milliseconds.load());
+    }
+
+    void AdaptiveBatchingPolicy::onCommit(size_t height) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = proposal_times_.find(height);
+      if (it == proposal_times_.end()) {
+        return;
+      }
+      double sample = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          Clock::now() - it->second)
+                          .count();
+      commit_latency_ = commit_latency_ == 0
+          ? sample
+          : SMOOTHING * sample + (1 - SMOOTHING) * commit_latency_;
+      proposal_times_.erase(proposal_times_.begin(), std::next(it));
+      metrics_.commit_latency_milliseconds =
+          static_cast<uint64_t>(commit_latency_);
+    }
+
+    BatchDecision AdaptiveBatchingPolicy::decide(size_t queue_size) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto now = Clock::now();
+      auto elapsed =
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              now - last_sample_);
+      if (elapsed >= RATE_WINDOW) {
+        double sample = arrivals_.exchange(0) / double(elapsed.count());
+        arrival_rate_ = SMOOTHING * sample + (1 - SMOOTHING) * arrival_rate_;
+        last_sample_ = now;
+      }
+
+      double max_wait = bounds_.max_wait.count();
+      // until the first commit, the round is assumed to take max wait
+      auto round = commit_latency_ == 0 ? max_wait
+                                        : std::min(commit_latency_, max_wait);
+      // proposal carries transactions arriving during one commit round
+      auto target = static_cast<size_t>(std::ceil(arrival_rate_ * round));
+      target = std::max<size_t>(1, std::min(target, bounds_.max_txs));
+
+      auto wait = bounds_.max_wait;
+      if (arrival_rate_ * max_wait < 1) {
+        // nothing more is expected in time, so waiting only adds latency
+        target = 1;
+      } else if (queue_size < target) {
+        wait = std::min(
+            bounds_.max_wait,
+            std::chrono::milliseconds(static_cast<uint64_t>(
+                std::ceil((target - queue_size) / arrival_rate_))));
+      }
+      wait = std::max(wait, std::chrono::milliseconds(1));
+
+      metrics_.target_txs = target;
+      metrics_.wait_milliseconds = wait.count();
+      metrics_.arrival_rate = static_cast<uint64_t>(arrival_rate_ * 1000);
+      return {target, bounds_.max_txs, bounds_.max_bytes, wait};
+    }
+
+    const BatchingMetrics &AdaptiveBatchingPolicy::metrics() const {
+      return metrics_;
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
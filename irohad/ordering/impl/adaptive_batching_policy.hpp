@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_ADAPTIVE_BATCHING_POLICY_HPP
+#define IROHA_ADAPTIVE_BATCHING_POLICY_HPP
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include "logger/logger.hpp"
+#include "ordering/impl/batching_policy.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Configured limits of proposal
+     */
+    struct BatchingBounds {
+      size_t max_txs = 10000;
+      // leaves room for other fields of proposal message within default
+      // 4 MB limit of gRPC
+      size_t max_bytes = 3 * 1024 * 1024;
+      std::chrono::milliseconds max_wait = std::chrono::milliseconds(5000);
+    };
+
+    /**
+     * Current state of adaptive batching
+     */
+    struct BatchingMetrics {
+      std::atomic<size_t> target_txs{0};
+      std::atomic<uint64_t> wait_milliseconds{0};
+      /**
+       * Transactions per second
+       */
+      std::atomic<uint64_t> arrival_rate{0};
+      std::atomic<uint64_t> commit_latency_milliseconds{0};
+      std::atomic<uint64_t> proposals{0};
+      std::atomic<size_t> last_proposal_txs{0};
+      std::atomic<size_t> last_proposal_bytes{0};
+    };
+
+    /**
+     * Batching policy, which sizes proposals to the number of transactions
+     * arriving during one commit round, within given bounds.
+     * Under low load proposals are emitted without waiting,
+     * under high load they grow up to bounds.
+     */
+    class AdaptiveBatchingPolicy : public BatchingPolicy {
+     public:
+      explicit AdaptiveBatchingPolicy(BatchingBounds bounds);
+
+      void onTransaction(size_t bytes) override;
+
+      void onProposal(size_t height, size_t txs, size_t bytes) override;
+
+      void onCommit(size_t height) override;
+
+      BatchDecision decide(size_t queue_size) override;
+
+      const BatchingMetrics &metrics() const;
+
+     private:
+      using Clock = std::chrono::steady_clock;
+
+      const BatchingBounds bounds_;
+
+      std::atomic<size_t> arrivals_;
+
+      std::mutex mutex_;
+      Clock::time_point last_sample_;
+      /**
+       * Smoothed transactions per millisecond
+       */
+      double arrival_rate_;
+      /**
+       * Smoothed milliseconds from proposal to commit, 0 if unknown
+       */
+      double commit_latency_;
+      std::map<size_t, Clock::time_point> proposal_times_;
+
+      BatchingMetrics metrics_;
+      logger::Logger log_;
+    };
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ADAPTIVE_BATCHING_POLICY_HPP
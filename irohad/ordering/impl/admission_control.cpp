@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/admission_control.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    AdmissionControl::AdmissionControl(AdmissionLimits limits)
+        : limits_(limits), txs_(0), bytes_(0) {}
+
+    bool AdmissionControl::admit(const std::string &source, size_t size) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto admitted = [&] {
+        if (txs_ + 1 > limits_.max_txs or bytes_ + size > limits_.max_bytes) {
+          return false;
+        }
+        auto contended =
+            txs_ * 2 > limits_.max_txs or bytes_ * 2 > limits_.max_bytes;
+        if (not contended) {
+          return true;
+        }
+        auto it = sources_.find(source);
+        auto held = it == sources_.end() ? 0 : it->second;
+        auto active = sources_.size() + (it == sources_.end() ? 1 : 0);
+        return held < limits_.max_txs / active;
+      }();
+
+      if (not admitted) {
+        ++metrics_.rejected;
+        return false;
+      }
+      ++sources_[source];
+      ++txs_;
+      bytes_ += size;
+      ++metrics_.admitted;
+      metrics_.queued_txs = txs_;
+      metrics_.queued_bytes = bytes_;
+      return true;
+    }
+
+    void AdmissionControl::release(const std::string &source, size_t size) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = sources_.find(source);
+      if (it == sources_.end()) {
+        return;
+      }
+      if (--it->second == 0) {
+        sources_.erase(it);
+      }
+      --txs_;
+      bytes_ -= size;
+      metrics_.queued_txs = txs_;
+      metrics_.queued_bytes = bytes_;
+    }
+
+    const AdmissionMetrics &AdmissionControl::metrics() const {
+      return metrics_;
+    }
+  }  // namespace ordering
+}  // namespace iroha
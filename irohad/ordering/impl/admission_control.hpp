@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_ADMISSION_CONTROL_HPP
+#define IROHA_ADMISSION_CONTROL_HPP
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Limits of transactions waiting in ordering queue
+     */
+    struct AdmissionLimits {
+      size_t max_txs = 100000;
+      size_t max_bytes = 256 * 1024 * 1024;
+    };
+
+    /**
+     * Counters of admission control
+     */
+    struct AdmissionMetrics {
+      std::atomic<uint64_t> admitted{0};
+      std::atomic<uint64_t> rejected{0};
+      std::atomic<uint64_t> queued_txs{0};
+      std::atomic<uint64_t> queued_bytes{0};
+    };
+
+    /**
+     * Decides whether transaction may enter ordering queue
+     * Transaction is rejected when queue limits would be exceeded.
+     * When queue is more than half full, source may hold at most its fair
+     * share of queue, so one flooding source can not starve the others
+     * @param limits - limits of queue
+     */
+    class AdmissionControl {
+     public:
+      explicit AdmissionControl(AdmissionLimits limits);
+
+      /**
+       * Reserve place in queue for transaction
+       * @param source - identifier of transaction source
+       * @param size - size of serialized transaction
+       * @return true if transaction is admitted
+       */
+      bool admit(const std::string &source, size_t size);
+
+      /**
+       * Free place of transaction which left queue
+       * @param source - identifier of transaction source
+       * @param size - size of serialized transaction
+       */
+      void release(const std::string &source, size_t size);
+
+      /**
+       * @return counters of admission control
+       */
+      const AdmissionMetrics &metrics() const;
+
+     private:
+      AdmissionLimits limits_;
+
+      /**
+       * number of queued transactions of each source
+       */
+      std::unordered_map<std::string, size_t> sources_;
+      size_t txs_;
+      size_t bytes_;
+      std::mutex mutex_;
+      AdmissionMetrics metrics_;
+    };
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ADMISSION_CONTROL_HPP
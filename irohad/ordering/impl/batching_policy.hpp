@@ -0,0 +1,113 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_BATCHING_POLICY_HPP
+#define IROHA_BATCHING_POLICY_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Decision of batching policy for the next proposal
+     */
+    struct BatchDecision {
+      /**
+       * Proposal is emitted once queue holds this number of transactions
+       */
+      size_t target_txs;
+
+      /**
+       * Max number of transactions in proposal
+       */
+      size_t max_txs;
+
+      /**
+       * Max size of transactions in proposal in bytes
+       */
+      size_t max_bytes;
+
+      /**
+       * Max time to wait for target_txs transactions
+       */
+      std::chrono::milliseconds wait;
+    };
+
+    /**
+     * Policy of collecting transactions into proposals
+     */
+    class BatchingPolicy {
+     public:
+      virtual ~BatchingPolicy() = default;
+
+      /**
+       * Transaction is received by ordering service
+       * @param bytes - size of serialized transaction
+       */
+      virtual void onTransaction(size_t bytes) = 0;
+
+      /**
+       * Proposal is sent to peers
+       * @param height - height of proposal
+       * @param txs - number of transactions in proposal
+       * @param bytes - size of transactions in proposal
+       */
+      virtual void onProposal(size_t height, size_t txs, size_t bytes) = 0;
+
+      /**
+       * Block is committed
+       * @param height - height of committed block
+       */
+      virtual void onCommit(size_t height) = 0;
+
+      /**
+       * Decide how to batch the next proposal
+       * @param queue_size - number of transactions waiting in queue
+       * @return decision for the next proposal
+       */
+      virtual BatchDecision decide(size_t queue_size) = 0;
+    };
+
+    /**
+     * Batching policy with constant proposal size and timeout
+     */
+    class FixedBatchingPolicy : public BatchingPolicy {
+     public:
+      FixedBatchingPolicy(size_t max_size, size_t delay_milliseconds)
+          : decision_{max_size,
+                      max_size,
+                      std::numeric_limits<size_t>::max(),
+                      std::chrono::milliseconds(delay_milliseconds)} {}
+
+      void onTransaction(size_t bytes) override {}
+
+      void onProposal(size_t height, size_t txs, size_t bytes) override {}
+
+      void onCommit(size_t height) override {}
+
+      BatchDecision decide(size_t queue_size) override { return decision_; }
+
+     private:
+      const BatchDecision decision_;
+    };
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_BATCHING_POLICY_HPP
@@ -17,51 +17,304 @@
 
 #include "ordering/impl/ordering_gate_impl.hpp"
 
+namespace {
+  /**
+   * number of own transactions remembered for compact proposals
+   */
+  const size_t POOL_CAPACITY = 100000;
+
+  /**
+   * time to wait for missing transactions from OrderingService
+   */
+  const std::chrono::seconds FETCH_TIMEOUT(2);
+
+  /**
+   * number of requests for missing transactions before proposal is dropped
+   */
+  const size_t FETCH_ATTEMPTS = 3;
+
+  /**
+   * pause before second request for missing transactions, doubled after
+   * each failed request
+   */
+  const std::chrono::milliseconds FETCH_BACKOFF(100);
+
+  /**
+   * number of proposals waiting for delivery, further ones are rejected
+   */
+  const size_t MAX_QUEUED_PROPOSALS = 32;
+
+  /**
+   * time for which propagation stops after overload of OrderingService
+   */
+  const std::chrono::milliseconds OVERLOAD_BACKOFF(500);
+}  // namespace
+
 namespace iroha {
   namespace ordering {
 
-    OrderingGateImpl::OrderingGateImpl(const std::string &server_address)
-        : client_(proto::OrderingService::NewStub(grpc::CreateChannel(
-              server_address, grpc::InsecureChannelCredentials()))) {
+    OrderingGateImpl::OrderingGateImpl(
+        const std::string &server_address,
+        std::shared_ptr<network::ChannelRegistry> channels,
+        size_t max_batch,
+        std::chrono::microseconds max_delay,
+        const std::string &own_address)
+        : client_(proto::OrderingService::NewStub(
+              channels->getChannel(server_address))),
+          pool_(POOL_CAPACITY),
+          overloaded_until_(0),
+          forwarder_(channels->getChannel(server_address),
+                     max_batch,
+                     max_delay,
+                     own_address),
+          stopped_(false) {
       log_ = logger::log("OrderingGate");
+      forwarder_.on_ack().subscribe([this](const auto &ack) {
+        if (ack.overloaded) {
+          overloaded_until_ = (std::chrono::steady_clock::now()
+                               + OVERLOAD_BACKOFF).time_since_epoch().count();
+          log_->warn("ordering service is overloaded");
+        } else if (not ack.accepted) {
+          log_->warn("transaction is not accepted by ordering service");
+        }
+        if (not ack.accepted) {
+          // acknowledgements are published one at a time
+          auto transaction = pool_.get(ack.hash);
+          if (transaction) {
+            rejected_.get_subscriber().on_next(**transaction);
+          }
+        }
+      });
+      delivery_thread_ =
+          std::thread(&OrderingGateImpl::deliverProposals, this);
+    }
+
+    OrderingGateImpl::~OrderingGateImpl() {
+      {
+        std::lock_guard<std::mutex> lock(proposal_mutex_);
+        stopped_ = true;
+      }
+      proposal_cv_.notify_one();
+      if (delivery_thread_.joinable()) {
+        delivery_thread_.join();
+      }
     }
 
     void OrderingGateImpl::propagate_transaction(
         std::shared_ptr<const model::Transaction> transaction) {
       log_->info("propagate tx");
-      auto call = new AsyncClientCall;
-
-      call->response_reader = client_->AsyncSendTransaction(
-          &call->context, factory_.serialize(*transaction), &cq_);
+      auto pb_tx = factory_.serialize(*transaction);
+      auto hash = orderingHash(pb_tx);
+      pool_.add(hash, transaction);
+      forwarder_.forward(std::move(hash), std::move(pb_tx));
+    }
 
-      call->response_reader->Finish(&call->reply, &call->status, call);
+    bool OrderingGateImpl::is_overloaded() {
+      return std::chrono::steady_clock::now().time_since_epoch().count()
+          < overloaded_until_;
     }
 
     rxcpp::observable<model::Proposal> OrderingGateImpl::on_proposal() {
       return proposals_.get_observable();
     }
 
+    rxcpp::observable<model::Transaction> OrderingGateImpl::on_rejected() {
+      return rejected_.get_observable();
+    }
+
     grpc::Status OrderingGateImpl::SendProposal(
         ::grpc::ServerContext *context, const proto::Proposal *request,
         ::google::protobuf::Empty *response) {
       log_->info("receive proposal");
-      // auto removes const qualifier of model::Proposal.transactions
-      auto transactions =
-          decltype(std::declval<model::Proposal>().transactions)();
+      QueuedProposal queued;
+      queued.height = request->height();
       for (const auto &tx : request->transactions()) {
-        transactions.push_back(*factory_.deserialize(tx));
+        queued.transactions.push_back(factory_.deserialize(tx));
       }
-      log_->info("transactions in proposal: {}", transactions.size());
+      log_->info("transactions in proposal: {}", queued.transactions.size());
 
-      model::Proposal proposal(transactions);
-      proposal.height = request->height();
-      handleProposal(std::move(proposal));
+      if (not handleProposal(std::move(queued))) {
+        return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                            "proposal queue is full");
+      }
+      return grpc::Status::OK;
+    }
 
+    grpc::Status OrderingGateImpl::SendCompactProposal(
+        ::grpc::ServerContext *context,
+        const proto::CompactProposal *request,
+        ::google::protobuf::Empty *response) {
+      log_->info("receive compact proposal");
+      std::unordered_map<std::string, const protocol::Transaction *> attached;
+      for (const auto &tx : request->attached().transactions()) {
+        attached.emplace(orderingHash(tx), &tx);
+      }
+
+      // transactions absent here are resolved on delivery thread
+      QueuedProposal queued;
+      queued.height = request->height();
+      for (const auto &hash : request->tx_hashes()) {
+        auto it = attached.find(hash);
+        if (it != attached.end()) {
+          queued.transactions.push_back(factory_.deserialize(*it->second));
+        } else {
+          queued.transactions.push_back(nullptr);
+        }
+        queued.hashes.push_back(hash);
+      }
+      log_->info("transactions in proposal: {}", queued.transactions.size());
+
+      if (not handleProposal(std::move(queued))) {
+        return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                            "proposal queue is full");
+      }
       return grpc::Status::OK;
     }
 
-    void OrderingGateImpl::handleProposal(model::Proposal &&proposal) {
-      proposals_.get_subscriber().on_next(proposal);
+    nonstd::optional<model::Proposal> OrderingGateImpl::resolveProposal(
+        QueuedProposal &proposal) {
+      std::vector<std::string> missing;
+      for (size_t i = 0; i < proposal.transactions.size(); ++i) {
+        if (proposal.transactions[i]) {
+          continue;
+        }
+        auto tx = pool_.get(proposal.hashes[i]);
+        if (tx) {
+          proposal.transactions[i] = std::move(*tx);
+        } else {
+          missing.push_back(proposal.hashes[i]);
+        }
+      }
+      if (not missing.empty()) {
+        log_->info("fetch missing transactions: {}", missing.size());
+        if (not fetchTransactions(missing)) {
+          return nonstd::nullopt;
+        }
+      }
+
+      auto transactions =
+          decltype(std::declval<model::Proposal>().transactions)();
+      for (size_t i = 0; i < proposal.transactions.size(); ++i) {
+        auto tx = proposal.transactions[i];
+        if (not tx) {
+          auto pooled = pool_.get(proposal.hashes[i]);
+          if (not pooled) {
+            log_->error("transaction of proposal {} is unavailable",
+                        proposal.height);
+            return nonstd::nullopt;
+          }
+          tx = std::move(*pooled);
+        }
+        transactions.push_back(*tx);
+      }
+
+      model::Proposal result(std::move(transactions));
+      result.height = proposal.height;
+      return result;
+    }
+
+    bool OrderingGateImpl::fetchTransactions(
+        const std::vector<std::string> &hashes) {
+      proto::TransactionsRequest request;
+      for (const auto &hash : hashes) {
+        request.add_tx_hashes(hash);
+      }
+      auto backoff = FETCH_BACKOFF;
+      for (size_t attempt = 1; attempt <= FETCH_ATTEMPTS; ++attempt) {
+        if (tryFetchTransactions(request)) {
+          return true;
+        }
+        if (attempt < FETCH_ATTEMPTS) {
+          log_->warn("retry fetch of transactions in {} ms",
+                     backoff.count());
+          // destruction of gate is not delayed by backoff
+          std::unique_lock<std::mutex> lock(proposal_mutex_);
+          if (proposal_cv_.wait_for(
+                  lock, backoff, [this] { return stopped_; })) {
+            return false;
+          }
+          backoff *= 2;
+        }
+      }
+      return false;
+    }
+
+    bool OrderingGateImpl::tryFetchTransactions(
+        const proto::TransactionsRequest &request) {
+      proto::Transactions response;
+      grpc::ClientContext context;
+      context.set_deadline(std::chrono::system_clock::now() + FETCH_TIMEOUT);
+
+      auto status = client_->FetchTransactions(&context, request, &response);
+      if (not status.ok()) {
+        log_->error("fetch transactions failed: {}", status.error_message());
+        return false;
+      }
+      for (const auto &tx : response.transactions()) {
+        pool_.add(orderingHash(tx), factory_.deserialize(tx));
+      }
+      return true;
+    }
+
+    const ProposalDeliveryMetrics &OrderingGateImpl::deliveryMetrics() const {
+      return delivery_metrics_;
+    }
+
+    bool OrderingGateImpl::handleProposal(QueuedProposal &&proposal) {
+      {
+        std::lock_guard<std::mutex> lock(proposal_mutex_);
+        if (proposal_queue_.size() >= MAX_QUEUED_PROPOSALS) {
+          ++delivery_metrics_.dropped;
+          log_->error("drop proposal {}, delivery queue is full",
+                      proposal.height);
+          return false;
+        }
+        proposal.received = std::chrono::steady_clock::now();
+        proposal_queue_.push_back(std::move(proposal));
+        delivery_metrics_.queue_size = proposal_queue_.size();
+      }
+      proposal_cv_.notify_one();
+      return true;
+    }
+
+    void OrderingGateImpl::deliverProposals() {
+      std::unique_lock<std::mutex> lock(proposal_mutex_);
+      while (true) {
+        proposal_cv_.wait(
+            lock, [this] { return stopped_ or not proposal_queue_.empty(); });
+        if (stopped_) {
+          return;
+        }
+        auto queued = std::move(proposal_queue_.front());
+        proposal_queue_.pop_front();
+        delivery_metrics_.queue_size = proposal_queue_.size();
+        lock.unlock();
+
+        auto proposal = resolveProposal(queued);
+        if (not proposal) {
+          ++delivery_metrics_.dropped;
+          log_->error("drop proposal {}, its transactions are unavailable",
+                      queued.height);
+          lock.lock();
+          continue;
+        }
+
+        uint64_t delay =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - queued.received)
+                .count();
+        delivery_metrics_.last_delay_microseconds = delay;
+        if (delay > delivery_metrics_.max_delay_microseconds) {
+          delivery_metrics_.max_delay_microseconds = delay;
+        }
+        log_->info("deliver proposal {}, queue delay {} us",
+                   proposal->height,
+                   delay);
+        proposals_.get_subscriber().on_next(*proposal);
+        ++delivery_metrics_.delivered;
+
+        lock.lock();
+      }
     }
   }  // namespace ordering
 }  // namespace iroha
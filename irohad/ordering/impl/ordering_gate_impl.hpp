@@ -18,9 +18,19 @@
 #ifndef IROHA_ORDERING_GATE_IMPL_HPP
 #define IROHA_ORDERING_GATE_IMPL_HPP
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <nonstd/optional.hpp>
+#include <thread>
+#include <unordered_map>
 #include "model/converters/pb_transaction_factory.hpp"
-#include "network/impl/async_grpc_client.hpp"
+#include "network/impl/channel_registry.hpp"
 #include "network/ordering_gate.hpp"
+#include "ordering/impl/ordering_hash.hpp"
+#include "ordering/impl/transaction_forwarder.hpp"
+#include "ordering/impl/transaction_pool.hpp"
 #include "ordering.grpc.pb.h"
 
 #include "logger/logger.hpp"
@@ -28,40 +38,161 @@
 namespace iroha {
   namespace ordering {
 
+    /**
+     * Counters of proposal delivery to on_proposal subscribers
+     */
+    struct ProposalDeliveryMetrics {
+      std::atomic<uint64_t> delivered{0};
+      // proposals dropped because queue was full or transactions were
+      // not fetched
+      std::atomic<uint64_t> dropped{0};
+      std::atomic<uint64_t> queue_size{0};
+      std::atomic<uint64_t> last_delay_microseconds{0};
+      std::atomic<uint64_t> max_delay_microseconds{0};
+    };
+
     /**
      * OrderingGate implementation with gRPC asynchronous client
      * Interacts with given OrderingService
-     * by propagating transactions and receiving proposals
+     * by propagating transactions in batches and receiving proposals
+     * Propagated transactions are kept in pool, so compact proposals
+     * referencing them by hash are resolved locally, other transactions
+     * are attached to proposal by OrderingService
+     * Received proposals are queued and delivered to subscribers on
+     * dedicated thread, so gRPC handlers return without waiting for
+     * validation or for missing transactions
+     * Transactions missing in both are fetched on delivery thread, failed
+     * fetch is retried
+     * Queue is bounded, proposal above the bound is rejected
      * @param server_address OrderingService address
+     * @param channels registry of channels to peers
+     * @param max_batch maximum number of transactions forwarded at once
+     * @param max_delay maximum time transaction waits for forwarding
+     * @param own_address address of this gate, OrderingService does not
+     * attach transactions forwarded from it
      */
     class OrderingGateImpl : public network::OrderingGate,
-                             public proto::OrderingGate::Service,
-                             network::AsyncGrpcClient<google::protobuf::Empty> {
+                             public proto::OrderingGate::Service {
      public:
 
-      explicit OrderingGateImpl(const std::string &server_address);
+      explicit OrderingGateImpl(
+          const std::string &server_address,
+          std::shared_ptr<network::ChannelRegistry> channels =
+              network::ChannelRegistry::getDefault(),
+          size_t max_batch = 500,
+          std::chrono::microseconds max_delay =
+              std::chrono::microseconds(2000),
+          const std::string &own_address = "");
+
+      ~OrderingGateImpl() override;
 
       void propagate_transaction(
           std::shared_ptr<const model::Transaction> transaction) override;
 
       rxcpp::observable<model::Proposal> on_proposal() override;
 
+      /**
+       * Gate is overloaded for a while after OrderingService rejected
+       * transaction due to overload
+       */
+      bool is_overloaded() override;
+
+      /**
+       * Transactions acknowledged by OrderingService as not accepted
+       */
+      rxcpp::observable<model::Transaction> on_rejected() override;
+
       grpc::Status SendProposal(::grpc::ServerContext *context,
                                 const proto::Proposal *request,
                                 ::google::protobuf::Empty *response) override;
 
+      /**
+       * Receive proposal which carries transaction hashes and transactions
+       * not forwarded by this gate
+       * Transactions missing in pool are fetched from OrderingService
+       * before delivery
+       */
+      grpc::Status SendCompactProposal(
+          ::grpc::ServerContext *context,
+          const proto::CompactProposal *request,
+          ::google::protobuf::Empty *response) override;
+
+      /**
+       * @return counters of proposal delivery
+       */
+      const ProposalDeliveryMetrics &deliveryMetrics() const;
+
      private:
+      /**
+       * Proposal with time it was received
+       * Transactions absent on receipt are null, they are looked up in pool
+       * or fetched by their hashes before delivery
+       */
+      struct QueuedProposal {
+        uint64_t height;
+        std::vector<std::string> hashes;
+        std::vector<std::shared_ptr<const model::Transaction>> transactions;
+        std::chrono::steady_clock::time_point received;
+      };
+
+      /**
+       * Request transactions absent in pool from OrderingService
+       * Request is retried with growing backoff until attempts run out or
+       * gate is stopped
+       * Received transactions are stored in pool
+       * @param hashes - hashes of transactions to fetch
+       * @return true if request succeeded
+       */
+      bool fetchTransactions(const std::vector<std::string> &hashes);
+
+      /**
+       * Single request of transactions from OrderingService
+       * @param request - hashes of transactions to fetch
+       * @return true if request succeeded
+       */
+      bool tryFetchTransactions(const proto::TransactionsRequest &request);
+
       /**
        * Process proposal received from network
-       * Publishes proposal to on_proposal subscribers
+       * Enqueues proposal for delivery to on_proposal subscribers
        * @param proposal
+       * @return false if queue is full and proposal is dropped
+       */
+      bool handleProposal(QueuedProposal &&proposal);
+
+      /**
+       * Resolve transactions absent on receipt from pool or by fetching
+       * @param proposal - queued proposal
+       * @return proposal with all transactions, none if some are missing
        */
-      void handleProposal(model::Proposal &&proposal);
+      nonstd::optional<model::Proposal> resolveProposal(
+          QueuedProposal &proposal);
+
+      /**
+       * Publish queued proposals to on_proposal subscribers one by one
+       */
+      void deliverProposals();
 
       rxcpp::subjects::subject<model::Proposal> proposals_;
+      rxcpp::subjects::subject<model::Transaction> rejected_;
       model::converters::PbTransactionFactory factory_;
       std::unique_ptr<proto::OrderingService::Stub> client_;
+      TransactionPool<std::shared_ptr<const model::Transaction>> pool_;
+
+      /**
+       * time until which gate is overloaded, in steady clock ticks
+       */
+      std::atomic<std::chrono::steady_clock::rep> overloaded_until_;
+
       logger::Logger log_;
+      TransactionForwarder forwarder_;
+
+      std::deque<QueuedProposal> proposal_queue_;
+      bool stopped_;
+      std::mutex proposal_mutex_;
+      std::condition_variable proposal_cv_;
+      ProposalDeliveryMetrics delivery_metrics_;
+      std::thread delivery_thread_;
     };
   }  // namespace ordering
 }  // namespace iroha
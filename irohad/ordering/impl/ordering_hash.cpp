@@ -0,0 +1,33 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/ordering_hash.hpp"
+#include "crypto/hash.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    std::string orderingHash(const protocol::Transaction &transaction) {
+      // buffer keeps its capacity, so serialization does not allocate
+      thread_local std::string bytes;
+      transaction.SerializeToString(&bytes);
+      return sha3_256(reinterpret_cast<const uint8_t *>(bytes.data()),
+                      bytes.size())
+          .to_string();
+    }
+  }  // namespace ordering
+}  // namespace iroha
@@ -0,0 +1,39 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_ORDERING_HASH_HPP
+#define IROHA_ORDERING_HASH_HPP
+
+#include <string>
+#include "block.pb.h"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Compute hash which identifies transaction on its way through ordering
+     * Hash is taken over serialized transaction, so every peer computes the
+     * same value without conversion to model
+     * Hash is never taken from other peers, receiver computes it itself
+     * @param transaction - transaction in transport form
+     * @return hash in binary form
+     */
+    std::string orderingHash(const protocol::Transaction &transaction);
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ORDERING_HASH_HPP
@@ -17,101 +17,308 @@
 
 #include "ordering/impl/ordering_service_impl.hpp"
 
+#include <algorithm>
+
 /**
  * Will be published when transaction is received.
  */
 struct TransactionEvent {};
 
+namespace {
+  /**
+   * number of proposed transactions kept for peers fetching them
+   */
+  const size_t POOL_CAPACITY = 100000;
+
+  /**
+   * number of hashes remembered to detect retried transactions
+   */
+  const size_t SEEN_CAPACITY = 1000000;
+
+  /**
+   * time for which retried transaction is dropped
+   */
+  const std::chrono::minutes SEEN_TTL(10);
+
+  /**
+   * @param address - address in form host:port, IPv6 host is in brackets
+   * @return host of the address, IPv4 mapped to IPv6 is given as IPv4
+   */
+  std::string hostOf(const std::string &address) {
+    auto colon = address.rfind(':');
+    auto host =
+        colon == std::string::npos ? address : address.substr(0, colon);
+    if (host.size() >= 2 and host.front() == '[' and host.back() == ']') {
+      host = host.substr(1, host.size() - 2);
+    }
+    const std::string mapped = "::ffff:";
+    if (host.compare(0, mapped.size(), mapped) == 0) {
+      host = host.substr(mapped.size());
+    }
+    return host;
+  }
+
+  /**
+   * @param peer - address of calling peer as reported by gRPC, e.g.
+   * ipv4:127.0.0.1:34512 or ipv6:[::ffff:127.0.0.1]:34512
+   * @return host of calling peer
+   */
+  std::string callerHost(const std::string &peer) {
+    return hostOf(peer.substr(peer.find(':') + 1));
+  }
+}  // namespace
+
 namespace iroha {
   namespace ordering {
     OrderingServiceImpl::OrderingServiceImpl(
         std::shared_ptr<ametsuchi::PeerQuery> wsv, size_t max_size,
-        size_t delay_milliseconds, std::shared_ptr<uvw::Loop> loop)
+        size_t delay_milliseconds, std::shared_ptr<uvw::Loop> loop,
+        std::shared_ptr<network::ChannelRegistry> channels,
+        AdmissionLimits limits)
+        : OrderingServiceImpl(std::move(wsv),
+                              std::make_shared<FixedBatchingPolicy>(
+                                  max_size, delay_milliseconds),
+                              std::move(loop),
+                              std::move(channels),
+                              limits) {}
+
+    OrderingServiceImpl::OrderingServiceImpl(
+        std::shared_ptr<ametsuchi::PeerQuery> wsv,
+        std::shared_ptr<BatchingPolicy> policy,
+        std::shared_ptr<uvw::Loop> loop,
+        std::shared_ptr<network::ChannelRegistry> channels,
+        AdmissionLimits limits,
+        size_t ledger_height)
         : loop_(std::move(loop)),
           timer_(loop_->resource<uvw::TimerHandle>()),
           wsv_(wsv),
-          max_size_(max_size),
-          delay_milliseconds_(delay_milliseconds),
-          proposal_height(2) {
+          channels_(std::move(channels)),
+          pool_(POOL_CAPACITY),
+          replay_filter_(SEEN_CAPACITY, SEEN_TTL),
+          admission_(limits),
+          policy_(std::move(policy)),
+          proposal_height(ledger_height + 1) {
+      log_ = logger::log("OrderingService");
 
       timer_->on<uvw::TimerEvent>([this](const auto &, auto &) {
-        if (!queue_.empty()) {
-          this->generateProposal();
+        auto queue_size = this->queueSize();
+        if (queue_size != 0) {
+          this->generateProposal(policy_->decide(queue_size));
         }
-        timer_->start(uvw::TimerHandle::Time(delay_milliseconds_),
-                      uvw::TimerHandle::Time(0));
+        this->startTimer();
       });
 
       this->on<TransactionEvent>([this](const auto &, auto &) {
-        if (queue_.unsafe_size() >= max_size_) {
+        auto queue_size = this->queueSize();
+        auto decision = policy_->decide(queue_size);
+        if (queue_size >= decision.target_txs) {
           timer_->stop();
-          this->generateProposal();
-          timer_->start(uvw::TimerHandle::Time(delay_milliseconds_),
-                        uvw::TimerHandle::Time(0));
+          this->generateProposal(decision);
+          this->startTimer();
         }
       });
 
-      timer_->start(uvw::TimerHandle::Time(delay_milliseconds_),
-                    uvw::TimerHandle::Time(0));
+      this->startTimer();
     }
 
     grpc::Status OrderingServiceImpl::SendTransaction(
         ::grpc::ServerContext *context, const protocol::Transaction *request,
         ::google::protobuf::Empty *response) {
-      handleTransaction(std::move(*factory_.deserialize(*request)));
+      if (not handleTransaction(
+              std::make_shared<protocol::Transaction>(*request),
+              callerHost(context->peer()),
+              "")) {
+        return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                            "ordering queue is overloaded");
+      }
 
       return grpc::Status::OK;
     }
 
-    void OrderingServiceImpl::handleTransaction(
-        model::Transaction &&transaction) {
-      queue_.push(transaction);
+    grpc::Status OrderingServiceImpl::SendTransactions(
+        ::grpc::ServerContext *context,
+        const proto::Transactions *request,
+        proto::TransactionAcks *response) {
+      // origin is trusted only if it is on the calling host, otherwise any
+      // peer could make proposals to another peer go without transactions
+      auto source = callerHost(context->peer());
+      auto origin = request->origin();
+      if (hostOf(origin) != source) {
+        origin.clear();
+      }
+      for (const auto &tx : request->transactions()) {
+        // request is owned by gRPC, transaction is copied once here
+        auto accepted = handleTransaction(
+            std::make_shared<protocol::Transaction>(tx), source, origin);
+        auto ack = response->add_acks();
+        ack->set_accepted(accepted);
+        ack->set_overloaded(not accepted);
+      }
 
-      publish(TransactionEvent{});
+      return grpc::Status::OK;
+    }
+
+    grpc::Status OrderingServiceImpl::FetchTransactions(
+        ::grpc::ServerContext *context,
+        const proto::TransactionsRequest *request,
+        proto::Transactions *response) {
+      for (const auto &hash : request->tx_hashes()) {
+        auto tx = pool_.get(hash);
+        if (tx) {
+          *response->add_transactions() = **tx;
+        }
+      }
+      return grpc::Status::OK;
     }
 
-    void OrderingServiceImpl::generateProposal() {
-      auto txs = decltype(std::declval<model::Proposal>().transactions)();
-      for (model::Transaction tx;
-           txs.size() < max_size_ and queue_.try_pop(tx);) {
-        txs.push_back(std::move(tx));
+    void OrderingServiceImpl::onCommit(size_t height) {
+      {
+        std::lock_guard<std::mutex> lock(proposal_mutex_);
+        proposal_height = std::max(proposal_height, height + 1);
       }
+      policy_->onCommit(height);
+    }
 
-      model::Proposal proposal(txs);
-      proposal.height = proposal_height++;
+    const ReplayFilterMetrics &OrderingServiceImpl::replayMetrics() const {
+      return replay_filter_.metrics();
+    }
 
-      publishProposal(std::move(proposal));
+    const AdmissionMetrics &OrderingServiceImpl::admissionMetrics() const {
+      return admission_.metrics();
     }
 
-    void OrderingServiceImpl::publishProposal(model::Proposal &&proposal) {
-      preparePeersForProposalRound();
-      proto::Proposal pb_proposal;
-      pb_proposal.set_height(proposal.height);
-      for (const auto &tx : proposal.transactions) {
-        auto pb_tx = pb_proposal.add_transactions();
-        new(pb_tx) protocol::Transaction(factory_.serialize(tx));
+    bool OrderingServiceImpl::handleTransaction(
+        std::shared_ptr<const protocol::Transaction> transaction,
+        std::string source,
+        std::string origin) {
+      auto hash = orderingHash(*transaction);
+      size_t size = transaction->ByteSize();
+      if (not admission_.admit(source, size)) {
+        log_->warn("reject transaction from {}, ordering queue is overloaded",
+                   source);
+        return false;
+      }
+      // filter is checked after admission, so rejected transaction may be
+      // retried later
+      if (not replay_filter_.insert(hash)) {
+        admission_.release(source, size);
+        log_->info("drop duplicate transaction, dropped total: {}",
+                   replay_filter_.metrics().duplicates.load());
+        return true;
       }
+      queue_.push(QueuedTransaction{std::move(transaction),
+                                    std::move(hash),
+                                    size,
+                                    std::move(source),
+                                    std::move(origin)});
+      policy_->onTransaction(size);
 
+      publish(TransactionEvent{});
+      return true;
+    }
+
+    size_t OrderingServiceImpl::queueSize() {
+      std::lock_guard<std::mutex> lock(proposal_mutex_);
+      return queue_.unsafe_size() + (carried_ ? 1 : 0);
+    }
+
+    void OrderingServiceImpl::startTimer() {
+      timer_->start(uvw::TimerHandle::Time(policy_->decide(queueSize()).wait),
+                    uvw::TimerHandle::Time(0));
+    }
+
+    void OrderingServiceImpl::generateProposal(const BatchDecision &decision) {
+      std::lock_guard<std::mutex> lock(proposal_mutex_);
+      std::vector<QueuedTransaction> proposed;
+      size_t bytes = 0;
+      QueuedTransaction queued;
+      while (proposed.size() < decision.max_txs) {
+        if (carried_) {
+          queued = std::move(*carried_);
+          carried_ = nonstd::nullopt;
+        } else if (not queue_.try_pop(queued)) {
+          break;
+        }
+        // single transaction above the limit still makes a proposal
+        if (not proposed.empty()
+            and bytes + queued.size > decision.max_bytes) {
+          carried_ = std::move(queued);
+          break;
+        }
+        bytes += queued.size;
+        admission_.release(queued.source, queued.size);
+        pool_.add(queued.hash, queued.transaction);
+        proposed.push_back(std::move(queued));
+      }
+      if (proposed.empty()) {
+        return;
+      }
+
+      auto height = proposal_height++;
+      policy_->onProposal(height, proposed.size(), bytes);
+      publishProposal(height, proposed);
+    }
+
+    void OrderingServiceImpl::publishProposal(
+        size_t height, const std::vector<QueuedTransaction> &transactions) {
+      preparePeersForProposalRound();
       for (const auto &peer : peers_) {
-        auto call = new AsyncClientCall;
+        proto::CompactProposal pb_proposal;
+        pb_proposal.set_height(height);
+        auto attached = pb_proposal.mutable_attached();
+        for (const auto &tx : transactions) {
+          pb_proposal.add_tx_hashes(tx.hash);
+          // peer keeps transactions forwarded by itself
+          if (tx.origin != peer.first) {
+            *attached->add_transactions() = *tx.transaction;
+          }
+        }
 
-        call->response_reader =
-            peer.second->AsyncSendProposal(&call->context, pb_proposal, &cq_);
+        auto call = makeCall();
+        call->on_response = [log = log_, address = peer.first](
+            const auto &status, const auto &, auto) {
+          if (not status.ok()) {
+            log->warn("proposal is not delivered to {}: {}",
+                      address,
+                      status.error_message());
+          }
+        };
 
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        call->response_reader = peer.second->AsyncSendCompactProposal(
+            &call->context, pb_proposal, queue());
+
+        call->response_reader->Finish(
+            &call->reply, &call->status, call->tag());
       }
     }
 
     void OrderingServiceImpl::preparePeersForProposalRound() {
-      peers_.clear();
       auto round_peers = wsv_->getLedgerPeers();
       if (not round_peers.has_value()) {
         // todo log error
         return;
       }
+      std::unordered_set<std::string> addresses;
       for (const auto &peer : round_peers.value()) {
-        peers_[peer.address] = proto::OrderingGate::NewStub(grpc::CreateChannel(
-            peer.address, grpc::InsecureChannelCredentials()));
+        addresses.insert(peer.address);
+      }
+      auto changed = addresses.size() != peers_.size();
+      for (auto it = peers_.begin(); it != peers_.end();) {
+        if (addresses.count(it->first) == 0) {
+          it = peers_.erase(it);
+          changed = true;
+        } else {
+          ++it;
+        }
+      }
+      for (const auto &address : addresses) {
+        if (peers_.count(address) == 0) {
+          peers_[address] =
+              proto::OrderingGate::NewStub(channels_->getChannel(address));
+        }
+      }
+      if (changed) {
+        channels_->retain("OrderingService", addresses);
       }
     }
 
@@ -19,14 +19,22 @@
 #define IROHA_ORDERING_SERVICE_IMPL_HPP
 
 #include <memory>
+#include <mutex>
+#include <nonstd/optional.hpp>
 #include <tbb/concurrent_queue.h>
 #include <unordered_map>
+#include <unordered_set>
 #include <uvw.hpp>
-#include "model/converters/pb_transaction_factory.hpp"
-#include "model/proposal.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/channel_registry.hpp"
+#include "ordering/impl/admission_control.hpp"
+#include "ordering/impl/batching_policy.hpp"
+#include "ordering/impl/ordering_hash.hpp"
+#include "ordering/impl/replay_filter.hpp"
+#include "ordering/impl/transaction_pool.hpp"
 #include "ordering.grpc.pb.h"
 #include "ametsuchi/peer_query.hpp"
+#include "logger/logger.hpp"
 
 namespace iroha {
   namespace ordering {
@@ -35,9 +43,29 @@ namespace iroha {
      * OrderingService implementation with gRPC synchronous server
      * Allows receiving transactions concurrently from multiple peers by using
      * concurrent queue
-     * Sends proposal by given timer interval and proposal size
-     * @param delay_milliseconds timer delay
-     * @param max_size proposal size
+     * Sends proposal by timer interval and proposal size given by
+     * batching policy
+     * Proposals are sent to peers as transaction hashes, transactions which
+     * peer did not forward itself are attached, transactions of recent
+     * proposals are kept in pool to serve FetchTransactions
+     * Bodies still leave through the uplink of ordering service: with
+     * client traffic spread over N peers, a peer saves about 1/N of full
+     * proposal, not all of it
+     * Origin of forwarded transactions is taken only from the calling host
+     * Transactions seen recently are dropped before entering the queue
+     * Queue is bounded, transactions above limits are rejected as overload
+     * Fair share of queue is held by the calling host, not by creator account
+     * which client may change at will; clients behind the same peer share
+     * its part, and their fairness is up to the validation queue of the peer
+     * Proposal heights follow the ledger: the first one is above ledger top
+     * and each commit moves the next one above the committed block, so
+     * batching policy sees the same heights in proposals and commits
+     * @param delay_milliseconds timer delay of fixed policy
+     * @param max_size proposal size of fixed policy
+     * @param policy batching policy
+     * @param channels registry of channels to peers
+     * @param limits limits of ordering queue
+     * @param ledger_height height of top block in ledger on start
      */
     class OrderingServiceImpl
         : public proto::OrderingService::Service,
@@ -47,57 +75,153 @@ namespace iroha {
       OrderingServiceImpl(
           std::shared_ptr<ametsuchi::PeerQuery> wsv, size_t max_size,
           size_t delay_milliseconds,
-          std::shared_ptr<uvw::Loop> loop = uvw::Loop::getDefault());
+          std::shared_ptr<uvw::Loop> loop = uvw::Loop::getDefault(),
+          std::shared_ptr<network::ChannelRegistry> channels =
+              network::ChannelRegistry::getDefault(),
+          AdmissionLimits limits = AdmissionLimits());
+      OrderingServiceImpl(
+          std::shared_ptr<ametsuchi::PeerQuery> wsv,
+          std::shared_ptr<BatchingPolicy> policy,
+          std::shared_ptr<uvw::Loop> loop = uvw::Loop::getDefault(),
+          std::shared_ptr<network::ChannelRegistry> channels =
+              network::ChannelRegistry::getDefault(),
+          AdmissionLimits limits = AdmissionLimits(),
+          size_t ledger_height = 1);
       grpc::Status SendTransaction(
           ::grpc::ServerContext *context, const protocol::Transaction *request,
           ::google::protobuf::Empty *response) override;
+
+      /**
+       * Enqueue batch of transactions forwarded by OrderingGate
+       * Acknowledges each transaction in order of request
+       * Origin of batch is ignored unless its host is the calling host,
+       * peers known by host name are always sent bodies therefore
+       */
+      grpc::Status SendTransactions(
+          ::grpc::ServerContext *context,
+          const proto::Transactions *request,
+          proto::TransactionAcks *response) override;
+
+      /**
+       * Return transactions of recent proposals with requested hashes
+       * Unknown hashes are skipped
+       */
+      grpc::Status FetchTransactions(
+          ::grpc::ServerContext *context,
+          const proto::TransactionsRequest *request,
+          proto::Transactions *response) override;
       ~OrderingServiceImpl() override;
 
+      /**
+       * Notify batching policy about committed block, next proposal is
+       * placed above this block if proposals are behind the ledger
+       * @param height - height of committed block
+       */
+      void onCommit(size_t height);
+
+      /**
+       * @return counters of duplicate transactions filter
+       */
+      const ReplayFilterMetrics &replayMetrics() const;
+
+      /**
+       * @return counters of ordering queue admission
+       */
+      const AdmissionMetrics &admissionMetrics() const;
+
      private:
+      /**
+       * Transaction in transport form with its ordering hash, size and
+       * address of OrderingGate which forwarded it
+       */
+      struct QueuedTransaction {
+        std::shared_ptr<const protocol::Transaction> transaction;
+        std::string hash;
+        size_t size;
+        std::string source;
+        std::string origin;
+      };
+
       /**
        * Process transaction received from network
-       * Enqueues transaction and publishes corresponding event
-       * @param transaction
+       * Computes its ordering hash, enqueues transaction and publishes
+       * corresponding event
+       * Transaction which was seen recently is dropped
+       * @param transaction - transaction in transport form, shared by queue
+       * and pool without copying
+       * @param source - host which sent transaction, its share of queue is
+       * limited under contention
+       * @param origin - address of forwarding OrderingGate, empty if unknown
+       * @return false if transaction is rejected due to overload
        */
-      void handleTransaction(model::Transaction &&transaction);
+      bool handleTransaction(
+          std::shared_ptr<const protocol::Transaction> transaction,
+          std::string source,
+          std::string origin);
 
       /**
-       * Collect transactions from queue
+       * Collect transactions from queue within limits of decision
        * Passes the generated proposal to publishProposal
+       * @param decision - decision of batching policy
+       */
+      void generateProposal(const BatchDecision &decision);
+
+      /**
+       * @return number of transactions waiting for proposal
        */
-      void generateProposal();
+      size_t queueSize();
 
       /**
-       * Transform model proposal to transport object and send to peers
-       * @param proposal - object for propagation
+       * Start timer with wait decided by batching policy
        */
-      void publishProposal(model::Proposal &&proposal);
+      void startTimer();
+
+      /**
+       * Make compact proposal for each peer and send it
+       * Transactions forwarded by other peers are attached to proposal
+       * @param height - height of proposal
+       * @param transactions - transactions of proposal
+       */
+      void publishProposal(
+          size_t height, const std::vector<QueuedTransaction> &transactions);
 
       /**
        * Method update peers for sending proposal
+       * Stubs of unchanged peers are reused
        */
       void preparePeersForProposalRound();
 
       std::shared_ptr<uvw::Loop> loop_;
       std::shared_ptr<uvw::TimerHandle> timer_;
       std::shared_ptr<ametsuchi::PeerQuery> wsv_;
-
-      model::converters::PbTransactionFactory factory_;
+      std::shared_ptr<network::ChannelRegistry> channels_;
 
       std::unordered_map<std::string,
                          std::unique_ptr<proto::OrderingGate::Stub>> peers_;
 
-      tbb::concurrent_queue<model::Transaction> queue_;
+      tbb::concurrent_queue<QueuedTransaction> queue_;
 
       /**
-       * max number of txs in proposal
+       * transactions of published proposals
        */
-      const size_t max_size_;
+      TransactionPool<std::shared_ptr<const protocol::Transaction>> pool_;
+
+      ReplayFilter replay_filter_;
+      AdmissionControl admission_;
+      logger::Logger log_;
 
       /**
-       *  wait for specified time if queue is empty
+       * transaction taken from queue, which did not fit into proposal
        */
-      const size_t delay_milliseconds_;
+      nonstd::optional<QueuedTransaction> carried_;
+
+      /**
+       * guards proposal generation, which is triggered from timer and
+       * from transaction handlers
+       */
+      std::mutex proposal_mutex_;
+
+      std::shared_ptr<BatchingPolicy> policy_;
       size_t proposal_height;
     };
   }  // namespace ordering
@@ -0,0 +1,50 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/replay_filter.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    ReplayFilter::ReplayFilter(size_t capacity, Clock::duration ttl)
+        : seen_(capacity), ttl_(ttl) {}
+
+    bool ReplayFilter::insert(const std::string &hash) {
+      auto now = Clock::now();
+      std::lock_guard<std::mutex> lock(mutex_);
+      expire(now);
+      if (seen_.exists(hash)) {
+        ++metrics_.duplicates;
+        return false;
+      }
+      seen_.set(hash, now);
+      ++metrics_.accepted;
+      return true;
+    }
+
+    const ReplayFilterMetrics &ReplayFilter::metrics() const {
+      return metrics_;
+    }
+
+    void ReplayFilter::expire(Clock::time_point now) {
+      while (not seen_.empty() and seen_[seen_.front()] + ttl_ <= now) {
+        seen_.pop();
+        ++metrics_.expired;
+      }
+    }
+  }  // namespace ordering
+}  // namespace iroha
@@ -0,0 +1,78 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_REPLAY_FILTER_HPP
+#define IROHA_REPLAY_FILTER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <map_queue/map_queue.hpp>
+#include <mutex>
+#include <string>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Counters of replay filter
+     */
+    struct ReplayFilterMetrics {
+      std::atomic<uint64_t> accepted{0};
+      std::atomic<uint64_t> duplicates{0};
+      std::atomic<uint64_t> expired{0};
+    };
+
+    /**
+     * Set of recently seen transaction hashes
+     * Hash is remembered for ttl, but at most capacity hashes are kept
+     * @param capacity - maximum number of remembered hashes
+     * @param ttl - time for which hash is remembered
+     */
+    class ReplayFilter {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      ReplayFilter(size_t capacity, Clock::duration ttl);
+
+      /**
+       * Remember hash if it was not seen
+       * @param hash - hash of transaction
+       * @return true if hash was not seen during ttl
+       */
+      bool insert(const std::string &hash);
+
+      /**
+       * @return counters of filter
+       */
+      const ReplayFilterMetrics &metrics() const;
+
+     private:
+      /**
+       * Forget hashes older than ttl
+       * @param now - current time
+       */
+      void expire(Clock::time_point now);
+
+      structure::MapQueue<std::string, Clock::time_point> seen_;
+      Clock::duration ttl_;
+      std::mutex mutex_;
+      ReplayFilterMetrics metrics_;
+    };
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_REPLAY_FILTER_HPP
@@ -0,0 +1,130 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/transaction_forwarder.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    TransactionForwarder::TransactionForwarder(
+        std::shared_ptr<grpc::Channel> channel,
+        size_t max_batch,
+        std::chrono::microseconds max_delay,
+        std::string origin,
+        std::shared_ptr<network::AsyncClientRuntime> runtime)
+        : client_(proto::OrderingService::NewStub(channel)),
+          max_batch_(max_batch),
+          max_delay_(max_delay),
+          origin_(std::move(origin)),
+          stopped_(false),
+          rpc_(std::move(runtime)) {
+      log_ = logger::log("TransactionForwarder");
+      flush_thread_ = std::thread(&TransactionForwarder::flushLoop, this);
+    }
+
+    TransactionForwarder::~TransactionForwarder() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      cv_.notify_one();
+      if (flush_thread_.joinable()) {
+        flush_thread_.join();
+      }
+    }
+
+    void TransactionForwarder::forward(std::string hash,
+                                       protocol::Transaction transaction) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (hashes_.empty()) {
+        batch_start_ = std::chrono::steady_clock::now();
+      }
+      hashes_.push_back(std::move(hash));
+      batch_.add_transactions()->Swap(&transaction);
+      auto full = hashes_.size() >= max_batch_;
+      auto first = hashes_.size() == 1;
+      lock.unlock();
+      // flush loop is waiting either for first transaction or for full batch
+      if (full or first) {
+        cv_.notify_one();
+      }
+    }
+
+    rxcpp::observable<TransactionAck> TransactionForwarder::on_ack() {
+      return acks_.get_observable();
+    }
+
+    void TransactionForwarder::flushLoop() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        cv_.wait(lock, [this] { return stopped_ or not hashes_.empty(); });
+        cv_.wait_until(lock, batch_start_ + max_delay_, [this] {
+          return stopped_ or hashes_.size() >= max_batch_;
+        });
+        if (not hashes_.empty()) {
+          std::vector<std::string> hashes;
+          proto::Transactions batch;
+          hashes.swap(hashes_);
+          batch.Swap(&batch_);
+          lock.unlock();
+          batch.set_origin(origin_);
+          send(std::move(hashes), batch);
+          lock.lock();
+        }
+        if (stopped_) {
+          return;
+        }
+      }
+    }
+
+    void TransactionForwarder::send(std::vector<std::string> hashes,
+                                    const proto::Transactions &batch) {
+      log_->info("forward batch of {} transactions", hashes.size());
+      auto call = rpc_.makeCall();
+      call->on_response = [this, hashes = std::move(hashes)](
+          const auto &status, const auto &reply, auto) mutable {
+        this->handleAcks(hashes, status, reply);
+      };
+
+      call->response_reader =
+          client_->AsyncSendTransactions(&call->context, batch, rpc_.queue());
+
+      call->response_reader->Finish(&call->reply, &call->status, call->tag());
+    }
+
+    void TransactionForwarder::handleAcks(std::vector<std::string> &hashes,
+                                          const grpc::Status &status,
+                                          const proto::TransactionAcks &reply) {
+      auto answered = status.ok()
+          and reply.acks_size() == static_cast<int>(hashes.size());
+      if (not answered) {
+        log_->error("batch of {} transactions is not acknowledged: {}",
+                    hashes.size(),
+                    status.error_message());
+      }
+      auto exhausted =
+          status.error_code() == grpc::StatusCode::RESOURCE_EXHAUSTED;
+      std::lock_guard<std::mutex> lock(ack_mutex_);
+      for (size_t i = 0; i < hashes.size(); ++i) {
+        auto accepted = answered and reply.acks(i).accepted();
+        auto overloaded = answered ? reply.acks(i).overloaded() : exhausted;
+        acks_.get_subscriber().on_next(
+            TransactionAck{std::move(hashes[i]), accepted, overloaded});
+      }
+    }
+  }  // namespace ordering
+}  // namespace iroha
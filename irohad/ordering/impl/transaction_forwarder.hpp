@@ -0,0 +1,138 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_TRANSACTION_FORWARDER_HPP
+#define IROHA_TRANSACTION_FORWARDER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <grpc++/grpc++.h>
+#include <mutex>
+#include <rxcpp/rx.hpp>
+#include <thread>
+#include <vector>
+#include "logger/logger.hpp"
+#include "network/impl/async_grpc_client.hpp"
+#include "ordering.grpc.pb.h"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Acknowledgement of forwarded transaction by OrderingService
+     */
+    struct TransactionAck {
+      /**
+       * hash of transaction in binary form
+       */
+      std::string hash;
+      bool accepted;
+
+      /**
+       * transaction is rejected because OrderingService is overloaded
+       */
+      bool overloaded;
+    };
+
+    /**
+     * Forwards transactions to OrderingService in batches
+     * Batch is sent when it reaches max_batch transactions or when its
+     * oldest transaction waited for max_delay
+     * @param channel - channel to OrderingService
+     * @param max_batch - maximum number of transactions in batch
+     * @param max_delay - maximum time transaction waits for batch
+     * @param origin - address of forwarding OrderingGate, sent with batches
+     * @param runtime - completion queues for batch calls
+     */
+    class TransactionForwarder {
+     public:
+      TransactionForwarder(std::shared_ptr<grpc::Channel> channel,
+                           size_t max_batch,
+                           std::chrono::microseconds max_delay,
+                           std::string origin = "",
+                           std::shared_ptr<network::AsyncClientRuntime>
+                               runtime =
+                                   network::AsyncClientRuntime::getDefault());
+
+      ~TransactionForwarder();
+
+      /**
+       * Add transaction to current batch
+       * @param hash - ordering hash of transaction
+       * @param transaction - transaction in transport form
+       */
+      void forward(std::string hash, protocol::Transaction transaction);
+
+      /**
+       * @return acknowledgements of forwarded transactions
+       */
+      rxcpp::observable<TransactionAck> on_ack();
+
+     private:
+      /**
+       * Wait for batches to fill up and send them
+       */
+      void flushLoop();
+
+      /**
+       * Send batch asynchronously
+       * @param hashes - hashes of batch transactions
+       * @param batch - transactions to send
+       */
+      void send(std::vector<std::string> hashes,
+                const proto::Transactions &batch);
+
+      /**
+       * Publish acknowledgements of sent batch
+       * @param hashes - hashes of batch transactions
+       * @param status - status of batch call
+       * @param reply - acknowledgements from OrderingService
+       */
+      void handleAcks(std::vector<std::string> &hashes,
+                      const grpc::Status &status,
+                      const proto::TransactionAcks &reply);
+
+      std::unique_ptr<proto::OrderingService::Stub> client_;
+      size_t max_batch_;
+      std::chrono::microseconds max_delay_;
+      std::string origin_;
+
+      std::vector<std::string> hashes_;
+      proto::Transactions batch_;
+      std::chrono::steady_clock::time_point batch_start_;
+      bool stopped_;
+      std::mutex mutex_;
+      std::condition_variable cv_;
+
+      rxcpp::subjects::subject<TransactionAck> acks_;
+
+      /**
+       * serializes publishing of acknowledgements from completion threads
+       */
+      std::mutex ack_mutex_;
+      logger::Logger log_;
+
+      /**
+       * declared after acks_, so calls in flight finish before it is gone
+       */
+      network::AsyncGrpcClient<proto::TransactionAcks> rpc_;
+      std::thread flush_thread_;
+    };
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_TRANSACTION_FORWARDER_HPP
@@ -0,0 +1,95 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_TRANSACTION_POOL_HPP
+#define IROHA_TRANSACTION_POOL_HPP
+
+#include <deque>
+#include <mutex>
+#include <nonstd/optional.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Bounded pool of transactions known to the peer, keyed by hash
+     * Allows proposals to reference transactions by hash only
+     * The oldest transactions are evicted when capacity is reached
+     * @tparam Transaction type of stored transaction
+     * @param capacity - maximum number of stored transactions
+     */
+    template <typename Transaction>
+    class TransactionPool {
+     public:
+      explicit TransactionPool(size_t capacity) : capacity_(capacity) {}
+
+      /**
+       * Store transaction in pool
+       * @param hash - ordering hash of transaction
+       * @param transaction - transaction to store
+       */
+      void add(const std::string &hash, const Transaction &transaction) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (transactions_.count(hash) != 0) {
+          return;
+        }
+        while (not order_.empty() and order_.size() >= capacity_) {
+          transactions_.erase(order_.front());
+          order_.pop_front();
+        }
+        transactions_.emplace(hash, transaction);
+        order_.push_back(hash);
+      }
+
+      /**
+       * @param hash - ordering hash of transaction
+       * @return transaction with given hash, if present
+       */
+      nonstd::optional<Transaction> get(const std::string &hash) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = transactions_.find(hash);
+        if (it == transactions_.end()) {
+          return nonstd::nullopt;
+        }
+        return it->second;
+      }
+
+      /**
+       * @return number of stored transactions
+       */
+      size_t size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return transactions_.size();
+      }
+
+     private:
+      std::unordered_map<std::string, Transaction> transactions_;
+
+      /**
+       * hashes of stored transactions in insertion order
+       */
+      std::deque<std::string> order_;
+
+      size_t capacity_;
+      std::mutex mutex_;
+    };
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_TRANSACTION_POOL_HPP
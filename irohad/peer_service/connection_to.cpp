@@ -16,6 +16,7 @@
  */
 
 #include "connection_to.hpp"
+#include "network/impl/channel_registry.hpp"
 #include "service.hpp"
 
 #ifndef SHORT_TIMER_LOW
@@ -59,7 +60,8 @@ namespace peerservice {
     this->timer = loop->resource<uvw::TimerHandle>();
 
     auto to = n.ip + ":" + std::to_string(n.port);
-    auto channel = grpc::CreateChannel(to, grpc::InsecureChannelCredentials());
+    auto channel =
+        iroha::network::ChannelRegistry::getDefault()->getChannel(to);
     stub_ = PeerService::NewStub(channel);
   }
 
@@ -46,7 +46,10 @@ namespace iroha {
       if (validator_->validateBlock(commit_message, *storage)) {
         // Block can be applied to current storage
         // Commit to main Ametsuchi
-        mutableFactory_->commit(std::move(storage));
+        if (not mutableFactory_->commit(std::move(storage))) {
+          log_->error("Cannot commit block {}", commit_message.height);
+          return;
+        }
 
         auto single_commit = rxcpp::observable<>::just(commit_message);
 
@@ -70,7 +73,10 @@ namespace iroha {
           }
           if (validator_->validateChain(chain, *storage)) {
             // Peer send valid chain
-            mutableFactory_->commit(std::move(storage));
+            if (not mutableFactory_->commit(std::move(storage))) {
+              log_->error("Cannot commit chain");
+              return;
+            }
             notifier_.get_subscriber().on_next(chain);
             // You are synchronized
             return;
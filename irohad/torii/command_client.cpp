@@ -62,6 +62,40 @@ namespace torii {
     return status_;
   }
 
+  /**
+   * requests batch of txs to a torii server and returns their statuses
+   * (blocking, sync)
+   * @param txs
+   * @param response - returns ToriiBatchResponse if succeeded
+   * @return grpc::Status - returns connection is success or not.
+   */
+  grpc::Status CommandSyncClient::ToriiBatch(
+      const iroha::protocol::TxList& txs,
+      iroha::protocol::ToriiBatchResponse& response) {
+    grpc::ClientContext context;
+    return stub_->ToriiBatch(&context, txs, &response);
+  }
+
+  /**
+   * subscribes to statuses of tx and receives them until the last one
+   * (blocking, sync)
+   * @param request - hash of tx
+   * @param callback - invoked for each status
+   * @return grpc::Status - returns connection is success or not.
+   */
+  grpc::Status CommandSyncClient::StatusStream(
+      const iroha::protocol::TxStatusRequest& request,
+      std::function<void(const iroha::protocol::TxStatusResponse&)>
+          callback) {
+    grpc::ClientContext context;
+    auto reader = stub_->StatusStream(&context, request);
+    iroha::protocol::TxStatusResponse status;
+    while (reader->Read(&status)) {
+      callback(status);
+    }
+    return reader->Finish();
+  }
+
   /**
    * manages state of a Torii async client call.
    */
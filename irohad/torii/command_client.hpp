@@ -19,6 +19,7 @@ limitations under the License.
 
 #include <endpoint.grpc.pb.h>
 #include <grpc++/grpc++.h>
+#include <functional>
 #include <memory>
 #include <thread>
 
@@ -41,6 +42,28 @@ namespace torii {
     grpc::Status Torii(const iroha::protocol::Transaction& tx,
                        iroha::protocol::ToriiResponse& response);
 
+    /**
+     * requests batch of txs to a torii server and returns their statuses
+     * (blocking, sync)
+     * @param txs
+     * @param response - returns ToriiBatchResponse if succeeded
+     * @return grpc::Status - returns connection is success or not.
+     */
+    grpc::Status ToriiBatch(const iroha::protocol::TxList& txs,
+                            iroha::protocol::ToriiBatchResponse& response);
+
+    /**
+     * subscribes to statuses of tx and receives them until the last one
+     * (blocking, sync)
+     * @param request - hash of tx
+     * @param callback - invoked for each status
+     * @return grpc::Status - returns connection is success or not.
+     */
+    grpc::Status StatusStream(
+        const iroha::protocol::TxStatusRequest& request,
+        std::function<void(const iroha::protocol::TxStatusResponse&)>
+            callback);
+
   private:
     grpc::ClientContext context_;
     std::unique_ptr<iroha::protocol::CommandService::Stub> stub_;
@@ -19,12 +19,17 @@ limitations under the License.
 
 #include <endpoint.grpc.pb.h>
 #include <endpoint.pb.h>
+#include <atomic>
+#include <deque>
+#include <functional>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include "model/converters/pb_transaction_factory.hpp"
 #include "model/tx_responses/stateless_response.hpp"
 #include "torii/processor/transaction_processor.hpp"
+#include "torii/response_map.hpp"
 
 namespace torii {
 
@@ -42,19 +47,90 @@ namespace torii {
 
     CommandService(const CommandService&) = delete;
     CommandService& operator=(const CommandService&) = delete;
+
+    using ToriiCallback = std::function<void()>;
+
     /**
      * actual implementation of async Torii in CommandService
+     * Transaction is validated by transaction processor apart from the
+     * calling thread
      * @param request - Transaction
-     * @param response - ToriiResponse
+     * @param response - ToriiResponse, must outlive the transaction
+     * @param on_response - invoked once response is set, may be invoked
+     * at once or from another thread; request not answered in time is
+     * answered as overloaded
      */
     void ToriiAsync(iroha::protocol::Transaction const& request,
-                    iroha::protocol::ToriiResponse& response);
+                    iroha::protocol::ToriiResponse& response,
+                    ToriiCallback on_response);
+
+    /**
+     * actual implementation of async ToriiBatch in CommandService
+     * Transactions of the batch are validated apart from the calling thread
+     * @param request - TxList
+     * @param response - ToriiBatchResponse, one status per transaction,
+     * must outlive the batch
+     * @param on_response - invoked once all responses are set, may be
+     * invoked at once or from another thread
+     */
+    void ToriiBatchAsync(iroha::protocol::TxList const& request,
+                         iroha::protocol::ToriiBatchResponse& response,
+                         ToriiCallback on_response);
+
+    /**
+     * callback of status stream
+     * @param status - new status of transaction
+     * @param last - true if status is final and stream is over
+     */
+    using StatusCallback = std::function<void(
+        const iroha::protocol::TxStatusResponse& status, bool last)>;
+
+    /**
+     * actual implementation of async StatusStream in CommandService.
+     * subscribes to status changes of transaction,
+     * the last known status is sent at once.
+     * @param request - TxStatusRequest
+     * @param callback - receives statuses
+     * @return id of subscription for cancelStatusStream()
+     */
+    uint64_t StatusStreamAsync(iroha::protocol::TxStatusRequest const& request,
+                               StatusCallback callback);
+
+    /**
+     * unsubscribes callback of status stream,
+     * it is not invoked after this method returns
+     * @param id - id returned by StatusStreamAsync()
+     */
+    void cancelStatusStream(uint64_t id);
+
+    /**
+     * @return counters of pending Torii requests
+     */
+    const ResponseMapMetrics& responseMetrics() const;
 
    private:
+    /**
+     * remembers status and sends it to subscribers of the transaction
+     * @param status
+     */
+    void publishStatus(const iroha::protocol::TxStatusResponse& status);
+
     std::shared_ptr<iroha::model::converters::PbTransactionFactory> pb_factory_;
     std::shared_ptr<iroha::torii::TransactionProcessor> tx_processor_;
-    std::unordered_map<std::string, iroha::protocol::ToriiResponse&>
-        handler_map_;
+    // pending Torii requests with their callbacks
+    ResponseMap<iroha::protocol::ToriiResponse> handler_map_;
+
+    // subscribers of status streams by hash of transaction
+    std::unordered_map<std::string,
+                       std::unordered_map<uint64_t, StatusCallback>>
+        status_streams_;
+    std::unordered_map<uint64_t, std::string> stream_hashes_;
+    uint64_t next_stream_id_ = 0;
+    // last known statuses, the oldest is forgotten first
+    std::unordered_map<std::string, iroha::protocol::TxStatusResponse>
+        last_statuses_;
+    std::deque<std::string> last_statuses_order_;
+    std::mutex status_mutex_;
   };
 
 }  // namespace torii
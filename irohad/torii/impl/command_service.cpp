@@ -16,48 +16,216 @@ limitations under the License.
 
 #include "torii/command_service.hpp"
 #include "common/types.hpp"
+#include "model/tx_responses/commit_response.hpp"
+#include "model/tx_responses/stateful_response.hpp"
 
 namespace torii {
 
+  namespace {
+    // pending requests kept at most, the oldest is forgotten first
+    constexpr size_t MAX_PENDING_REQUESTS = 100000;
+    // pending request is forgotten if not completed in time
+    constexpr auto PENDING_REQUEST_TTL = std::chrono::minutes(1);
+    // last known statuses kept at most
+    constexpr size_t MAX_LAST_STATUSES = 100000;
+
+    /**
+     * @return true if status of transaction does not change anymore
+     */
+    bool isFinal(iroha::protocol::TxStatus status) {
+      switch (status) {
+        case iroha::protocol::TX_STATELESS_FAILED:
+        case iroha::protocol::TX_OVERLOADED:
+        case iroha::protocol::TX_REJECTED:
+        case iroha::protocol::TX_COMMITTED:
+          return true;
+        default:
+          return false;
+      }
+    }
+  }  // namespace
+
   CommandService::CommandService(
       std::shared_ptr<iroha::model::converters::PbTransactionFactory>
           pb_factory,
       std::shared_ptr<iroha::torii::TransactionProcessor> txProccesor)
-      : pb_factory_(pb_factory), tx_processor_(txProccesor) {
+      : pb_factory_(pb_factory),
+        tx_processor_(txProccesor),
+        handler_map_(MAX_PENDING_REQUESTS,
+                     PENDING_REQUEST_TTL,
+                     [](iroha::protocol::ToriiResponse &response) {
+                       // status is unknown, client retries transaction
+                       response.set_admission(
+                           iroha::protocol::ADMISSION_OVERLOADED);
+                     }) {
     // Notifier for all clients
     tx_processor_->transactionNotifier().subscribe([this](auto iroha_response) {
+      iroha::protocol::TxStatusResponse status;
+      status.set_tx_hash(iroha_response->transaction.tx_hash.to_string());
 
-      // TODO: make for other responses
       if (iroha:: instanceof
           <iroha::model::TransactionStatelessResponse>(*iroha_response)) {
         auto resp = static_cast<iroha::model::TransactionStatelessResponse &>(
             *iroha_response);
+        // transaction not accepted for validation is overloaded as well
+        status.set_status(resp.overloaded
+                              ? iroha::protocol::TX_OVERLOADED
+                              : (resp.passed
+                                     ? iroha::protocol::TX_STATELESS_PASSED
+                                     : iroha::protocol::TX_STATELESS_FAILED));
         // Find response in handler map
-
-        auto res =
-            this->handler_map_.find(resp.transaction.tx_hash.to_string());
-
-        res->second.set_validation(
-            resp.passed ? iroha::protocol::STATELESS_VALIDATION_SUCCESS
-                        : iroha::protocol::STATELESS_VALIDATION_FAILED);
+        this->handler_map_.update(
+            resp.transaction.tx_hash.to_string(),
+            [&resp](iroha::protocol::ToriiResponse &response) {
+              response.set_validation(
+                  resp.passed ? iroha::protocol::STATELESS_VALIDATION_SUCCESS
+                              : iroha::protocol::STATELESS_VALIDATION_FAILED);
+              response.set_admission(
+                  resp.overloaded ? iroha::protocol::ADMISSION_OVERLOADED
+                                  : iroha::protocol::ADMISSION_ACCEPTED);
+            });
+        this->handler_map_.complete(resp.transaction.tx_hash.to_string());
+      } else if (iroha:: instanceof
+                 <iroha::model::TransactionStatefulResponse>(
+                     *iroha_response)) {
+        auto resp = static_cast<iroha::model::TransactionStatefulResponse &>(
+            *iroha_response);
+        status.set_status(resp.passed ? iroha::protocol::TX_STATEFUL_PASSED
+                                      : iroha::protocol::TX_REJECTED);
+        status.set_height(resp.height);
+      } else if (iroha:: instanceof
+                 <iroha::model::TransactionCommitResponse>(*iroha_response)) {
+        auto resp = static_cast<iroha::model::TransactionCommitResponse &>(
+            *iroha_response);
+        status.set_status(iroha::protocol::TX_COMMITTED);
+        status.set_height(resp.height);
       }
+      this->publishStatus(status);
     });
   }
 
   void CommandService::ToriiAsync(iroha::protocol::Transaction const &request,
-                                  iroha::protocol::ToriiResponse &response) {
+                                  iroha::protocol::ToriiResponse &response,
+                                  ToriiCallback on_response) {
     auto iroha_tx = pb_factory_->deserialize(request);
 
     auto tx_hash = iroha_tx->tx_hash.to_string();
 
-    if (handler_map_.count(tx_hash)) {
+    response.set_tx_hash(tx_hash);
+    // the same transaction is already being handled
+    if (not handler_map_.insert(tx_hash, response, on_response)) {
       response.set_validation(iroha::protocol::STATELESS_VALIDATION_FAILED);
+      on_response();
       return;
     }
 
-    handler_map_.insert({tx_hash, response});
-    // Send transaction to iroha
+    // Send transaction to iroha, response is set by the notifier
     tx_processor_->transactionHandle(iroha_tx);
   }
 
+  void CommandService::ToriiBatchAsync(
+      iroha::protocol::TxList const &request,
+      iroha::protocol::ToriiBatchResponse &response,
+      ToriiCallback on_response) {
+    // responses are added first, their addresses do not change afterwards
+    for (int i = 0; i < request.transactions_size(); ++i) {
+      response.add_responses();
+    }
+
+    // batch is answered when the last of its transactions is answered,
+    // the extra count is released once all of them are sent
+    auto remaining = std::make_shared<std::atomic<size_t>>(
+        request.transactions_size() + 1);
+    auto on_batch = std::make_shared<ToriiCallback>(std::move(on_response));
+    ToriiCallback on_tx = [remaining, on_batch] {
+      if (--*remaining == 0) {
+        (*on_batch)();
+      }
+    };
+
+    std::vector<std::shared_ptr<iroha::model::Transaction>> transactions;
+    for (int i = 0; i < request.transactions_size(); ++i) {
+      auto iroha_tx = pb_factory_->deserialize(request.transactions(i));
+      auto tx_hash = iroha_tx->tx_hash.to_string();
+      response.mutable_responses(i)->set_tx_hash(tx_hash);
+      // the same transaction is already being handled
+      if (not handler_map_.insert(
+              tx_hash, *response.mutable_responses(i), on_tx)) {
+        response.mutable_responses(i)->set_validation(
+            iroha::protocol::STATELESS_VALIDATION_FAILED);
+        on_tx();
+        continue;
+      }
+      transactions.push_back(iroha_tx);
+    }
+
+    // Send transactions to iroha, responses are set by the notifier
+    tx_processor_->transactionBatchHandle(std::move(transactions));
+    on_tx();
+  }
+
+  uint64_t CommandService::StatusStreamAsync(
+      iroha::protocol::TxStatusRequest const &request,
+      StatusCallback callback) {
+    std::lock_guard<std::mutex> lock(status_mutex_);
+    auto id = next_stream_id_++;
+    auto last_status = last_statuses_.find(request.tx_hash());
+    if (last_status != last_statuses_.end()) {
+      auto last = isFinal(last_status->second.status());
+      callback(last_status->second, last);
+      if (last) {
+        return id;
+      }
+    }
+    status_streams_[request.tx_hash()].emplace(id, std::move(callback));
+    stream_hashes_.emplace(id, request.tx_hash());
+    return id;
+  }
+
+  void CommandService::cancelStatusStream(uint64_t id) {
+    std::lock_guard<std::mutex> lock(status_mutex_);
+    auto hash = stream_hashes_.find(id);
+    if (hash == stream_hashes_.end()) {
+      return;
+    }
+    auto streams = status_streams_.find(hash->second);
+    streams->second.erase(id);
+    if (streams->second.empty()) {
+      status_streams_.erase(streams);
+    }
+    stream_hashes_.erase(hash);
+  }
+
+  void CommandService::publishStatus(
+      const iroha::protocol::TxStatusResponse &status) {
+    std::lock_guard<std::mutex> lock(status_mutex_);
+    if (last_statuses_.count(status.tx_hash()) == 0) {
+      last_statuses_order_.push_back(status.tx_hash());
+      if (last_statuses_order_.size() > MAX_LAST_STATUSES) {
+        last_statuses_.erase(last_statuses_order_.front());
+        last_statuses_order_.pop_front();
+      }
+    }
+    last_statuses_[status.tx_hash()] = status;
+
+    auto streams = status_streams_.find(status.tx_hash());
+    if (streams == status_streams_.end()) {
+      return;
+    }
+    auto last = isFinal(status.status());
+    for (auto &stream : streams->second) {
+      stream.second(status, last);
+    }
+    if (last) {
+      for (auto &stream : streams->second) {
+        stream_hashes_.erase(stream.first);
+      }
+      status_streams_.erase(streams);
+    }
+  }
+
+  const ResponseMapMetrics &CommandService::responseMetrics() const {
+    return handler_map_.metrics();
+  }
+
 }  // namespace torii
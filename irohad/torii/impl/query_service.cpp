@@ -19,33 +19,195 @@
 
 namespace torii {
 
+  namespace {
+    // pending queries kept at most, the oldest is forgotten first
+    constexpr size_t MAX_PENDING_QUERIES = 100000;
+    // pending query is forgotten if not completed in time
+    constexpr auto PENDING_QUERY_TTL = std::chrono::minutes(1);
+
+    // resume token is big-endian height followed by hash of the block
+    constexpr size_t TOKEN_HEIGHT_SIZE = sizeof(uint64_t);
+
+    std::string makeResumeToken(const iroha::model::Block &block) {
+      std::string token(TOKEN_HEIGHT_SIZE, 0);
+      for (size_t i = 0; i < TOKEN_HEIGHT_SIZE; ++i) {
+        token[i] = (block.height >> (8 * (TOKEN_HEIGHT_SIZE - 1 - i))) & 0xff;
+      }
+      return token + block.hash.to_string();
+    }
+
+    nonstd::optional<std::pair<uint64_t, std::string>> parseResumeToken(
+        const std::string &token) {
+      if (token.size() != TOKEN_HEIGHT_SIZE + iroha::hash256_t::size()) {
+        return nonstd::nullopt;
+      }
+      uint64_t height = 0;
+      for (size_t i = 0; i < TOKEN_HEIGHT_SIZE; ++i) {
+        height = (height << 8) | static_cast<uint8_t>(token[i]);
+      }
+      return std::make_pair(height, token.substr(TOKEN_HEIGHT_SIZE));
+    }
+  }  // namespace
+
   QueryService::QueryService(
       std::shared_ptr<iroha::model::converters::PbQueryFactory>
           pb_query_factory,
       std::shared_ptr<iroha::model::converters::PbQueryResponseFactory>
           pb_query_response_factory,
-      std::shared_ptr<iroha::torii::QueryProcessor> query_processor)
+      std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
+      std::shared_ptr<iroha::torii::BlockStreamer> block_streamer)
       : pb_query_factory_(pb_query_factory),
         pb_query_response_factory_(pb_query_response_factory),
-        query_processor_(query_processor) {
+        query_processor_(query_processor),
+        block_streamer_(block_streamer),
+        handler_map_(MAX_PENDING_QUERIES, PENDING_QUERY_TTL),
+        batch_map_(MAX_PENDING_QUERIES, PENDING_QUERY_TTL) {
     // Subscribe on result from iroha
     query_processor_->queryNotifier().subscribe([this](auto iroha_response) {
-      // Find client to respond
-      auto res = handler_map_.find(iroha_response->query_hash.to_string());
-      // Serialize to proto an return to response
-      res->second =
-          pb_query_response_factory_->serialize(iroha_response).value();
+      auto query_hash = iroha_response->query_hash.to_string();
+      // Find client to respond, batches are answered apart from queries
+      auto is_batch = batch_map_.update(
+          query_hash,
+          [this,
+           &iroha_response](iroha::protocol::QueryBatchResponse &response) {
+            response =
+                pb_query_response_factory_->serializeBatch(iroha_response);
+          });
+      if (is_batch) {
+        batch_map_.complete(query_hash);
+      } else {
+        handler_map_.update(
+            query_hash,
+            [this, &iroha_response](iroha::protocol::QueryResponse &response) {
+              // Serialize to proto an return to response
+              response =
+                  pb_query_response_factory_->serialize(iroha_response).value();
+            });
+        handler_map_.complete(query_hash);
+      }
 
+      FindCallback on_response;
+      {
+        std::lock_guard<std::mutex> lock(find_callbacks_mutex_);
+        auto it = find_callbacks_.find(query_hash);
+        if (it == find_callbacks_.end()) {
+          return;
+        }
+        on_response = std::move(it->second);
+        find_callbacks_.erase(it);
+      }
+      on_response();
     });
   }
 
   void QueryService::FindAsync(iroha::protocol::Query const& request,
-                               iroha::protocol::QueryResponse& response) {
+                               iroha::protocol::QueryResponse& response,
+                               FindCallback on_response) {
     // Get iroha model query
     auto query = pb_query_factory_->deserialize(request);
+    if (not query) {
+      response.mutable_error_response()->set_reason(
+          iroha::protocol::ErrorResponse::WRONG_FORMAT);
+      on_response();
+      return;
+    }
+    auto query_hash = query->query_hash.to_string();
     // Query - response relationship
-    handler_map_.insert({query->query_hash.to_string(), response});
-    // Send query to iroha
+    if (not handler_map_.insert(query_hash, response)) {
+      // the same query is already being handled
+      response.mutable_error_response()->set_reason(
+          iroha::protocol::ErrorResponse::STATELESS_INVALID);
+      on_response();
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(find_callbacks_mutex_);
+      find_callbacks_[query_hash] = std::move(on_response);
+    }
+    // Send query to iroha, response is set by the notifier
     query_processor_->queryHandle(query);
   }
-}
+
+  void QueryService::FindBatchAsync(
+      iroha::protocol::QueryBatch const &request,
+      iroha::protocol::QueryBatchResponse &response,
+      FindCallback on_response) {
+    auto batch = pb_query_factory_->deserialize(request);
+    if (not batch) {
+      response.mutable_error_response()->set_reason(
+          iroha::protocol::ErrorResponse::WRONG_FORMAT);
+      on_response();
+      return;
+    }
+    auto batch_hash = batch->query_hash.to_string();
+    if (not batch_map_.insert(batch_hash, response)) {
+      // the same batch is already being handled
+      response.mutable_error_response()->set_reason(
+          iroha::protocol::ErrorResponse::STATELESS_INVALID);
+      on_response();
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(find_callbacks_mutex_);
+      find_callbacks_[batch_hash] = std::move(on_response);
+    }
+    query_processor_->queryHandle(batch);
+  }
+
+  void QueryService::FindNextPageAsync(iroha::protocol::Query &request,
+                                       iroha::protocol::QueryResponse &response,
+                                       PageCallback on_page) {
+    FindAsync(request, response, [&request, &response, on_page] {
+      if (not request.has_get_account_transactions()
+          or not response.has_transactions_response()
+          or response.transactions_response().next_tx_hash().empty()) {
+        on_page(false);
+        return;
+      }
+      request.mutable_get_account_transactions()->set_after_tx_hash(
+          response.transactions_response().next_tx_hash());
+      on_page(true);
+    });
+  }
+
+  nonstd::optional<uint64_t> QueryService::SubscribeBlocksAsync(
+      iroha::protocol::BlocksSubscription const &request,
+      BlockCallback callback) {
+    auto from_height = request.from_height();
+    if (not request.resume_token().empty()) {
+      auto token = parseResumeToken(request.resume_token());
+      if (not token.has_value()) {
+        return nonstd::nullopt;
+      }
+      // the block must be in the ledger, otherwise client follows another
+      // chain
+      auto hash = block_streamer_->blockHash(token.value().first);
+      if (not hash.has_value()
+          or hash.value().to_string() != token.value().second) {
+        return nonstd::nullopt;
+      }
+      from_height = token.value().first + 1;
+    }
+
+    return block_streamer_->subscribe(
+        from_height, [this, callback](const iroha::model::Block &block) {
+          iroha::protocol::BlockEvent event;
+          *event.mutable_block() = pb_block_factory_.serialize(block);
+          event.set_resume_token(makeResumeToken(block));
+          callback(event);
+        });
+  }
+
+  void QueryService::blockDelivered(uint64_t id) {
+    block_streamer_->ack(id);
+  }
+
+  void QueryService::cancelBlocksSubscription(uint64_t id) {
+    block_streamer_->unsubscribe(id);
+  }
+
+  const ResponseMapMetrics &QueryService::responseMetrics() const {
+    return handler_map_.metrics();
+  }
+
+}  // namespace torii
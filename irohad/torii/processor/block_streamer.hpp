@@ -0,0 +1,146 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_BLOCK_STREAMER_HPP
+#define IROHA_BLOCK_STREAMER_HPP
+
+#include <ametsuchi/block_query.hpp>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <model/block.hpp>
+#include <mutex>
+#include <network/peer_communication_service.hpp>
+#include <nonstd/optional.hpp>
+#include <thread>
+#include <unordered_map>
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Streams committed blocks to subscribers in order of height.
+     * History is replayed from storage, then live commits follow.
+     * At most window blocks are sent to a subscriber ahead of its
+     * acknowledgements, a slow subscriber catches up from storage later.
+     * Blocks are read from storage and passed to sinks on a dedicated
+     * thread without holding the lock, commits and acknowledgements only
+     * schedule subscriptions for it.
+     */
+    class BlockStreamer {
+     public:
+      using Sink = std::function<void(const model::Block &)>;
+
+      /**
+       * @param block_query - storage of committed blocks
+       * @param pcs - provides commits
+       * @param window - blocks sent to subscriber and not acknowledged yet
+       */
+      BlockStreamer(std::shared_ptr<ametsuchi::BlockQuery> block_query,
+                    std::shared_ptr<network::PeerCommunicationService> pcs,
+                    size_t window = 16);
+
+      /**
+       * Waits until streaming thread stops
+       */
+      ~BlockStreamer();
+
+      /**
+       * Start streaming blocks to sink
+       * @param from_height - height of the first block to send
+       * @param sink - receives blocks on streaming thread
+       * @return id of subscription
+       */
+      uint64_t subscribe(uint64_t from_height, Sink sink);
+
+      /**
+       * Acknowledge that one block has been delivered to subscriber
+       * @param id - id of subscription
+       */
+      void ack(uint64_t id);
+
+      /**
+       * Stop streaming, sink is not invoked after this method returns
+       * @param id - id of subscription
+       */
+      void unsubscribe(uint64_t id);
+
+      /**
+       * @param height - height of block
+       * @return hash of committed block with given height, if any
+       */
+      nonstd::optional<hash256_t> blockHash(uint64_t height);
+
+     private:
+      struct Subscription {
+        uint64_t next_height;
+        size_t in_flight;
+        Sink sink;
+        // subscription waits in pending_ queue
+        bool scheduled;
+      };
+
+      /**
+       * Queue subscription for streaming thread, unless it is queued
+       */
+      void schedule(uint64_t id, Subscription &subscription);
+
+      /**
+       * Pump scheduled subscriptions until streamer is destroyed
+       */
+      void streamLoop();
+
+      /**
+       * Send blocks from storage while window allows
+       * Lock is released while storage is read and sink is invoked
+       * @param lock - lock of mutex_, held on entry and on return
+       * @param id - id of subscription
+       */
+      void pump(std::unique_lock<std::mutex> &lock, uint64_t id);
+
+      /**
+       * Record height of committed block and schedule subscribers
+       * waiting for it
+       */
+      void onCommit(const model::Block &block);
+
+      std::shared_ptr<ametsuchi::BlockQuery> block_query_;
+      size_t window_;
+      std::unordered_map<uint64_t, Subscription> subscriptions_;
+      uint64_t next_id_ = 0;
+
+      /**
+       * height of the latest commit seen, zero until the first one
+       */
+      uint64_t committed_height_ = 0;
+
+      std::deque<uint64_t> pending_;
+
+      /**
+       * subscription whose sink may be running now
+       */
+      nonstd::optional<uint64_t> pumping_;
+      bool stopped_ = false;
+      std::mutex mutex_;
+      std::condition_variable pending_cv_;
+      std::condition_variable pumped_cv_;
+      std::thread stream_thread_;
+    };
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_STREAMER_HPP
@@ -0,0 +1,187 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "torii/processor/block_streamer.hpp"
+#include <algorithm>
+
+namespace iroha {
+  namespace torii {
+
+    BlockStreamer::BlockStreamer(
+        std::shared_ptr<ametsuchi::BlockQuery> block_query,
+        std::shared_ptr<network::PeerCommunicationService> pcs,
+        size_t window)
+        : block_query_(std::move(block_query)), window_(window) {
+      stream_thread_ = std::thread(&BlockStreamer::streamLoop, this);
+      pcs->on_commit().subscribe([this](network::Commit commit) {
+        commit.subscribe(
+            [this](const model::Block &block) { this->onCommit(block); });
+      });
+    }
+
+    BlockStreamer::~BlockStreamer() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      pending_cv_.notify_one();
+      if (stream_thread_.joinable()) {
+        stream_thread_.join();
+      }
+    }
+
+    uint64_t BlockStreamer::subscribe(uint64_t from_height, Sink sink) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto id = next_id_++;
+      auto &subscription =
+          subscriptions_
+              .emplace(id, Subscription{from_height, 0, std::move(sink), false})
+              .first->second;
+      schedule(id, subscription);
+      return id;
+    }
+
+    void BlockStreamer::ack(uint64_t id) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto subscription = subscriptions_.find(id);
+      if (subscription == subscriptions_.end()) {
+        return;
+      }
+      auto &s = subscription->second;
+      --s.in_flight;
+      // storage is not read when subscriber is known to be caught up
+      if (committed_height_ == 0 or s.next_height <= committed_height_) {
+        schedule(id, s);
+      }
+    }
+
+    void BlockStreamer::unsubscribe(uint64_t id) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      subscriptions_.erase(id);
+      if (std::this_thread::get_id() == stream_thread_.get_id()) {
+        return;
+      }
+      pumped_cv_.wait(lock, [this, id] { return pumping_ != id; });
+    }
+
+    nonstd::optional<hash256_t> BlockStreamer::blockHash(uint64_t height) {
+      nonstd::optional<hash256_t> hash;
+      block_query_->getBlocks(height, height)
+          .as_blocking()
+          .subscribe([&hash, height](const auto &block) {
+            if (block.height == height) {
+              hash = block.hash;
+            }
+          });
+      return hash;
+    }
+
+    void BlockStreamer::schedule(uint64_t id, Subscription &subscription) {
+      if (subscription.scheduled) {
+        return;
+      }
+      subscription.scheduled = true;
+      pending_.push_back(id);
+      pending_cv_.notify_one();
+    }
+
+    void BlockStreamer::streamLoop() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        pending_cv_.wait(lock,
+                         [this] { return stopped_ or not pending_.empty(); });
+        if (stopped_) {
+          return;
+        }
+        auto id = pending_.front();
+        pending_.pop_front();
+        auto subscription = subscriptions_.find(id);
+        if (subscription == subscriptions_.end()) {
+          continue;
+        }
+        // events during pump schedule the subscription again
+        subscription->second.scheduled = false;
+        pumping_ = id;
+        pump(lock, id);
+        pumping_ = nonstd::nullopt;
+        pumped_cv_.notify_all();
+      }
+    }
+
+    void BlockStreamer::pump(std::unique_lock<std::mutex> &lock,
+                             uint64_t id) {
+      while (true) {
+        auto subscription = subscriptions_.find(id);
+        if (subscription == subscriptions_.end()
+            or subscription->second.in_flight >= window_) {
+          return;
+        }
+        auto &s = subscription->second;
+        auto from = s.next_height;
+        auto count = window_ - s.in_flight;
+        auto sink = s.sink;
+        // window is reserved, acknowledgements may come before sink returns
+        s.in_flight += count;
+        lock.unlock();
+
+        std::vector<model::Block> blocks;
+        block_query_->getBlocks(from, from + count - 1)
+            .as_blocking()
+            .subscribe([&blocks](auto block) { blocks.push_back(block); });
+        size_t sent = 0;
+        for (const auto &block : blocks) {
+          if (block.height != from + sent) {
+            break;
+          }
+          // sink may have unsubscribed itself
+          lock.lock();
+          auto active = subscriptions_.count(id) != 0;
+          lock.unlock();
+          if (not active) {
+            break;
+          }
+          sink(block);
+          ++sent;
+        }
+
+        lock.lock();
+        subscription = subscriptions_.find(id);
+        if (subscription == subscriptions_.end()) {
+          return;
+        }
+        subscription->second.in_flight -= count - sent;
+        subscription->second.next_height = from + sent;
+        if (sent < count) {
+          // caught up with the ledger, the rest comes with commits
+          return;
+        }
+      }
+    }
+
+    void BlockStreamer::onCommit(const model::Block &block) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      committed_height_ = std::max(committed_height_, block.height);
+      for (auto &subscription : subscriptions_) {
+        auto &s = subscription.second;
+        if (s.in_flight < window_ and s.next_height <= block.height) {
+          schedule(subscription.first, s);
+        }
+      }
+    }
+
+  }  // namespace torii
+}  // namespace iroha
@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "torii/processor/query_executor.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    QueryExecutor::QueryExecutor(size_t workers,
+                                 std::vector<QueryClassLimits> limits) {
+      for (const auto &class_limits : limits) {
+        Lane lane;
+        lane.limits = class_limits;
+        lanes_.push_back(std::move(lane));
+      }
+      for (size_t i = 0; i < workers; ++i) {
+        workers_.emplace_back([this, i] { this->work(i); });
+      }
+    }
+
+    QueryExecutor::~QueryExecutor() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      cv_.notify_all();
+      for (auto &worker : workers_) {
+        worker.join();
+      }
+    }
+
+    bool QueryExecutor::submit(size_t query_class, Job job, Expired expired) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto &lane = lanes_.at(query_class);
+        if (stopped_ or lane.queue.size() >= lane.limits.max_queued) {
+          ++metrics_.rejected;
+          return false;
+        }
+        lane.queue.push_back({std::move(job),
+                              std::move(expired),
+                              Clock::now() + lane.limits.deadline});
+      }
+      cv_.notify_one();
+      return true;
+    }
+
+    const QueryExecutorMetrics &QueryExecutor::metrics() const {
+      return metrics_;
+    }
+
+    bool QueryExecutor::hasWork() const {
+      for (const auto &lane : lanes_) {
+        if (not lane.queue.empty() and lane.running < lane.limits.max_running) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void QueryExecutor::work(size_t worker) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        cv_.wait(lock, [this] { return stopped_ or hasWork(); });
+        if (stopped_) {
+          return;
+        }
+        // take the first class which may run one more query
+        size_t index = next_lane_;
+        while (lanes_[index].queue.empty()
+               or lanes_[index].running >= lanes_[index].limits.max_running) {
+          index = (index + 1) % lanes_.size();
+        }
+        next_lane_ = (index + 1) % lanes_.size();
+        auto &lane = lanes_[index];
+        auto task = std::move(lane.queue.front());
+        lane.queue.pop_front();
+        ++lane.running;
+        lock.unlock();
+
+        if (Clock::now() > task.deadline) {
+          ++metrics_.expired;
+          task.expired();
+        } else {
+          task.job(worker);
+          ++metrics_.executed;
+        }
+
+        lock.lock();
+        --lane.running;
+        // the class may run one more query now
+        cv_.notify_one();
+      }
+    }
+
+  }  // namespace torii
+}  // namespace iroha
@@ -16,27 +16,83 @@
  */
 
 #include "torii/processor/query_processor_impl.hpp"
-#include "model/queries/responses/error_response.hpp"
+#include <algorithm>
 
 namespace iroha {
   namespace torii {
 
+    namespace {
+      std::vector<std::unique_ptr<model::QueryProcessingFactory>> single(
+          std::unique_ptr<model::QueryProcessingFactory> qpf) {
+        std::vector<std::unique_ptr<model::QueryProcessingFactory>> qpfs;
+        qpfs.push_back(std::move(qpf));
+        return qpfs;
+      }
+
+      QueryProcessorImpl::QueryClass classify(const model::Query &query) {
+        if (instanceof <model::GetAccountTransactions>(query)
+            or instanceof <model::GetAccountAssetTransactions>(query)
+            or instanceof <model::GetAssetHolders>(query)) {
+          return QueryProcessorImpl::HISTORY;
+        }
+        if (instanceof <model::QueryBatch>(query)) {
+          // batch occupies its worker until the slowest of its queries is over
+          const auto &batch = static_cast<const model::QueryBatch &>(query);
+          for (const auto &batch_query : batch.queries) {
+            if (classify(*batch_query) == QueryProcessorImpl::HISTORY) {
+              return QueryProcessorImpl::HISTORY;
+            }
+          }
+        }
+        return QueryProcessorImpl::LOOKUP;
+      }
+    }  // namespace
+
+    QueryProcessorImpl::QueryProcessorImpl(
+        std::vector<std::unique_ptr<model::QueryProcessingFactory>> qpfs,
+        std::shared_ptr<validation::StatelessValidator> stateless_validator,
+        std::vector<QueryClassLimits> limits)
+        : qpfs_(std::move(qpfs)),
+          validator_(stateless_validator),
+          executor_(qpfs_.size(), std::move(limits)) {}
+
     QueryProcessorImpl::QueryProcessorImpl(
         std::unique_ptr<model::QueryProcessingFactory> qpf,
         std::shared_ptr<validation::StatelessValidator> stateless_validator)
-        : qpf_(std::move(qpf)), validator_(stateless_validator) {}
+        : QueryProcessorImpl(single(std::move(qpf)),
+                             stateless_validator,
+                             defaultLimits(1)) {}
+
+    std::vector<QueryClassLimits> QueryProcessorImpl::defaultLimits(
+        size_t workers) {
+      std::vector<QueryClassLimits> limits(2);
+      limits[LOOKUP] = {16, 1000, std::chrono::seconds(1)};
+      // history queries leave one worker to lookups, so lookups are served
+      // while clients read long histories. A single worker is shared
+      // by both classes
+      limits[HISTORY] = {
+          std::max<size_t>(workers, 2) - 1, 100, std::chrono::seconds(5)};
+      return limits;
+    }
 
     void QueryProcessorImpl::queryHandle(std::shared_ptr<model::Query> query) {
       // if not valid send wrong response
       if (!validator_->validate(query)) {
-        model::ErrorResponse response;
-        response.query_hash = query->query_hash;
-        response.reason = model::ErrorResponse::STATELESS_INVALID;
-        subject_.get_subscriber().on_next(
-            std::make_shared<model::ErrorResponse>(response));
-      } else {  // else execute query
-        auto qpf_response = qpf_->execute(query);
-        subject_.get_subscriber().on_next(qpf_response);
+        reject(*query, model::ErrorResponse::STATELESS_INVALID);
+        return;
+      }
+      // else execute query on a worker
+      auto submitted = executor_.submit(
+          classify(*query),
+          [this, query](size_t worker) {
+            auto qpf_response = qpfs_.at(worker)->execute(query);
+            this->notify(qpf_response);
+          },
+          [this, query] {
+            reject(*query, model::ErrorResponse::DEADLINE_EXCEEDED);
+          });
+      if (not submitted) {
+        reject(*query, model::ErrorResponse::OVERLOADED);
       }
     }
 
@@ -44,5 +100,24 @@ namespace iroha {
     QueryProcessorImpl::queryNotifier() {
       return subject_.get_observable();
     }
+
+    const QueryExecutorMetrics &QueryProcessorImpl::executorMetrics() const {
+      return executor_.metrics();
+    }
+
+    void QueryProcessorImpl::reject(const model::Query &query,
+                                    model::ErrorResponse::Reason reason) {
+      model::ErrorResponse response;
+      response.query_hash = query.query_hash;
+      response.reason = reason;
+      notify(std::make_shared<model::ErrorResponse>(response));
+    }
+
+    void QueryProcessorImpl::notify(
+        std::shared_ptr<model::QueryResponse> response) {
+      // subscribers of a subject must not be called concurrently
+      std::lock_guard<std::mutex> lock(notify_mutex_);
+      subject_.get_subscriber().on_next(response);
+    }
   }
 }
@@ -16,6 +16,8 @@
  */
 
 #include <iostream>
+#include <model/tx_responses/commit_response.hpp>
+#include <model/tx_responses/stateful_response.hpp>
 #include <model/tx_responses/stateless_response.hpp>
 #include <torii/processor/transaction_processor_impl.hpp>
 #include <utility>
@@ -26,28 +28,241 @@ namespace iroha {
     using validation::StatelessValidator;
     using model::TransactionResponse;
     using network::PeerCommunicationService;
+    using simulator::VerifiedProposalCreator;
+
+    namespace {
+      // proposals older than this number of heights are not tracked
+      constexpr uint64_t MAX_TRACKED_PROPOSALS = 16;
+    }  // namespace
 
     TransactionProcessorImpl::TransactionProcessorImpl(
         std::shared_ptr<PeerCommunicationService> pcs,
-        std::shared_ptr<StatelessValidator> validator)
-        : pcs_(std::move(pcs)), validator_(std::move(validator)) {
+        std::shared_ptr<StatelessValidator> validator,
+        std::shared_ptr<VerifiedProposalCreator> proposal_creator,
+        size_t validation_workers,
+        size_t max_queued)
+        : pcs_(std::move(pcs)),
+          validator_(std::move(validator)),
+          max_queued_(max_queued) {
       log_ = logger::log("TxProcessor");
+      for (size_t i = 0; i < std::max<size_t>(1, validation_workers); ++i) {
+        validation_workers_.emplace_back([this] { this->validationLoop(); });
+      }
+
+      pcs_->on_proposal().subscribe(
+          [this](auto proposal) { this->onProposal(proposal); });
+      proposal_creator->on_verified_proposal().subscribe(
+          [this](auto proposal) { this->onVerifiedProposal(proposal); });
+      // transaction was answered as accepted already, its status is
+      // corrected to overloaded, so client retries it
+      pcs_->on_rejected().subscribe([this](const model::Transaction &tx) {
+        auto response = std::make_shared<model::TransactionStatelessResponse>();
+        response->transaction = tx;
+        response->passed = true;
+        response->overloaded = true;
+        notify(response);
+      });
+      pcs_->on_commit().subscribe([this](network::Commit commit) {
+        commit.subscribe([this](const model::Block &block) {
+          for (const auto &tx : block.transactions) {
+            auto response =
+                std::make_shared<model::TransactionCommitResponse>();
+            response->transaction = tx;
+            response->height = block.height;
+            notify(response);
+          }
+        });
+      });
+    }
+
+    TransactionProcessorImpl::~TransactionProcessorImpl() {
+      {
+        std::lock_guard<std::mutex> lock(validation_mutex_);
+        stopped_ = true;
+      }
+      validation_cv_.notify_all();
+      for (auto &worker : validation_workers_) {
+        worker.join();
+      }
     }
 
     void TransactionProcessorImpl::transactionHandle(
         std::shared_ptr<model::Transaction> transaction) {
       log_->info("handle transaction");
+      submit(transaction);
+    }
+
+    void TransactionProcessorImpl::transactionBatchHandle(
+        std::vector<std::shared_ptr<model::Transaction>> transactions) {
+      log_->info("handle batch of {} transactions", transactions.size());
+      // stateless validation of different transactions is independent,
+      // so the batch is spread over the workers
+      for (auto &transaction : transactions) {
+        submit(transaction);
+      }
+    }
+
+    void TransactionProcessorImpl::submit(
+        std::shared_ptr<model::Transaction> transaction) {
+      auto pending = std::make_shared<PendingTransaction>();
+      pending->transaction = std::move(transaction);
+      {
+        std::unique_lock<std::mutex> lock(validation_mutex_);
+        if (queued_ >= max_queued_) {
+          lock.unlock();
+          log_->warn("validation queue is full, transaction is not accepted");
+          auto response =
+              std::make_shared<model::TransactionStatelessResponse>();
+          response->transaction = *pending->transaction;
+          response->passed = false;
+          response->overloaded = true;
+          notify(response);
+          return;
+        }
+        ++queued_;
+        clients_[pending->transaction->creator_account_id].pending.push_back(
+            pending);
+        validation_queue_.push_back(pending);
+      }
+      validation_cv_.notify_one();
+    }
+
+    void TransactionProcessorImpl::validationLoop() {
+      while (true) {
+        std::shared_ptr<PendingTransaction> pending;
+        {
+          std::unique_lock<std::mutex> lock(validation_mutex_);
+          validation_cv_.wait(lock, [this] {
+            return stopped_ or not validation_queue_.empty();
+          });
+          // queued transactions are handled before the workers stop,
+          // their submitters are waiting for their statuses
+          if (validation_queue_.empty()) {
+            return;
+          }
+          pending = validation_queue_.front();
+          validation_queue_.pop_front();
+        }
+        pending->passed = validator_->validate(*pending->transaction);
+        propagateInOrder(pending);
+      }
+    }
+
+    void TransactionProcessorImpl::propagateInOrder(
+        std::shared_ptr<PendingTransaction> pending) {
+      const auto &creator = pending->transaction->creator_account_id;
+      std::unique_lock<std::mutex> lock(validation_mutex_);
+      pending->validated = true;
+      // references to elements of unordered_map survive insertions
+      auto &client = clients_[creator];
+      if (client.propagating) {
+        // the worker propagating the client takes this transaction as well
+        return;
+      }
+      client.propagating = true;
+      while (not client.pending.empty()
+             and client.pending.front()->validated) {
+        auto ready = client.pending.front();
+        client.pending.pop_front();
+        --queued_;
+        lock.unlock();
+        propagate(ready->transaction, ready->passed);
+        lock.lock();
+      }
+      client.propagating = false;
+      if (client.pending.empty()) {
+        clients_.erase(creator);
+      }
+    }
+
+    void TransactionProcessorImpl::propagate(
+        std::shared_ptr<model::Transaction> transaction, bool passed) {
       model::TransactionStatelessResponse response;
       response.transaction = *transaction;
-      response.passed = false;
+      response.passed = passed;
+
+      if (passed) {
+        if (pcs_->is_overloaded()) {
+          response.overloaded = true;
+        } else {
+          pcs_->propagate_transaction(transaction);
+        }
+      }
+      log_->info("stateless validation status: {}, overloaded: {}",
+                 response.passed,
+                 response.overloaded);
+      notify(std::make_shared<model::TransactionStatelessResponse>(response));
+    }
+
+    void TransactionProcessorImpl::onProposal(
+        const model::Proposal &proposal) {
+      std::unique_lock<std::mutex> lock(proposals_mutex_);
+      auto verified = verified_.find(proposal.height);
+      if (verified == verified_.end()) {
+        proposals_.emplace(proposal.height, proposal.transactions);
+        forgetStaleProposals(proposal.height);
+        return;
+      }
+      auto hashes = std::move(verified->second);
+      verified_.erase(verified);
+      lock.unlock();
+      notifyRejected(proposal.transactions, hashes, proposal.height);
+    }
 
-      if (validator_->validate(*transaction)) {
-        response.passed = true;
-        pcs_->propagate_transaction(transaction);
+    void TransactionProcessorImpl::onVerifiedProposal(
+        const model::Proposal &proposal) {
+      std::unordered_set<std::string> hashes;
+      for (const auto &tx : proposal.transactions) {
+        hashes.insert(tx.tx_hash.to_string());
+        auto response = std::make_shared<model::TransactionStatefulResponse>();
+        response->transaction = tx;
+        response->passed = true;
+        response->height = proposal.height;
+        notify(response);
       }
-      log_->info("stateless validation status: {}", response.passed);
-      notifier_.get_subscriber().on_next(
-          std::make_shared<model::TransactionStatelessResponse>(response));
+
+      std::unique_lock<std::mutex> lock(proposals_mutex_);
+      auto origin = proposals_.find(proposal.height);
+      if (origin == proposals_.end()) {
+        verified_.emplace(proposal.height, std::move(hashes));
+        forgetStaleProposals(proposal.height);
+        return;
+      }
+      auto transactions = std::move(origin->second);
+      proposals_.erase(origin);
+      lock.unlock();
+      notifyRejected(transactions, hashes, proposal.height);
+    }
+
+    void TransactionProcessorImpl::notifyRejected(
+        const std::vector<model::Transaction> &transactions,
+        const std::unordered_set<std::string> &verified,
+        uint64_t height) {
+      for (const auto &tx : transactions) {
+        if (verified.count(tx.tx_hash.to_string())) {
+          continue;
+        }
+        auto response = std::make_shared<model::TransactionStatefulResponse>();
+        response->transaction = tx;
+        response->passed = false;
+        response->height = height;
+        notify(response);
+      }
+    }
+
+    void TransactionProcessorImpl::forgetStaleProposals(uint64_t height) {
+      if (height <= MAX_TRACKED_PROPOSALS) {
+        return;
+      }
+      auto stale = height - MAX_TRACKED_PROPOSALS;
+      proposals_.erase(proposals_.begin(), proposals_.lower_bound(stale));
+      verified_.erase(verified_.begin(), verified_.lower_bound(stale));
+    }
+
+    void TransactionProcessorImpl::notify(
+        std::shared_ptr<model::TransactionResponse> response) {
+      std::lock_guard<std::mutex> lock(notifier_mutex_);
+      notifier_.get_subscriber().on_next(response);
     }
 
     rxcpp::observable<std::shared_ptr<model::TransactionResponse>>
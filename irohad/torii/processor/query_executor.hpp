@@ -0,0 +1,142 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_QUERY_EXECUTOR_HPP
+#define IROHA_QUERY_EXECUTOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Limits of one class of queries
+     */
+    struct QueryClassLimits {
+      /**
+       * queries of the class executed at the same time
+       */
+      size_t max_running;
+      /**
+       * queries of the class waiting for a worker
+       */
+      size_t max_queued;
+      /**
+       * query which has not started in this time is not executed
+       */
+      std::chrono::milliseconds deadline;
+    };
+
+    /**
+     * Counters of query executor
+     */
+    struct QueryExecutorMetrics {
+      std::atomic<uint64_t> executed{0};
+      std::atomic<uint64_t> rejected{0};
+      std::atomic<uint64_t> expired{0};
+    };
+
+    /**
+     * Bounded pool of workers executing queries apart from the threads
+     * receiving them. Each class of queries has its own queue, so a burst
+     * of heavy queries neither delays light ones beyond their limits nor
+     * grows without bound.
+     */
+    class QueryExecutor {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /**
+       * Executes query, gets index of worker, so each worker can have
+       * resources of its own
+       */
+      using Job = std::function<void(size_t worker)>;
+
+      /**
+       * Invoked instead of job if the deadline has passed
+       */
+      using Expired = std::function<void()>;
+
+      /**
+       * @param workers - number of worker threads
+       * @param limits - limits of each class of queries, index is the class
+       */
+      QueryExecutor(size_t workers, std::vector<QueryClassLimits> limits);
+
+      /**
+       * Stops workers after running jobs are over, queued jobs are dropped
+       */
+      ~QueryExecutor();
+
+      QueryExecutor(const QueryExecutor &) = delete;
+      QueryExecutor &operator=(const QueryExecutor &) = delete;
+
+      /**
+       * Enqueue query
+       * @param query_class - index of class of query
+       * @param job - executes query on a worker
+       * @param expired - invoked on a worker instead of job, if the query
+       * has not started before deadline of its class
+       * @return false if queue of the class is full, neither job nor
+       * expired will be invoked then
+       */
+      bool submit(size_t query_class, Job job, Expired expired);
+
+      /**
+       * @return counters of executor
+       */
+      const QueryExecutorMetrics &metrics() const;
+
+     private:
+      struct Task {
+        Job job;
+        Expired expired;
+        Clock::time_point deadline;
+      };
+
+      struct Lane {
+        QueryClassLimits limits;
+        std::deque<Task> queue;
+        size_t running = 0;
+      };
+
+      void work(size_t worker);
+
+      // must be called with mutex_ locked
+      bool hasWork() const;
+
+      std::vector<Lane> lanes_;
+      // lane served first by the next worker, so no class starves
+      size_t next_lane_ = 0;
+      bool stopped_ = false;
+      std::mutex mutex_;
+      std::condition_variable cv_;
+      QueryExecutorMetrics metrics_;
+      std::vector<std::thread> workers_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // IROHA_QUERY_EXECUTOR_HPP
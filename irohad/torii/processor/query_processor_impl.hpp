@@ -18,24 +18,65 @@
 #ifndef IROHA_QUERY_PROCESSOR_IMPL_HPP
 #define IROHA_QUERY_PROCESSOR_IMPL_HPP
 
+#include <mutex>
+#include "model/queries/responses/error_response.hpp"
 #include "model/query_execution.hpp"
-#include "validation/stateless_validator.hpp"
+#include "torii/processor/query_executor.hpp"
 #include "torii/processor/query_processor.hpp"
+#include "validation/stateless_validator.hpp"
 
 namespace iroha {
   namespace torii {
 
     /**
      * QueryProcessor provides start point for queries in the whole system
+     * Queries are executed by a bounded pool of workers, each worker has
+     * its own query processing factory. Responses are notified from
+     * the workers.
      */
     class QueryProcessorImpl : public QueryProcessor {
      public:
-      explicit QueryProcessorImpl(
+      /**
+       * Classes of queries limited separately
+       */
+      enum QueryClass {
+        /**
+         * queries reading a few entries of world state view
+         */
+        LOOKUP,
+        /**
+         * queries reading history or many entries
+         */
+        HISTORY
+      };
+
+      /**
+       * @param qpfs - query processing factory of each worker, every
+       * factory must have its own connection to storage
+       * @param stateless_validator - validator of queries
+       * @param limits - limits of each QueryClass
+       */
+      QueryProcessorImpl(
+          std::vector<std::unique_ptr<model::QueryProcessingFactory>> qpfs,
+          std::shared_ptr<validation::StatelessValidator> stateless_validator,
+          std::vector<QueryClassLimits> limits);
+
+      /**
+       * Processor with a single worker and default limits
+       */
+      QueryProcessorImpl(
           std::unique_ptr<model::QueryProcessingFactory> qpf,
           std::shared_ptr<validation::StatelessValidator> stateless_validator);
 
       /**
-       * Register client query
+       * @param workers - number of workers executing queries
+       * @return limits of query classes used by default
+       */
+      static std::vector<QueryClassLimits> defaultLimits(size_t workers);
+
+      /**
+       * Register client query. Response is notified later by a worker,
+       * or at once if the query is invalid or rejected
        * @param query - client intent
        */
       void queryHandle(std::shared_ptr<model::Query> query) override;
@@ -47,10 +88,24 @@ namespace iroha {
       rxcpp::observable<std::shared_ptr<model::QueryResponse>> queryNotifier()
           override;
 
+      /**
+       * @return counters of query executor
+       */
+      const QueryExecutorMetrics &executorMetrics() const;
+
      private:
+      void reject(const model::Query &query,
+                  model::ErrorResponse::Reason reason);
+
+      void notify(std::shared_ptr<model::QueryResponse> response);
+
       rxcpp::subjects::subject<std::shared_ptr<model::QueryResponse>> subject_;
-      std::unique_ptr<model::QueryProcessingFactory> qpf_;
+      // responses are notified from workers and from the receiving threads
+      std::mutex notify_mutex_;
+      std::vector<std::unique_ptr<model::QueryProcessingFactory>> qpfs_;
       std::shared_ptr<validation::StatelessValidator> validator_;
+      // declared last, so workers are stopped before factories are destroyed
+      QueryExecutor executor_;
     };
   }
 }
@@ -21,6 +21,7 @@
 #include <rxcpp/rx.hpp>
 #include <model/transaction.hpp>
 #include <model/client.hpp>
+#include <vector>
 #include "model/transaction_response.hpp"
 
 namespace iroha {
@@ -35,10 +36,21 @@ namespace iroha {
 
       /**
        * Add transaction to the system for processing
+       * Returns at once, status is sent to subscribers once transaction
+       * is validated
        * @param transaction - transaction for processing
        */
       virtual void transactionHandle(std::shared_ptr<model::Transaction> transaction) = 0;
 
+      /**
+       * Add batch of transactions to the system for processing
+       * Returns at once, transactions are validated in parallel,
+       * status of each one is sent to subscribers in the batch order
+       * @param transactions - transactions for processing
+       */
+      virtual void transactionBatchHandle(
+          std::vector<std::shared_ptr<model::Transaction>> transactions) = 0;
+
       /**
        * Subscribers will be notified with transaction status
        * @return observable for subscribing
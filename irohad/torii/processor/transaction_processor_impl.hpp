@@ -18,9 +18,18 @@
 #ifndef IROHA_TRANSACTION_PROCESSOR_STUB_HPP
 #define IROHA_TRANSACTION_PROCESSOR_STUB_HPP
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <model/transaction_response.hpp>
+#include <mutex>
 #include <network/peer_communication_service.hpp>
+#include <simulator/verified_proposal_creator.hpp>
+#include <thread>
 #include <torii/processor/transaction_processor.hpp>
+#include <unordered_map>
+#include <unordered_set>
 #include <validation/stateless_validator.hpp>
 #include "logger/logger.hpp"
 
@@ -33,18 +42,115 @@ namespace iroha {
        * @param os - ordering service for sharing transactions
        * @param validator - perform stateless validation
        * @param crypto_provider - sign income transactions
+       * @param proposal_creator - provide statefully validated proposals
+       * @param validation_workers - threads performing stateless validation
+       * @param max_queued - transactions waiting for validation at most,
+       * further ones are answered as overloaded
        */
       TransactionProcessorImpl(
           std::shared_ptr<network::PeerCommunicationService> pcs,
-          std::shared_ptr<validation::StatelessValidator> validator);
+          std::shared_ptr<validation::StatelessValidator> validator,
+          std::shared_ptr<simulator::VerifiedProposalCreator> proposal_creator,
+          size_t validation_workers =
+              std::max(1u, std::thread::hardware_concurrency()),
+          size_t max_queued = 10000);
+
+      /**
+       * Waits until queued transactions are validated and propagated
+       */
+      ~TransactionProcessorImpl() override;
 
       void transactionHandle(
           std::shared_ptr<model::Transaction> transaction) override;
 
+      void transactionBatchHandle(
+          std::vector<std::shared_ptr<model::Transaction>> transactions)
+          override;
+
       rxcpp::observable<std::shared_ptr<model::TransactionResponse>>
       transactionNotifier() override;
 
      private:
+      /**
+       * Transaction waiting for stateless validation and propagation
+       */
+      struct PendingTransaction {
+        std::shared_ptr<model::Transaction> transaction;
+        bool validated = false;
+        bool passed = false;
+      };
+
+      /**
+       * Transactions of one creator in order of submission
+       */
+      struct ClientQueue {
+        std::deque<std::shared_ptr<PendingTransaction>> pending;
+        // one of workers propagates validated transactions of the client
+        bool propagating = false;
+      };
+
+      /**
+       * Queue transaction for stateless validation on a worker,
+       * transaction is answered as overloaded if the queue is full
+       * @param transaction - handled transaction
+       */
+      void submit(std::shared_ptr<model::Transaction> transaction);
+
+      /**
+       * Validate queued transactions until processor is destroyed
+       */
+      void validationLoop();
+
+      /**
+       * Propagate validated transactions of the client in order of their
+       * submission, as far as no earlier one is still being validated
+       * @param pending - transaction which has been validated
+       */
+      void propagateInOrder(std::shared_ptr<PendingTransaction> pending);
+
+      /**
+       * Propagate statelessly valid transaction and notify about its status
+       * @param transaction - handled transaction
+       * @param passed - result of stateless validation
+       */
+      void propagate(std::shared_ptr<model::Transaction> transaction,
+                     bool passed);
+
+      /**
+       * Remember transactions of proposal until it is verified
+       * @param proposal - proposal from ordering service
+       */
+      void onProposal(const model::Proposal &proposal);
+
+      /**
+       * Notify about transactions passed stateful validation and
+       * transactions of the same proposal rejected by it
+       * @param proposal - verified proposal
+       */
+      void onVerifiedProposal(const model::Proposal &proposal);
+
+      /**
+       * Notify about transactions of proposal absent in verified proposal
+       * @param transactions - transactions of proposal
+       * @param verified - hashes of verified transactions
+       * @param height - height of proposal
+       */
+      void notifyRejected(const std::vector<model::Transaction> &transactions,
+                          const std::unordered_set<std::string> &verified,
+                          uint64_t height);
+
+      /**
+       * Forget proposals which will not be verified anymore
+       * @param height - height of the latest proposal
+       */
+      void forgetStaleProposals(uint64_t height);
+
+      /**
+       * Send status to subscribers, statuses are notified one at a time
+       * @param response - status of transaction
+       */
+      void notify(std::shared_ptr<model::TransactionResponse> response);
+
       // connections
       std::shared_ptr<network::PeerCommunicationService> pcs_;
 
@@ -54,6 +160,25 @@ namespace iroha {
       // internal
       rxcpp::subjects::subject<std::shared_ptr<model::TransactionResponse>>
           notifier_;
+      // statuses come from validation workers and network threads
+      std::mutex notifier_mutex_;
+
+      // proposal and its verified counterpart may arrive in any order,
+      // the first of them waits for the second one here
+      std::map<uint64_t, std::vector<model::Transaction>> proposals_;
+      std::map<uint64_t, std::unordered_set<std::string>> verified_;
+      std::mutex proposals_mutex_;
+
+      // stateless validation
+      std::deque<std::shared_ptr<PendingTransaction>> validation_queue_;
+      std::unordered_map<std::string, ClientQueue> clients_;
+      // submitted transactions which are not propagated yet
+      size_t queued_ = 0;
+      size_t max_queued_;
+      std::mutex validation_mutex_;
+      std::condition_variable validation_cv_;
+      bool stopped_ = false;
+      std::vector<std::thread> validation_workers_;
 
       logger::Logger log_;
     };
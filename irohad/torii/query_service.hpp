@@ -20,10 +20,16 @@ limitations under the License.
 #include <endpoint.grpc.pb.h>
 #include <endpoint.pb.h>
 #include <responses.pb.h>
+#include <functional>
+#include <mutex>
+#include <nonstd/optional.hpp>
 #include <unordered_map>
+#include "model/converters/pb_block_factory.hpp"
 #include "model/converters/pb_query_factory.hpp"
 #include "model/converters/pb_query_response_factory.hpp"
+#include "torii/processor/block_streamer.hpp"
 #include "torii/processor/query_processor.hpp"
+#include "torii/response_map.hpp"
 
 namespace torii {
   /**
@@ -38,27 +44,98 @@ namespace torii {
             pb_query_factory,
         std::shared_ptr<iroha::model::converters::PbQueryResponseFactory>
             pb_query_response_factory,
-        std::shared_ptr<iroha::torii::QueryProcessor> query_processor);
+        std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
+        std::shared_ptr<iroha::torii::BlockStreamer> block_streamer);
 
     QueryService(const QueryService &) = delete;
     QueryService &operator=(const QueryService &) = delete;
 
+    using FindCallback = std::function<void()>;
+
     /**
      * actual implementation of async Find in QueryService
+     * Query is executed by query processor apart from the calling thread
      * @param request - Query
-     * @param response - QueryResponse
+     * @param response - QueryResponse, must outlive the query
+     * @param on_response - invoked once response is set, may be invoked
+     * at once or from another thread
      */
     void FindAsync(iroha::protocol::Query const &request,
-                   iroha::protocol::QueryResponse &response);
+                   iroha::protocol::QueryResponse &response,
+                   FindCallback on_response);
+
+    /**
+     * actual implementation of async FindBatch in QueryService
+     * Queries of the batch are executed together apart from the calling
+     * thread
+     * @param request - QueryBatch
+     * @param response - QueryBatchResponse, must outlive the batch
+     * @param on_response - invoked once response is set, may be invoked
+     * at once or from another thread
+     */
+    void FindBatchAsync(iroha::protocol::QueryBatch const &request,
+                        iroha::protocol::QueryBatchResponse &response,
+                        FindCallback on_response);
+
+    using PageCallback = std::function<void(bool has_next)>;
+
+    /**
+     * executes one page of query and moves its cursor to the next page
+     * @param request - query, its cursor is advanced in place, must
+     * outlive the query
+     * @param response - QueryResponse with the page, must outlive the query
+     * @param on_page - invoked once response is set, gets true if there
+     * is a next page
+     */
+    void FindNextPageAsync(iroha::protocol::Query &request,
+                           iroha::protocol::QueryResponse &response,
+                           PageCallback on_page);
+
+    using BlockCallback =
+        std::function<void(const iroha::protocol::BlockEvent &event)>;
+
+    /**
+     * actual implementation of async SubscribeBlocks in QueryService
+     * @param request - BlocksSubscription
+     * @param callback - receives blocks in order of height
+     * @return id of subscription, none if resume token does not match
+     * the ledger
+     */
+    nonstd::optional<uint64_t> SubscribeBlocksAsync(
+        iroha::protocol::BlocksSubscription const &request,
+        BlockCallback callback);
+
+    /**
+     * acknowledges that one block is delivered to subscriber,
+     * so the next one can be sent
+     * @param id - id of subscription
+     */
+    void blockDelivered(uint64_t id);
+
+    /**
+     * stops block subscription
+     * @param id - id of subscription
+     */
+    void cancelBlocksSubscription(uint64_t id);
+
+    /**
+     * @return counters of pending Find requests
+     */
+    const ResponseMapMetrics &responseMetrics() const;
 
    private:
     std::shared_ptr<iroha::model::converters::PbQueryFactory> pb_query_factory_;
     std::shared_ptr<iroha::model::converters::PbQueryResponseFactory>
         pb_query_response_factory_;
     std::shared_ptr<iroha::torii::QueryProcessor> query_processor_;
+    std::shared_ptr<iroha::torii::BlockStreamer> block_streamer_;
+    iroha::model::converters::PbBlockFactory pb_block_factory_;
 
-    std::unordered_map<std::string, iroha::protocol::QueryResponse &>
-        handler_map_;
+    ResponseMap<iroha::protocol::QueryResponse> handler_map_;
+    ResponseMap<iroha::protocol::QueryBatchResponse> batch_map_;
+    // callbacks of pending Find requests by query hash
+    std::unordered_map<std::string, FindCallback> find_callbacks_;
+    std::mutex find_callbacks_mutex_;
   };
 
 }  // namespace torii
@@ -0,0 +1,214 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_RESPONSE_MAP_HPP
+#define IROHA_RESPONSE_MAP_HPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace torii {
+
+  /**
+   * Counters of response map
+   */
+  struct ResponseMapMetrics {
+    std::atomic<uint64_t> outstanding{0};
+    std::atomic<uint64_t> inserted{0};
+    std::atomic<uint64_t> completed{0};
+    std::atomic<uint64_t> expired{0};
+    std::atomic<uint64_t> evicted{0};
+  };
+
+  /**
+   * Thread-safe map from request hash to response of pending rpc
+   * Entry is removed when request is completed, after ttl,
+   * or when capacity is exceeded (the oldest entry goes first)
+   * Callback of entry is invoked once it is removed, so pending rpc is
+   * answered in any case
+   * @tparam Response - type of response, e.g. ToriiResponse
+   */
+  template <typename Response>
+  class ResponseMap {
+   public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void()>;
+    using DropHandler = std::function<void(Response &)>;
+
+    /**
+     * @param capacity - maximum number of outstanding requests
+     * @param ttl - time after which outstanding request is forgotten
+     * @param on_drop - fills response of request forgotten before it is
+     * completed, may be empty
+     */
+    ResponseMap(size_t capacity,
+                Clock::duration ttl,
+                DropHandler on_drop = nullptr)
+        : capacity_(capacity), ttl_(ttl), on_drop_(std::move(on_drop)) {}
+
+    /**
+     * Register response of pending request
+     * @param hash - hash of request
+     * @param response - response to be filled, must outlive the entry
+     * @param on_response - invoked once entry is removed, may be empty
+     * @return false if request with the same hash is pending, callback is
+     * not invoked then
+     */
+    bool insert(const std::string &hash,
+                Response &response,
+                Callback on_response = nullptr) {
+      auto now = Clock::now();
+      std::vector<Callback> dropped;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        expire(now, dropped);
+        if (index_.count(hash)) {
+          invoke(dropped);
+          return false;
+        }
+        entries_.push_back(
+            {hash, &response, now + ttl_, std::move(on_response)});
+        index_.emplace(hash, std::prev(entries_.end()));
+        ++metrics_.inserted;
+        while (entries_.size() > capacity_) {
+          drop(entries_.begin(), dropped);
+          ++metrics_.evicted;
+        }
+        metrics_.outstanding = entries_.size();
+      }
+      invoke(dropped);
+      return true;
+    }
+
+    /**
+     * Apply function to response of pending request
+     * @param hash - hash of request
+     * @param f - function taking Response &
+     * @return false if no request with the hash is pending
+     */
+    template <typename F>
+    bool update(const std::string &hash, F &&f) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = index_.find(hash);
+      if (it == index_.end()) {
+        return false;
+      }
+      f(*it->second->response);
+      return true;
+    }
+
+    /**
+     * Forget pending request once its response is set and invoke its
+     * callback
+     * @param hash - hash of request
+     */
+    void complete(const std::string &hash) {
+      Callback on_response;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(hash);
+        if (it == index_.end()) {
+          return;
+        }
+        on_response = std::move(it->second->on_response);
+        remove(it->second);
+        ++metrics_.completed;
+        metrics_.outstanding = entries_.size();
+      }
+      if (on_response) {
+        on_response();
+      }
+    }
+
+    /**
+     * @return counters of map
+     */
+    const ResponseMapMetrics &metrics() const {
+      return metrics_;
+    }
+
+   private:
+    struct Entry {
+      std::string hash;
+      Response *response;
+      Clock::time_point deadline;
+      Callback on_response;
+    };
+    using Iterator = typename std::list<Entry>::iterator;
+
+    void remove(Iterator it) {
+      index_.erase(it->hash);
+      entries_.erase(it);
+    }
+
+    /**
+     * Forget request which is not completed, its response is filled by
+     * drop handler
+     * @param it - entry of request
+     * @param dropped - receives callback of request
+     */
+    void drop(Iterator it, std::vector<Callback> &dropped) {
+      if (on_drop_) {
+        on_drop_(*it->response);
+      }
+      if (it->on_response) {
+        dropped.push_back(std::move(it->on_response));
+      }
+      remove(it);
+    }
+
+    /**
+     * Invoke callbacks of dropped requests, the map is not locked,
+     * so callbacks may delete their responses
+     */
+    static void invoke(std::vector<Callback> &dropped) {
+      for (auto &on_response : dropped) {
+        on_response();
+      }
+    }
+
+    /**
+     * Forget requests pending longer than ttl
+     * Entries are ordered by insertion, so are their deadlines
+     * @param now - current time
+     * @param dropped - receives callbacks of forgotten requests
+     */
+    void expire(Clock::time_point now, std::vector<Callback> &dropped) {
+      while (not entries_.empty() and entries_.front().deadline <= now) {
+        drop(entries_.begin(), dropped);
+        ++metrics_.expired;
+      }
+    }
+
+    size_t capacity_;
+    Clock::duration ttl_;
+    DropHandler on_drop_;
+    std::list<Entry> entries_;
+    std::unordered_map<std::string, Iterator> index_;
+    std::mutex mutex_;
+    ResponseMapMetrics metrics_;
+  };
+
+}  // namespace torii
+
+#endif  // IROHA_RESPONSE_MAP_HPP
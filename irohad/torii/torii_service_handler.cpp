@@ -17,6 +17,9 @@ limitations under the License.
 #include <endpoint.grpc.pb.h>
 #include <grpc/support/time.h>
 #include <unistd.h>
+#include <algorithm>
+#include <mutex>
+#include <thread>
 #include <network/grpc_async_service.hpp>
 #include <network/grpc_call.hpp>
 #include <torii/command_service.hpp>
@@ -27,43 +30,126 @@ namespace prot = iroha::protocol;
 
 namespace torii {
 
+  namespace {
+    /**
+     * state of FindStream rpc shared by its callbacks
+     */
+    struct PageStream {
+      prot::Query query;
+      prot::QueryResponse response;
+      std::mutex mutex;
+      // the last page is written or the rpc is over
+      bool over = false;
+    };
+  }  // namespace
+
   /**
    * registers async command service
    * @param builder
    */
-  ToriiServiceHandler::ToriiServiceHandler(::grpc::ServerBuilder& builder) {
+  ToriiServiceHandler::ToriiServiceHandler(::grpc::ServerBuilder& builder,
+                                           size_t queues,
+                                           size_t threads)
+      : threads_(std::max(threads, std::max<size_t>(queues, 1))) {
     builder.RegisterService(&commandAsyncService_);
     builder.RegisterService(&queryAsyncService_);
-    completionQueue_ = builder.AddCompletionQueue();
+    for (size_t i = 0; i < std::max<size_t>(queues, 1); ++i) {
+      completionQueues_.push_back(builder.AddCompletionQueue());
+    }
   }
 
   ToriiServiceHandler::~ToriiServiceHandler() {}
 
   /**
-   * shuts down service handler. (actually, shuts down completion queue only)
+   * shuts down service handler. (actually, shuts down completion queues only)
    */
-  void ToriiServiceHandler::shutdown() { completionQueue_->Shutdown(); }
+  void ToriiServiceHandler::shutdown() {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (isShutdown_) {
+      return;
+    }
+    isShutdown_ = true;
+    for (auto& cq : completionQueues_) {
+      cq->Shutdown();
+    }
+  }
 
   /**
-   * handles rpcs loop in CommandService.
+   * handles rpcs loop in CommandService and QueryService.
    */
   void ToriiServiceHandler::handleRpcs() {
-    // CommandService::Torii()
-    enqueueRequest<prot::CommandService::AsyncService, prot::Transaction,
-                   prot::ToriiResponse>(
-        &prot::CommandService::AsyncService::RequestTorii,
-        &ToriiServiceHandler::ToriiHandler, commandAsyncService_);
+    // every worker of a queue should have a pending call of each rpc,
+    // otherwise workers idle while clients wait for a new call
+    auto calls_per_queue =
+        (threads_ + completionQueues_.size() - 1) / completionQueues_.size();
+    for (auto& cq : completionQueues_) {
+      for (size_t i = 0; i < calls_per_queue; ++i) {
+        // CommandService::Torii()
+        enqueueRequest<prot::CommandService::AsyncService, prot::Transaction,
+                       prot::ToriiResponse>(
+            &prot::CommandService::AsyncService::RequestTorii,
+            &ToriiServiceHandler::ToriiHandler, commandAsyncService_,
+            cq.get());
 
-    // QueryService::Find()
-    enqueueRequest<prot::QueryService::AsyncService, prot::Query,
-                   prot::QueryResponse>(
-        &prot::QueryService::AsyncService::RequestFind,
-        &ToriiServiceHandler::QueryFindHandler, queryAsyncService_);
+        // CommandService::ToriiBatch()
+        enqueueRequest<prot::CommandService::AsyncService, prot::TxList,
+                       prot::ToriiBatchResponse>(
+            &prot::CommandService::AsyncService::RequestToriiBatch,
+            &ToriiServiceHandler::ToriiBatchHandler, commandAsyncService_,
+            cq.get());
 
+        // CommandService::StatusStream()
+        enqueueStreamRequest<prot::CommandService::AsyncService,
+                             prot::TxStatusRequest, prot::TxStatusResponse>(
+            &prot::CommandService::AsyncService::RequestStatusStream,
+            &ToriiServiceHandler::StatusStreamHandler, commandAsyncService_,
+            cq.get());
+
+        // QueryService::Find()
+        enqueueRequest<prot::QueryService::AsyncService, prot::Query,
+                       prot::QueryResponse>(
+            &prot::QueryService::AsyncService::RequestFind,
+            &ToriiServiceHandler::QueryFindHandler, queryAsyncService_,
+            cq.get());
+
+        // QueryService::FindBatch()
+        enqueueRequest<prot::QueryService::AsyncService, prot::QueryBatch,
+                       prot::QueryBatchResponse>(
+            &prot::QueryService::AsyncService::RequestFindBatch,
+            &ToriiServiceHandler::FindBatchHandler, queryAsyncService_,
+            cq.get());
+
+        // QueryService::FindStream()
+        enqueueStreamRequest<prot::QueryService::AsyncService, prot::Query,
+                             prot::QueryResponse>(
+            &prot::QueryService::AsyncService::RequestFindStream,
+            &ToriiServiceHandler::FindStreamHandler, queryAsyncService_,
+            cq.get());
+
+        // QueryService::SubscribeBlocks()
+        enqueueStreamRequest<prot::QueryService::AsyncService,
+                             prot::BlocksSubscription, prot::BlockEvent>(
+            &prot::QueryService::AsyncService::RequestSubscribeBlocks,
+            &ToriiServiceHandler::SubscribeBlocksHandler, queryAsyncService_,
+            cq.get());
+      }
+    }
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < threads_; ++i) {
+      auto cq = completionQueues_[i % completionQueues_.size()].get();
+      workers.emplace_back([this, cq] { this->drainQueue(cq); });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+
+  void ToriiServiceHandler::drainQueue(::grpc::ServerCompletionQueue* cq) {
     /**
      * tag is a state corresponding to one rpc connection.
-     * ok is true if read a regular event, false otherwise (e.g. grpc::Alarm is
-     * not a regular event).
+     * ok is true if read a regular event, false otherwise (e.g. a pending
+     * request cancelled by server shutdown).
      */
     void* tag;
     bool ok;
@@ -71,52 +157,181 @@ namespace torii {
     /**
      * pulls a state of a new client's rpc request from completion queue.
      * If no request, CompletionQueue::Next() waits a new request (blocks this
-     * thread). CompletionQueue::Next() returns false if
-     * completionQueue_->Shutdown() is executed.
+     * thread). CompletionQueue::Next() returns false once cq->Shutdown() is
+     * executed and the queue is drained.
      */
-    while (completionQueue_->Next(&tag, &ok)) {
+    while (cq->Next(&tag, &ok)) {
       auto callbackTag =
           static_cast<network::UntypedCall<ToriiServiceHandler>::CallOwner*>(
               tag);
-      if (ok && callbackTag) {
-        /*assert(callbackTag);*/
-        callbackTag->onCompleted(this);
-      } else {
-        isShutdownCompletionQueue_ = true;
-        break;
+      if (callbackTag) {
+        callbackTag->onCompleted(this, ok);
       }
     }
+    ++drainedWorkers_;
   }
 
   /**
    * extracts request and response from Call instance
    * and calls an actual CommandService::AsyncTorii() implementation.
-   * then, spawns a new Call instance to serve an another client.
+   * then, spawns a new Call instance on the same queue to serve an another
+   * client.
    */
   void ToriiServiceHandler::ToriiHandler(
       CommandServiceCall<prot::Transaction, prot::ToriiResponse>* call) {
-    command_service_->ToriiAsync(call->request(), call->response());
-    call->sendResponse(grpc::Status::OK);
+    auto cq = call->completionQueue();
+    // response is sent once transaction is validated, call is deleted then
+    command_service_->ToriiAsync(call->request(), call->response(), [call] {
+      call->sendResponse(grpc::Status::OK);
+    });
 
     // Spawn a new Call instance to serve an another client.
     enqueueRequest<prot::CommandService::AsyncService, prot::Transaction,
                    prot::ToriiResponse>(
         &prot::CommandService::AsyncService::RequestTorii,
-        &ToriiServiceHandler::ToriiHandler, commandAsyncService_);
+        &ToriiServiceHandler::ToriiHandler, commandAsyncService_, cq);
+  }
+
+  void ToriiServiceHandler::ToriiBatchHandler(
+      CommandServiceCall<prot::TxList, prot::ToriiBatchResponse>* call) {
+    auto cq = call->completionQueue();
+    // response is sent once batch is validated, call is deleted then
+    command_service_->ToriiBatchAsync(
+        call->request(), call->response(), [call] {
+          call->sendResponse(grpc::Status::OK);
+        });
+
+    // Spawn a new Call instance to serve an another client.
+    enqueueRequest<prot::CommandService::AsyncService, prot::TxList,
+                   prot::ToriiBatchResponse>(
+        &prot::CommandService::AsyncService::RequestToriiBatch,
+        &ToriiServiceHandler::ToriiBatchHandler, commandAsyncService_, cq);
+  }
+
+  void ToriiServiceHandler::StatusStreamHandler(
+      CommandServiceStreamCall<prot::TxStatusRequest, prot::TxStatusResponse>*
+          call) {
+    auto cq = call->completionQueue();
+    auto id = command_service_->StatusStreamAsync(
+        call->request(), [call](const auto& status, bool last) {
+          call->write(status);
+          if (last) {
+            call->finish(grpc::Status::OK);
+          }
+        });
+    auto command_service = command_service_.get();
+    call->setOnDone(
+        [command_service, id] { command_service->cancelStatusStream(id); });
+
+    // Spawn a new Call instance to serve an another client.
+    enqueueStreamRequest<prot::CommandService::AsyncService,
+                         prot::TxStatusRequest, prot::TxStatusResponse>(
+        &prot::CommandService::AsyncService::RequestStatusStream,
+        &ToriiServiceHandler::StatusStreamHandler, commandAsyncService_, cq);
   }
 
   void ToriiServiceHandler::QueryFindHandler(
       QueryServiceCall<iroha::protocol::Query, iroha::protocol::QueryResponse>*
           call) {
-    query_service_->FindAsync(call->request(), call->response());
-    call->sendResponse(grpc::Status::OK);
+    auto cq = call->completionQueue();
+    // response is sent when query is executed, call is deleted after that
+    query_service_->FindAsync(call->request(), call->response(), [call] {
+      call->sendResponse(grpc::Status::OK);
+    });
 
     // Spawn a new Call instance to serve an another client.
     enqueueRequest<prot::QueryService::AsyncService, prot::Query,
                    prot::QueryResponse>(
         &prot::QueryService::AsyncService::RequestFind,
-        &ToriiServiceHandler::QueryFindHandler, queryAsyncService_);
+        &ToriiServiceHandler::QueryFindHandler, queryAsyncService_, cq);
+  }
+
+  void ToriiServiceHandler::FindBatchHandler(
+      QueryServiceCall<prot::QueryBatch, prot::QueryBatchResponse>* call) {
+    auto cq = call->completionQueue();
+    // response is sent when batch is executed, call is deleted after that
+    query_service_->FindBatchAsync(call->request(), call->response(), [call] {
+      call->sendResponse(grpc::Status::OK);
+    });
+
+    // Spawn a new Call instance to serve an another client.
+    enqueueRequest<prot::QueryService::AsyncService, prot::QueryBatch,
+                   prot::QueryBatchResponse>(
+        &prot::QueryService::AsyncService::RequestFindBatch,
+        &ToriiServiceHandler::FindBatchHandler, queryAsyncService_, cq);
   }
+
+  void ToriiServiceHandler::FindStreamHandler(
+      QueryServiceStreamCall<prot::Query, prot::QueryResponse>* call) {
+    auto cq = call->completionQueue();
+    auto stream = std::make_shared<PageStream>();
+    stream->query = call->request();
+    auto query_service = query_service_.get();
+    // the next page is read once the previous one is written,
+    // so pages are never read concurrently
+    auto sendPage = [call, stream, query_service] {
+      {
+        std::lock_guard<std::mutex> lock(stream->mutex);
+        if (stream->over) {
+          return;
+        }
+      }
+      query_service->FindNextPageAsync(
+          stream->query, stream->response, [call, stream](bool has_next) {
+            std::lock_guard<std::mutex> lock(stream->mutex);
+            if (stream->over) {
+              // rpc is over, call may be deleted
+              return;
+            }
+            stream->over = not has_next;
+            call->write(stream->response);
+            if (stream->over) {
+              call->finish(grpc::Status::OK);
+            }
+          });
+    };
+    call->setOnWritten(sendPage);
+    call->setOnDone([stream] {
+      std::lock_guard<std::mutex> lock(stream->mutex);
+      stream->over = true;
+    });
+    sendPage();
+
+    // Spawn a new Call instance to serve an another client.
+    enqueueStreamRequest<prot::QueryService::AsyncService, prot::Query,
+                         prot::QueryResponse>(
+        &prot::QueryService::AsyncService::RequestFindStream,
+        &ToriiServiceHandler::FindStreamHandler, queryAsyncService_, cq);
+  }
+
+  void ToriiServiceHandler::SubscribeBlocksHandler(
+      QueryServiceStreamCall<prot::BlocksSubscription, prot::BlockEvent>*
+          call) {
+    auto cq = call->completionQueue();
+    auto id = query_service_->SubscribeBlocksAsync(
+        call->request(),
+        [call](const prot::BlockEvent& event) { call->write(event); });
+    if (id.has_value()) {
+      auto query_service = query_service_.get();
+      auto subscription = id.value();
+      call->setOnWritten([query_service, subscription] {
+        query_service->blockDelivered(subscription);
+      });
+      call->setOnDone([query_service, subscription] {
+        query_service->cancelBlocksSubscription(subscription);
+      });
+    } else {
+      call->finish(grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                                "resume token does not match the ledger"));
+    }
+
+    // Spawn a new Call instance to serve an another client.
+    enqueueStreamRequest<prot::QueryService::AsyncService,
+                         prot::BlocksSubscription, prot::BlockEvent>(
+        &prot::QueryService::AsyncService::RequestSubscribeBlocks,
+        &ToriiServiceHandler::SubscribeBlocksHandler, queryAsyncService_, cq);
+  }
+
   void ToriiServiceHandler::assignCommandHandler(
       std::unique_ptr<torii::CommandService> command_service) {
     command_service_ = std::move(command_service);
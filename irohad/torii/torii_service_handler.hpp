@@ -19,6 +19,8 @@ limitations under the License.
 
 #include <endpoint.grpc.pb.h>
 #include <endpoint.pb.h>
+#include <atomic>
+#include <vector>
 #include <network/grpc_async_service.hpp>
 #include <network/grpc_call.hpp>
 #include "torii/command_service.hpp"
@@ -33,8 +35,13 @@ namespace torii {
     /**
      * requires builder to use same server.
      * @param builder
+     * @param queues - number of completion queues serving rpcs
+     * @param threads - number of worker threads draining the queues,
+     * at least one per queue
      */
-    ToriiServiceHandler(::grpc::ServerBuilder& builder);
+    ToriiServiceHandler(::grpc::ServerBuilder& builder,
+                        size_t queues = 1,
+                        size_t threads = 1);
 
     void assignCommandHandler(
         std::unique_ptr<torii::CommandService> command_service);
@@ -49,28 +56,42 @@ namespace torii {
                       iroha::protocol::CommandService::AsyncService,
                       RequestType, ResponseType>;
 
+    template <typename RequestType, typename ResponseType>
+    using CommandServiceStreamCall =
+        network::ServerStreamCall<ToriiServiceHandler,
+                                  iroha::protocol::CommandService::AsyncService,
+                                  RequestType, ResponseType>;
+
     template <typename RequestType, typename ResponseType>
     using QueryServiceCall =
         network::Call<ToriiServiceHandler,
                       iroha::protocol::QueryService::AsyncService, RequestType,
                       ResponseType>;
 
+    template <typename RequestType, typename ResponseType>
+    using QueryServiceStreamCall =
+        network::ServerStreamCall<ToriiServiceHandler,
+                                  iroha::protocol::QueryService::AsyncService,
+                                  RequestType, ResponseType>;
+
     /**
-     * handles rpcs loop in CommandService.
+     * handles rpcs loop in CommandService and QueryService.
+     * spawns worker threads over the completion queues and blocks until
+     * all of them are drained.
      */
     virtual void handleRpcs() override;
 
     /**
-     * releases the completion queue of CommandService.
+     * releases the completion queues of the services.
      * @note Call this method after calling server->Shutdown() in ServerRunner
      */
     virtual void shutdown() override;
 
     /**
-     * @return true if completion queue has been shut down.
+     * @return true if all completion queues have been drained.
      */
     bool isShutdownCompletionQueue() const {
-      return isShutdownCompletionQueue_;
+      return drainedWorkers_ == threads_;
     }
 
    private:
@@ -79,6 +100,8 @@ namespace torii {
      * @param requester  - pointer to request method. e.g.
      * &CommandService::AsyncService::RequestTorii
      * @param rpcHandler - handler of rpc in ServiceHandler.
+     * @param asyncService - service the rpc belongs to
+     * @param cq - completion queue to serve the rpc on
      */
     template <typename AsyncService, typename RequestType,
               typename ResponseType>
@@ -88,16 +111,48 @@ namespace torii {
         network::RpcHandler<ToriiServiceHandler, AsyncService, RequestType,
                             ResponseType>
             rpcHandler,
-        AsyncService& asyncService) {
+        AsyncService& asyncService,
+        ::grpc::ServerCompletionQueue* cq) {
       std::unique_lock<std::mutex> lock(mtx_);
       if (!isShutdown_) {
         network::Call<ToriiServiceHandler, AsyncService, RequestType,
-                      ResponseType>::enqueueRequest(&asyncService,
-                                                    completionQueue_.get(),
+                      ResponseType>::enqueueRequest(&asyncService, cq,
                                                     requester, rpcHandler);
       }
     }
 
+    /**
+     * helper to call ServerStreamCall::enqueueRequest()
+     * @param requester  - pointer to request method. e.g.
+     * &CommandService::AsyncService::RequestStatusStream
+     * @param rpcHandler - handler of rpc in ServiceHandler.
+     * @param asyncService - service the rpc belongs to
+     * @param cq - completion queue to serve the rpc on
+     */
+    template <typename AsyncService, typename RequestType,
+              typename ResponseType>
+    void enqueueStreamRequest(
+        network::StreamRequestMethod<AsyncService, RequestType, ResponseType>
+            requester,
+        network::StreamRpcHandler<ToriiServiceHandler, AsyncService,
+                                  RequestType, ResponseType>
+            rpcHandler,
+        AsyncService& asyncService,
+        ::grpc::ServerCompletionQueue* cq) {
+      std::unique_lock<std::mutex> lock(mtx_);
+      if (!isShutdown_) {
+        network::ServerStreamCall<ToriiServiceHandler, AsyncService,
+                                  RequestType, ResponseType>::
+            enqueueRequest(&asyncService, cq, requester, rpcHandler);
+      }
+    }
+
+    /**
+     * pulls events from the completion queue until it is shut down.
+     * @param cq - queue drained by the calling thread
+     */
+    void drainQueue(::grpc::ServerCompletionQueue* cq);
+
     /**
      * extracts request and response from Call instance
      * and calls an actual CommandService::AsyncTorii() implementation.
@@ -106,16 +161,50 @@ namespace torii {
     void ToriiHandler(CommandServiceCall<iroha::protocol::Transaction,
                                          iroha::protocol::ToriiResponse>*);
 
+    void ToriiBatchHandler(
+        CommandServiceCall<iroha::protocol::TxList,
+                           iroha::protocol::ToriiBatchResponse>*);
+
+    /**
+     * subscribes the stream to statuses of transaction in CommandService,
+     * the subscription is cancelled when the rpc is over.
+     */
+    void StatusStreamHandler(
+        CommandServiceStreamCall<iroha::protocol::TxStatusRequest,
+                                 iroha::protocol::TxStatusResponse>*);
+
     void QueryFindHandler(QueryServiceCall<iroha::protocol::Query,
                                            iroha::protocol::QueryResponse>*);
 
+    void FindBatchHandler(
+        QueryServiceCall<iroha::protocol::QueryBatch,
+                         iroha::protocol::QueryBatchResponse>*);
+
+    /**
+     * streams pages of query from QueryService,
+     * next page is read when the previous one is delivered.
+     */
+    void FindStreamHandler(
+        QueryServiceStreamCall<iroha::protocol::Query,
+                               iroha::protocol::QueryResponse>*);
+
+    /**
+     * subscribes the stream to committed blocks in QueryService,
+     * next block is sent when the previous one is delivered.
+     */
+    void SubscribeBlocksHandler(
+        QueryServiceStreamCall<iroha::protocol::BlocksSubscription,
+                               iroha::protocol::BlockEvent>*);
+
    private:
     iroha::protocol::CommandService::AsyncService commandAsyncService_;
     iroha::protocol::QueryService::AsyncService queryAsyncService_;
-    std::unique_ptr<grpc::ServerCompletionQueue> completionQueue_;
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>>
+        completionQueues_;
+    const size_t threads_;
     std::mutex mtx_;
-    bool isShutdown_ = false;                 // called shutdown()
-    bool isShutdownCompletionQueue_ = false;  // called cq_->Shutdown()
+    bool isShutdown_ = false;  // called shutdown()
+    std::atomic<size_t> drainedWorkers_{0};  // workers whose queue is drained
 
     std::unique_ptr<torii::CommandService> command_service_;
     std::unique_ptr<torii::QueryService> query_service_;
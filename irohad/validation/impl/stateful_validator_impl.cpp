@@ -17,11 +17,64 @@
 
 #include <algorithm>
 #include <numeric>
+#include "common/types.hpp"
+#include "model/commands/add_asset_quantity.hpp"
+#include "model/commands/add_signatory.hpp"
+#include "model/commands/assign_master_key.hpp"
+#include "model/commands/remove_signatory.hpp"
+#include "model/commands/set_permissions.hpp"
+#include "model/commands/set_quorum.hpp"
+#include "model/commands/transfer_asset.hpp"
 #include "validation/impl/stateful_validator_impl.hpp"
 
 namespace iroha {
   namespace validation {
 
+    namespace {
+      /**
+       * Collect keys of world state view read during validation of proposal
+       * @param proposal
+       * @return keys to prefetch
+       */
+      ametsuchi::PrefetchKeys collectKeys(const model::Proposal &proposal) {
+        using namespace model;
+        ametsuchi::PrefetchKeys keys;
+        for (const auto &tx : proposal.transactions) {
+          keys.account_ids.insert(tx.creator_account_id);
+          for (const auto &command : tx.commands) {
+            if (instanceof <TransferAsset>(*command)) {
+              const auto &transfer =
+                  static_cast<const TransferAsset &>(*command);
+              keys.asset_ids.insert(transfer.asset_id);
+              keys.account_ids.insert(transfer.dest_account_id);
+              keys.account_asset_ids.emplace(transfer.src_account_id,
+                                             transfer.asset_id);
+            } else if (instanceof <AddAssetQuantity>(*command)) {
+              const auto &add = static_cast<const AddAssetQuantity &>(*command);
+              keys.asset_ids.insert(add.asset_id);
+            } else if (instanceof <AddSignatory>(*command)) {
+              keys.account_ids.insert(
+                  static_cast<const AddSignatory &>(*command).account_id);
+            } else if (instanceof <AssignMasterKey>(*command)) {
+              keys.account_ids.insert(
+                  static_cast<const AssignMasterKey &>(*command).account_id);
+            } else if (instanceof <RemoveSignatory>(*command)) {
+              keys.account_ids.insert(
+                  static_cast<const RemoveSignatory &>(*command).account_id);
+            } else if (instanceof <SetQuorum>(*command)) {
+              keys.account_ids.insert(
+                  static_cast<const SetQuorum &>(*command).account_id);
+            } else if (instanceof <SetAccountPermissions>(*command)) {
+              keys.account_ids.insert(
+                  static_cast<const SetAccountPermissions &>(*command)
+                      .account_id);
+            }
+          }
+        }
+        return keys;
+      }
+    }  // namespace
+
     StatefulValidatorImpl::StatefulValidatorImpl() {
       log_ = logger::log("SFV");
     }
@@ -30,6 +83,8 @@ namespace iroha {
         const model::Proposal &proposal,
         ametsuchi::TemporaryWsv &temporaryWsv) {
       log_->info("transactions in proposal: {}", proposal.transactions.size());
+      // read state of the whole proposal in batches instead of per command
+      temporaryWsv.prefetch(collectKeys(proposal));
       auto checking_transaction = [&temporaryWsv](auto &tx, auto &executor,
                                                   auto &query) {
         auto account = temporaryWsv.getAccount(tx.creator_account_id);
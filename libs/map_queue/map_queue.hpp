@@ -47,7 +47,7 @@ class MapQueue {
   // erase last push node
   size_t pop_last() {
     if (data_.empty()) return data_.size();
-    Key& k = cache_.front();
+    Key k = cache_.front();
     cache_.pop_front();
     if (max_cache_.front() == k) max_cache_.pop_front();
     data_.erase(k);
@@ -90,6 +90,9 @@ class MapQueue {
     while (!max_cache_.empty() && max_cache_.back() < k) max_cache_.pop_back();
     max_cache_.push_back(k);
     data_[k] = std::move(v);
+    while (data_.size() > max_cache_size_) {
+      pop_last();
+    }
     return data_.size();
   }
   size_t set(const Key& k, const Value& v) {
@@ -108,6 +111,15 @@ class MapQueue {
   }
 
 
+  // get key that was pushed first
+  const Key& front() const {
+    if (cache_.empty()) throw std::out_of_range("cache_map");
+    return cache_.front();
+  }
+
+  // erase element that was pushed first
+  size_t pop() { return pop_last(); }
+
   // get maximum key
   const Key& getMaxKey() const {
     if( max_cache_.empty() ) throw std::out_of_range("cache_map");
@@ -64,4 +64,38 @@ namespace torii_utils {
     return status_;
   }
 
+  grpc::Status QuerySyncClient::FindBatch(
+      const iroha::protocol::QueryBatch &batch,
+      iroha::protocol::QueryBatchResponse &response) {
+    grpc::ClientContext context;
+    return stub_->FindBatch(&context, batch, &response);
+  }
+
+  grpc::Status QuerySyncClient::FindStream(
+      const iroha::protocol::Query &query,
+      std::function<void(const iroha::protocol::QueryResponse &)> callback) {
+    grpc::ClientContext context;
+    auto reader = stub_->FindStream(&context, query);
+    iroha::protocol::QueryResponse response;
+    while (reader->Read(&response)) {
+      callback(response);
+    }
+    return reader->Finish();
+  }
+
+  grpc::Status QuerySyncClient::SubscribeBlocks(
+      const iroha::protocol::BlocksSubscription &request,
+      std::function<bool(const iroha::protocol::BlockEvent &)> callback) {
+    grpc::ClientContext context;
+    auto reader = stub_->SubscribeBlocks(&context, request);
+    iroha::protocol::BlockEvent event;
+    while (reader->Read(&event)) {
+      if (not callback(event)) {
+        context.TryCancel();
+        break;
+      }
+    }
+    return reader->Finish();
+  }
+
 }  // namespace torii
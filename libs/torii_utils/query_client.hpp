@@ -21,6 +21,7 @@ limitations under the License.
 #include <endpoint.pb.h>
 #include <grpc++/grpc++.h>
 #include <grpc++/channel.h>
+#include <functional>
 #include <memory>
 #include <thread>
 
@@ -42,6 +43,35 @@ namespace torii_utils {
      */
     grpc::Status Find(const iroha::protocol::Query &query, iroha::protocol::QueryResponse &response);
 
+    /**
+     * requests queries of the batch at once (blocking, sync)
+     * @param batch - signed queries
+     * @param response - responses in order of queries
+     * @return grpc::Status
+     */
+    grpc::Status FindBatch(const iroha::protocol::QueryBatch &batch,
+                           iroha::protocol::QueryBatchResponse &response);
+
+    /**
+     * requests query and reads its pages (blocking, sync)
+     * @param query - contains Query what clients request.
+     * @param callback - invoked for each page
+     * @return grpc::Status
+     */
+    grpc::Status FindStream(
+        const iroha::protocol::Query &query,
+        std::function<void(const iroha::protocol::QueryResponse &)> callback);
+
+    /**
+     * subscribes to committed blocks and reads them (blocking, sync)
+     * @param request - height or resume token to start from
+     * @param callback - invoked for each block, returns false to stop
+     * @return grpc::Status - CANCELLED if stopped by callback
+     */
+    grpc::Status SubscribeBlocks(
+        const iroha::protocol::BlocksSubscription &request,
+        std::function<bool(const iroha::protocol::BlockEvent &)> callback);
+
   private:
     grpc::ClientContext context_;
     std::unique_ptr<iroha::protocol::QueryService::Stub> stub_;
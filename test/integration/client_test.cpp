@@ -18,6 +18,7 @@
 #include <responses.pb.h>
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 #include "module/irohad/network/network_mocks.hpp"
+#include "module/irohad/simulator/simulator_mocks.hpp"
 #include "module/irohad/validation/validation_mocks.hpp"
 
 #include "client.hpp"
@@ -47,13 +48,26 @@ class ClientServerTest : public testing::Test {
     th = std::thread([this] {
       // ----------- Command Service --------------
       pcsMock = std::make_shared<MockPeerCommunicationService>();
+      vpcMock = std::make_shared<
+          iroha::simulator::MockVerifiedProposalCreator>();
+      EXPECT_CALL(*pcsMock, on_proposal())
+          .WillRepeatedly(
+              Return(rxcpp::observable<>::empty<iroha::model::Proposal>()));
+      EXPECT_CALL(*pcsMock, on_commit())
+          .WillRepeatedly(Return(rxcpp::observable<>::empty<Commit>()));
+      EXPECT_CALL(*pcsMock, on_rejected())
+          .WillRepeatedly(Return(
+              rxcpp::observable<>::empty<iroha::model::Transaction>()));
+      EXPECT_CALL(*vpcMock, on_verified_proposal())
+          .WillRepeatedly(
+              Return(rxcpp::observable<>::empty<iroha::model::Proposal>()));
       svMock = std::make_shared<MockStatelessValidator>();
       wsv_query = std::make_shared<MockWsvQuery>();
       block_query = std::make_shared<MockBlockQuery>();
 
       auto tx_processor =
-          std::make_shared<iroha::torii::TransactionProcessorImpl>(pcsMock,
-                                                                   svMock);
+          std::make_shared<iroha::torii::TransactionProcessorImpl>(
+              pcsMock, svMock, vpcMock);
       auto pb_tx_factory =
           std::make_shared<iroha::model::converters::PbTransactionFactory>();
       auto command_service =
@@ -71,8 +85,11 @@ class ClientServerTest : public testing::Test {
       auto pb_query_resp_factory =
           std::make_shared<iroha::model::converters::PbQueryResponseFactory>();
 
+      auto block_streamer =
+          std::make_shared<iroha::torii::BlockStreamer>(block_query, pcsMock);
+
       auto query_service = std::make_unique<torii::QueryService>(
-          pb_query_factory, pb_query_resp_factory, qpi);
+          pb_query_factory, pb_query_resp_factory, qpi, block_streamer);
 
       //----------- Server run ----------------
       runner->run(std::move(command_service), std::move(query_service));
@@ -89,6 +106,7 @@ class ClientServerTest : public testing::Test {
   std::unique_ptr<ServerRunner> runner;
   std::thread th;
   std::shared_ptr<MockPeerCommunicationService> pcsMock;
+  std::shared_ptr<iroha::simulator::MockVerifiedProposalCreator> vpcMock;
   std::shared_ptr<MockStatelessValidator> svMock;
 
   std::shared_ptr<MockWsvQuery> wsv_query;
@@ -28,6 +28,8 @@
 #include "endpoint.grpc.pb.h"
 #include "main/genesis_block_server/genesis_block_server.hpp"
 #include "model/block.hpp"
+#include "model/commands/add_asset_quantity.hpp"
+#include "model/commands/create_account.hpp"
 #include "model/model_hash_provider_impl.hpp"
 
 using ::testing::Return;
@@ -232,3 +234,37 @@ TEST_F(iroha_cli_test, NormalWhenRunNetwork) {
                     bootstrap.run_network(peers, block);
                   });
 }
+
+TEST_F(iroha_cli_test, NormalWhenParseProvisioningFile) {
+  auto test_path = "/tmp/_bootstrap_test_provisioning.json";
+  auto pubkey = rnd_hex_pk();
+  std::ofstream ofs(test_path);
+  ofs << R"({
+  "domains":["ru"],
+  "assets":[{"asset_name":"coin", "domain_id":"ru", "precision":2}],
+  "accounts":[
+    {"account_name":"user", "domain_id":"ru", "pubkey":")" +
+          pubkey + R"(",
+     "balances":[{"asset_id":"coin#ru",
+                  "amount":{"int_part":1, "frac_part":50}}]}
+  ]
+}
+)";
+  ofs.close();
+
+  MockGenesisBlockClient client_mock;
+  iroha_cli::BootstrapNetwork bootstrap(client_mock);
+  auto block = bootstrap.parse_provisioning_file(test_path);
+  ASSERT_EQ(1, block.transactions.size());
+  auto &commands = block.transactions[0].commands;
+  ASSERT_EQ(4, commands.size());
+  auto create_account =
+      static_cast<iroha::model::CreateAccount *>(commands[2].get());
+  ASSERT_EQ(pubkey, create_account->pubkey.to_hexstring());
+  auto add_asset =
+      static_cast<iroha::model::AddAssetQuantity *>(commands[3].get());
+  ASSERT_EQ("user@ru", add_asset->account_id);
+  ASSERT_EQ(1, add_asset->amount.int_part);
+  ASSERT_EQ(50, add_asset->amount.frac_part);
+  ASSERT_EQ(0, remove(test_path));
+}
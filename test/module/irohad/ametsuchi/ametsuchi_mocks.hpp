@@ -22,6 +22,7 @@
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/mutable_factory.hpp"
 #include "ametsuchi/mutable_storage.hpp"
+#include "ametsuchi/read_only_wsv.hpp"
 #include "ametsuchi/temporary_factory.hpp"
 #include "ametsuchi/temporary_wsv.hpp"
 #include "ametsuchi/wsv_query.hpp"
@@ -41,7 +42,43 @@ namespace iroha {
       MOCK_METHOD2(getAccountAsset, nonstd::optional<model::AccountAsset>(
                                         const std::string &account_id,
                                         const std::string &asset_id));
+      MOCK_METHOD1(getAccountAssets,
+                   nonstd::optional<std::vector<model::AccountAsset>>(
+                       const std::string &account_id));
+      MOCK_METHOD5(getAssetHolders,
+                   nonstd::optional<std::vector<model::AccountAsset>>(
+                       const std::string &asset_id,
+                       const std::string &after_account_id,
+                       uint64_t after_balance,
+                       uint32_t limit,
+                       bool order_by_balance));
+      MOCK_METHOD0(getPeers, nonstd::optional<std::vector<model::Peer>>());
+    };
+
+    class MockReadOnlyWsv : public ReadOnlyWsv {
+     public:
+      MOCK_METHOD1(getAccount, nonstd::optional<model::Account>(
+                                   const std::string &account_id));
+      MOCK_METHOD1(getSignatories,
+                   nonstd::optional<std::vector<ed25519::pubkey_t>>(
+                       const std::string &account_id));
+      MOCK_METHOD1(getAsset,
+                   nonstd::optional<model::Asset>(const std::string &asset_id));
+      MOCK_METHOD2(getAccountAsset, nonstd::optional<model::AccountAsset>(
+                                        const std::string &account_id,
+                                        const std::string &asset_id));
+      MOCK_METHOD1(getAccountAssets,
+                   nonstd::optional<std::vector<model::AccountAsset>>(
+                       const std::string &account_id));
+      MOCK_METHOD5(getAssetHolders,
+                   nonstd::optional<std::vector<model::AccountAsset>>(
+                       const std::string &asset_id,
+                       const std::string &after_account_id,
+                       uint64_t after_balance,
+                       uint32_t limit,
+                       bool order_by_balance));
       MOCK_METHOD0(getPeers, nonstd::optional<std::vector<model::Peer>>());
+      MOCK_METHOD1(snapshot, bool(std::function<void()> function));
     };
 
     class MockWsvCommand : public WsvCommand {
@@ -50,6 +87,13 @@ namespace iroha {
       MOCK_METHOD1(updateAccount, bool(const model::Account &));
       MOCK_METHOD1(insertAsset, bool(const model::Asset &));
       MOCK_METHOD1(upsertAccountAsset, bool(const model::AccountAsset &));
+      MOCK_METHOD3(addAccountAssetBalance,
+                   bool(const std::string &, const std::string &, uint64_t));
+      MOCK_METHOD4(transferAccountAsset,
+                   bool(const std::string &,
+                        const std::string &,
+                        const std::string &,
+                        uint64_t));
       MOCK_METHOD1(insertSignatory, bool(const ed25519::pubkey_t &));
 
       MOCK_METHOD2(insertAccountSignatory,
@@ -70,8 +114,14 @@ namespace iroha {
       MOCK_METHOD1(
           getAccountTransactions,
           rxcpp::observable<model::Transaction>(std::string account_id));
+      MOCK_METHOD3(getAccountTransactions,
+                   nonstd::optional<TransactionPage>(
+                       const std::string &,
+                       const nonstd::optional<hash256_t> &,
+                       uint32_t));
       MOCK_METHOD2(getBlocks,
                    rxcpp::observable<model::Block>(uint32_t from, uint32_t to));
+      MOCK_METHOD0(getTopHeight, uint32_t());
     };
 
     class MockTemporaryFactory : public TemporaryFactory {
@@ -85,6 +135,10 @@ namespace iroha {
                    bool(const model::Block &,
                         std::function<bool(const model::Block &, WsvCommand &,
                                            WsvQuery &, const hash256_t &)>));
+      MOCK_METHOD2(applyBulk,
+                   bool(const std::vector<model::Block> &,
+                        std::function<bool(const model::Block &, WsvCommand &,
+                                           WsvQuery &)>));
       MOCK_METHOD1(getAccount, nonstd::optional<model::Account>(
                                    const std::string &account_id));
       MOCK_METHOD1(getSignatories,
@@ -95,6 +149,16 @@ namespace iroha {
       MOCK_METHOD2(getAccountAsset, nonstd::optional<model::AccountAsset>(
                                         const std::string &account_id,
                                         const std::string &asset_id));
+      MOCK_METHOD1(getAccountAssets,
+                   nonstd::optional<std::vector<model::AccountAsset>>(
+                       const std::string &account_id));
+      MOCK_METHOD5(getAssetHolders,
+                   nonstd::optional<std::vector<model::AccountAsset>>(
+                       const std::string &asset_id,
+                       const std::string &after_account_id,
+                       uint64_t after_balance,
+                       uint32_t limit,
+                       bool order_by_balance));
       MOCK_METHOD0(getPeers, nonstd::optional<std::vector<model::Peer>>());
     };
 
@@ -111,12 +175,12 @@ namespace iroha {
      public:
       MOCK_METHOD0(createMutableStorage, std::unique_ptr<MutableStorage>());
 
-      void commit(std::unique_ptr<MutableStorage> mutableStorage) override {
+      bool commit(std::unique_ptr<MutableStorage> mutableStorage) override {
         // gmock workaround for non-copyable parameters
-        commit_(mutableStorage);
+        return commit_(mutableStorage);
       }
 
-      MOCK_METHOD1(commit_, void(std::unique_ptr<MutableStorage> &));
+      MOCK_METHOD1(commit_, bool(std::unique_ptr<MutableStorage> &));
     };
 
     class MockPeerQuery : public PeerQuery {
@@ -16,8 +16,11 @@
  */
 
 #include <gtest/gtest.h>
+#include <limits>
 #include <cpp_redis/cpp_redis>
 #include <pqxx/pqxx>
+#include "ametsuchi/impl/postgres_wsv_command.hpp"
+#include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/impl/storage_impl.hpp"
 #include "common/types.hpp"
 #include "model/commands/add_asset_quantity.hpp"
@@ -60,6 +63,7 @@ namespace iroha {
         const auto drop =
             "DROP TABLE IF EXISTS account_has_asset;\n"
             "DROP TABLE IF EXISTS account_has_signatory;\n"
+        "DROP TABLE IF EXISTS account_has_tx;\n"
             "DROP TABLE IF EXISTS peer;\n"
             "DROP TABLE IF EXISTS account;\n"
             "DROP TABLE IF EXISTS exchange;\n"
@@ -267,6 +271,140 @@ namespace iroha {
           [](auto tx) { EXPECT_EQ(tx.commands.size(), 2); });
       storage->getAccountTransactions("admin2").subscribe(
           [](auto tx) { EXPECT_EQ(tx.commands.size(), 4); });
+
+      // Account transactions index tests
+      auto page =
+          storage->getAccountTransactions("admin2", nonstd::nullopt, 10);
+      ASSERT_TRUE(page);
+      ASSERT_EQ(page->transactions.size(), 1);
+      EXPECT_EQ(page->transactions.at(0).commands.size(), 4);
+      EXPECT_FALSE(page->next_hash);
+      // unknown cursor gives an empty page
+      hash256_t unknown;
+      unknown.fill(0xF);
+      page = storage->getAccountTransactions("admin2", unknown, 10);
+      ASSERT_TRUE(page);
+      EXPECT_EQ(page->transactions.size(), 0);
+    }
+
+    /**
+     * @given block committed before the account transactions index existed
+     * @when storage is created again
+     * @then transactions of the block are indexed from the block store
+     */
+    TEST_F(AmetsuchiTest, IndexesBlockStoreOnStart) {
+      auto storage =
+          StorageImpl::create(block_store_path, redishost_, redisport_, pgopt_);
+      ASSERT_TRUE(storage);
+
+      model::Transaction txn;
+      txn.creator_account_id = "admin1";
+      model::Block block;
+      block.transactions.push_back(txn);
+      block.height = 1;
+      block.txs_number = block.transactions.size();
+      {
+        auto ms = storage->createMutableStorage();
+        ms->apply(block, [](const auto &, auto &, auto &, const auto &) {
+          return true;
+        });
+        ASSERT_TRUE(storage->commit(std::move(ms)));
+      }
+      storage.reset();
+
+      {
+        pqxx::connection connection(pgopt_);
+        pqxx::work work(connection);
+        work.exec("DROP TABLE account_has_tx;");
+        work.commit();
+      }
+
+      storage =
+          StorageImpl::create(block_store_path, redishost_, redisport_, pgopt_);
+      ASSERT_TRUE(storage);
+      auto page =
+          storage->getAccountTransactions("admin1", nonstd::nullopt, 10);
+      ASSERT_TRUE(page);
+      ASSERT_EQ(page->transactions.size(), 1);
+      EXPECT_EQ(page->transactions.at(0).creator_account_id, "admin1");
+    }
+
+    /**
+     * @given accounts of one domain and an asset in postgres
+     * @when balances are added and transferred
+     * @then balance changes only if source balance exists, it is enough
+     * and no balance overflows, self transfer keeps the balance
+     */
+    TEST_F(AmetsuchiTest, AssetBalancesCheckedInStorage) {
+      auto storage =
+          StorageImpl::create(block_store_path, redishost_, redisport_, pgopt_);
+      ASSERT_TRUE(storage);
+
+      pqxx::lazyconnection connection(pgopt_);
+      pqxx::nontransaction transaction(connection);
+      PostgresWsvCommand command(transaction);
+      PostgresWsvQuery query(transaction);
+
+      model::Domain domain;
+      domain.domain_id = "test";
+      ASSERT_TRUE(command.insertDomain(domain));
+      ed25519::pubkey_t key;
+      key.fill(1);
+      ASSERT_TRUE(command.insertSignatory(key));
+      for (auto id : {"a@test", "b@test", "c@test"}) {
+        model::Account account;
+        account.account_id = id;
+        account.domain_name = "test";
+        account.master_key = key;
+        account.quorum = 1;
+        ASSERT_TRUE(command.insertAccount(account));
+      }
+      model::Asset asset;
+      asset.asset_id = "coin#test";
+      asset.domain_id = "test";
+      asset.precision = 2;
+      ASSERT_TRUE(command.insertAsset(asset));
+
+      auto balance = [&query](const std::string &account_id) {
+        auto account_asset = query.getAccountAsset(account_id, "coin#test");
+        return account_asset ? account_asset->balance : 0;
+      };
+      const uint64_t max_balance = std::numeric_limits<int64_t>::max();
+
+      // no source balance
+      ASSERT_FALSE(command.transferAccountAsset("a@test", "b@test",
+                                                "coin#test", 10));
+      ASSERT_TRUE(command.addAccountAssetBalance("a@test", "coin#test", 100));
+      ASSERT_EQ(balance("a@test"), 100u);
+
+      // insufficient funds
+      ASSERT_FALSE(command.transferAccountAsset("a@test", "b@test",
+                                                "coin#test", 200));
+      ASSERT_EQ(balance("a@test"), 100u);
+      ASSERT_FALSE(query.getAccountAsset("b@test", "coin#test"));
+
+      // self transfer
+      ASSERT_TRUE(command.transferAccountAsset("a@test", "a@test",
+                                               "coin#test", 50));
+      ASSERT_EQ(balance("a@test"), 100u);
+
+      // destination overflow
+      ASSERT_TRUE(command.addAccountAssetBalance("c@test", "coin#test",
+                                                 max_balance));
+      ASSERT_FALSE(command.transferAccountAsset("a@test", "c@test",
+                                                "coin#test", 10));
+      ASSERT_EQ(balance("a@test"), 100u);
+      ASSERT_EQ(balance("c@test"), max_balance);
+
+      // add overflow matches no row
+      ASSERT_FALSE(command.addAccountAssetBalance("c@test", "coin#test", 1));
+      ASSERT_EQ(balance("c@test"), max_balance);
+
+      // transfer creates destination balance
+      ASSERT_TRUE(command.transferAccountAsset("a@test", "b@test",
+                                               "coin#test", 40));
+      ASSERT_EQ(balance("a@test"), 60u);
+      ASSERT_EQ(balance("b@test"), 40u);
     }
 
     TEST_F(AmetsuchiTest, PeerTest) {
@@ -301,5 +439,278 @@ namespace iroha {
       ASSERT_EQ(peers->at(0).address, addPeer.address);
     }
 
+    /**
+     * @given read-only wsv created before a block is committed
+     * @when block adding a peer is committed
+     * @then the wsv sees the peer without being recreated
+     */
+    TEST_F(AmetsuchiTest, WsvQuerySeesCommittedBlocks) {
+      auto storage =
+          StorageImpl::create(block_store_path, redishost_, redisport_, pgopt_);
+      ASSERT_TRUE(storage);
+      auto wsv = storage->createWsvQuery();
+      ASSERT_TRUE(wsv);
+      auto peers = wsv->getPeers();
+      ASSERT_TRUE(peers);
+      ASSERT_TRUE(peers->empty());
+
+      model::Transaction txn;
+      model::AddPeer addPeer;
+      addPeer.peer_key.at(0) = 1;
+      addPeer.address = "192.168.0.1:50051";
+      txn.commands.push_back(std::make_shared<model::AddPeer>(addPeer));
+      model::Block block;
+      block.transactions.push_back(txn);
+
+      auto ms = storage->createMutableStorage();
+      ms->apply(block, [](const auto &blk, auto &executor, auto &query,
+                          const auto &top_hash) {
+        return blk.transactions.at(0).commands.at(0)->execute(query, executor);
+      });
+      storage->commit(std::move(ms));
+
+      peers = wsv->getPeers();
+      ASSERT_TRUE(peers);
+      ASSERT_EQ(peers->size(), 1);
+      ASSERT_EQ(peers->at(0).address, addPeer.address);
+    }
+
+    /**
+     * @given read-only wsv reading a snapshot
+     * @when block adding a peer is committed during the snapshot
+     * @then the peer is seen only after the snapshot is over
+     */
+    TEST_F(AmetsuchiTest, WsvSnapshotDoesNotSeeCommittedBlocks) {
+      auto storage =
+          StorageImpl::create(block_store_path, redishost_, redisport_, pgopt_);
+      ASSERT_TRUE(storage);
+      auto wsv = storage->createWsvQuery();
+      ASSERT_TRUE(wsv);
+
+      model::Transaction txn;
+      model::AddPeer addPeer;
+      addPeer.peer_key.at(0) = 1;
+      addPeer.address = "192.168.0.1:50051";
+      txn.commands.push_back(std::make_shared<model::AddPeer>(addPeer));
+      model::Block block;
+      block.transactions.push_back(txn);
+
+      ASSERT_TRUE(wsv->snapshot([&] {
+        auto peers = wsv->getPeers();
+        ASSERT_TRUE(peers);
+        ASSERT_TRUE(peers->empty());
+
+        auto ms = storage->createMutableStorage();
+        ms->apply(block, [](const auto &blk, auto &executor, auto &query,
+                            const auto &top_hash) {
+          return blk.transactions.at(0).commands.at(0)->execute(query,
+                                                                executor);
+        });
+        storage->commit(std::move(ms));
+
+        peers = wsv->getPeers();
+        ASSERT_TRUE(peers);
+        ASSERT_TRUE(peers->empty());
+      }));
+
+      auto peers = wsv->getPeers();
+      ASSERT_TRUE(peers);
+      ASSERT_EQ(peers->size(), 1);
+    }
+
+    /**
+     * @given temporary wsv with prefetched absent account
+     * @when transaction creating the account is rolled back and then applied
+     * @then account is absent after rollback and present after apply
+     */
+    TEST_F(AmetsuchiTest, PrefetchedTemporaryWsvFollowsAppliedTransactions) {
+      auto storage =
+          StorageImpl::create(block_store_path, redishost_, redisport_, pgopt_);
+      ASSERT_TRUE(storage);
+
+      model::Transaction txn;
+      txn.creator_account_id = "admin1";
+      model::CreateDomain createDomain;
+      createDomain.domain_name = "ru";
+      txn.commands.push_back(
+          std::make_shared<model::CreateDomain>(createDomain));
+      model::CreateAccount createAccount;
+      createAccount.account_name = "user1";
+      createAccount.domain_id = "ru";
+      txn.commands.push_back(
+          std::make_shared<model::CreateAccount>(createAccount));
+      auto account_id = "user1@ru";
+
+      auto wsv = storage->createTemporaryWsv();
+      ASSERT_TRUE(wsv);
+      PrefetchKeys keys;
+      keys.account_ids.insert(account_id);
+      wsv->prefetch(keys);
+      ASSERT_FALSE(wsv->getAccount(account_id));
+
+      auto execute = [](auto &tx, auto &executor, auto &query) {
+        return tx.commands.at(0)->execute(query, executor)
+            and tx.commands.at(1)->execute(query, executor);
+      };
+      wsv->apply(txn, [&execute](auto &tx, auto &executor, auto &query) {
+        EXPECT_TRUE(execute(tx, executor, query));
+        return false;
+      });
+      ASSERT_FALSE(wsv->getAccount(account_id));
+
+      wsv->apply(txn, execute);
+      auto account = wsv->getAccount(account_id);
+      ASSERT_TRUE(account);
+      ASSERT_EQ(account->account_id, account_id);
+    }
+
+    TEST_F(AmetsuchiTest, BulkApplyWhenCommandsSucceed) {
+      auto storage =
+          StorageImpl::create(block_store_path, redishost_, redisport_, pgopt_);
+      ASSERT_TRUE(storage);
+
+      model::Transaction txn;
+      model::CreateDomain createDomain;
+      createDomain.domain_name = "ru";
+      txn.commands.push_back(
+          std::make_shared<model::CreateDomain>(createDomain));
+      model::CreateAccount createAccount;
+      createAccount.account_name = "user1";
+      createAccount.domain_id = "ru";
+      txn.commands.push_back(
+          std::make_shared<model::CreateAccount>(createAccount));
+      model::CreateAsset createAsset;
+      createAsset.domain_id = "ru";
+      createAsset.asset_name = "RUB";
+      createAsset.precision = 2;
+      txn.commands.push_back(std::make_shared<model::CreateAsset>(createAsset));
+      model::AddAssetQuantity addAssetQuantity;
+      addAssetQuantity.asset_id = "RUB#ru";
+      addAssetQuantity.account_id = "user1@ru";
+      addAssetQuantity.amount = iroha::Amount(1, 50);
+      txn.commands.push_back(
+          std::make_shared<model::AddAssetQuantity>(addAssetQuantity));
+
+      model::Block block;
+      block.transactions.push_back(txn);
+      block.height = 1;
+      block.prev_hash.fill(0);
+      block.hash = model::HashProviderImpl().get_hash(block);
+      block.txs_number = block.transactions.size();
+
+      auto ms = storage->createMutableStorage();
+      ASSERT_TRUE(ms->applyBulk(
+          {block}, [](const auto &blk, auto &executor, auto &query) {
+            for (const auto &command : blk.transactions.at(0).commands) {
+              if (not command->execute(query, executor)) {
+                return false;
+              }
+            }
+            return true;
+          }));
+      storage->commit(std::move(ms));
+
+      auto account = storage->getAccount("user1@ru");
+      ASSERT_TRUE(account);
+      ASSERT_EQ(account->master_key, createAccount.pubkey);
+      auto signatories = storage->getSignatories("user1@ru");
+      ASSERT_TRUE(signatories);
+      ASSERT_EQ(signatories->size(), 1);
+      auto asset = storage->getAccountAsset("user1@ru", "RUB#ru");
+      ASSERT_TRUE(asset);
+      ASSERT_EQ(asset->balance, 150);
+    }
+
+    /**
+     * @given asset held by three accounts, two of them with equal balance
+     * @when holders are read page by page in both orderings
+     * @then pages follow the ordering, and the balance ordered cursor does
+     * not depend on the current balance of its account
+     */
+    TEST_F(AmetsuchiTest, GetAssetHoldersPagesInBothOrderings) {
+      auto storage =
+          StorageImpl::create(block_store_path, redishost_, redisport_, pgopt_);
+      ASSERT_TRUE(storage);
+
+      model::Transaction txn;
+      model::CreateDomain createDomain;
+      createDomain.domain_name = "ru";
+      txn.commands.push_back(
+          std::make_shared<model::CreateDomain>(createDomain));
+      model::CreateAsset createAsset;
+      createAsset.domain_id = "ru";
+      createAsset.asset_name = "RUB";
+      createAsset.precision = 2;
+      txn.commands.push_back(std::make_shared<model::CreateAsset>(createAsset));
+      for (auto holder : {std::make_pair("a", 1), std::make_pair("b", 3),
+                          std::make_pair("c", 1)}) {
+        model::CreateAccount createAccount;
+        createAccount.account_name = holder.first;
+        createAccount.domain_id = "ru";
+        txn.commands.push_back(
+            std::make_shared<model::CreateAccount>(createAccount));
+        model::AddAssetQuantity addAssetQuantity;
+        addAssetQuantity.asset_id = "RUB#ru";
+        addAssetQuantity.account_id = std::string(holder.first) + "@ru";
+        addAssetQuantity.amount = iroha::Amount(holder.second, 0);
+        txn.commands.push_back(
+            std::make_shared<model::AddAssetQuantity>(addAssetQuantity));
+      }
+
+      model::Block block;
+      block.transactions.push_back(txn);
+      block.height = 1;
+      block.prev_hash.fill(0);
+      block.hash = model::HashProviderImpl().get_hash(block);
+      block.txs_number = block.transactions.size();
+
+      auto ms = storage->createMutableStorage();
+      ASSERT_TRUE(ms->applyBulk(
+          {block}, [](const auto &blk, auto &executor, auto &query) {
+            for (const auto &command : blk.transactions.at(0).commands) {
+              if (not command->execute(query, executor)) {
+                return false;
+              }
+            }
+            return true;
+          }));
+      storage->commit(std::move(ms));
+
+      auto ids = [](const auto &holders) {
+        std::vector<std::string> result;
+        for (const auto &holder : holders.value()) {
+          result.push_back(holder.account_id);
+        }
+        return result;
+      };
+      using ids_t = std::vector<std::string>;
+
+      // ordered by account
+      auto page = storage->getAssetHolders("RUB#ru", "", 0, 2, false);
+      ASSERT_TRUE(page);
+      ASSERT_EQ(ids(page), (ids_t{"a@ru", "b@ru"}));
+      page = storage->getAssetHolders("RUB#ru", "b@ru", 0, 2, false);
+      ASSERT_TRUE(page);
+      ASSERT_EQ(ids(page), (ids_t{"c@ru"}));
+
+      // ordered by balance descending, equal balances by account descending
+      page = storage->getAssetHolders("RUB#ru", "", 0, 2, true);
+      ASSERT_TRUE(page);
+      ASSERT_EQ(ids(page), (ids_t{"b@ru", "c@ru"}));
+      ASSERT_EQ(page->at(1).balance, 100);
+      page = storage->getAssetHolders("RUB#ru", "c@ru", 100, 2, true);
+      ASSERT_TRUE(page);
+      ASSERT_EQ(ids(page), (ids_t{"a@ru"}));
+
+      // cursor of a balance which has changed since the previous page
+      page = storage->getAssetHolders("RUB#ru", "c@ru", 200, 2, true);
+      ASSERT_TRUE(page);
+      ASSERT_EQ(ids(page), (ids_t{"c@ru", "a@ru"}));
+      // cursor of an account which does not hold the asset anymore
+      page = storage->getAssetHolders("RUB#ru", "gone@ru", 300, 3, true);
+      ASSERT_TRUE(page);
+      ASSERT_EQ(ids(page), (ids_t{"b@ru", "c@ru", "a@ru"}));
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
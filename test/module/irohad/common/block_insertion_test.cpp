@@ -165,7 +165,7 @@ TEST(BlockInsertionTest, BlockInsertionWhenApplyToStorage) {
       &createMutableStorageMock);
 
   EXPECT_CALL(*factory, createMutableStorage()).Times(1);
-  EXPECT_CALL(*factory, commit_(_)).Times(1);
+  EXPECT_CALL(*factory, commit_(_)).WillOnce(::testing::Return(true));
   EXPECT_CALL(*storage_mock, apply(_, _)).Times(1);
 
   BlockInserter inserter(factory);
@@ -174,3 +174,23 @@ TEST(BlockInsertionTest, BlockInsertionWhenApplyToStorage) {
 
   inserter.applyToLedger(blocks);
 }
+
+TEST(BlockInsertionTest, BlockInsertionWhenBulkApplyToStorage) {
+  cout << "----------| block => bulkApplyToLedger() |----------" << endl;
+
+  shared_ptr<MockMutableFactory> factory = make_shared<MockMutableFactory>();
+  storage_mock = new MockMutableStorage();
+  DefaultValue<std::unique_ptr<MutableStorage>>::SetFactory(
+      &createMutableStorageMock);
+
+  EXPECT_CALL(*factory, createMutableStorage()).Times(1);
+  EXPECT_CALL(*factory, commit_(_)).WillOnce(::testing::Return(true));
+  EXPECT_CALL(*storage_mock, applyBulk(_, _))
+      .WillOnce(::testing::Return(true));
+  EXPECT_CALL(*storage_mock, apply(_, _)).Times(0);
+
+  BlockInserter inserter(factory);
+  vector<Block> blocks{generateBlock()};
+
+  ASSERT_TRUE(inserter.bulkApplyToLedger(blocks));
+}
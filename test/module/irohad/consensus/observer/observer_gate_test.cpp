@@ -0,0 +1,173 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <grpc++/grpc++.h>
+#include <endpoint.grpc.pb.h>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+
+#include "consensus/observer/observer_gate.hpp"
+
+using namespace iroha;
+using namespace iroha::ametsuchi;
+using namespace iroha::consensus;
+
+using ::testing::Invoke;
+
+constexpr uint32_t TopHeight = 3;
+constexpr auto Wait = std::chrono::seconds(5);
+
+/**
+ * Validator streaming its ledger of TopHeight blocks
+ */
+class FakeValidator : public protocol::QueryService::Service {
+ public:
+  grpc::Status SubscribeBlocks(
+      grpc::ServerContext *context,
+      const protocol::BlocksSubscription *request,
+      grpc::ServerWriter<protocol::BlockEvent> *writer) override {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      from_heights.push_back(request->from_height());
+    }
+    for (auto height = request->from_height(); height <= TopHeight;
+         ++height) {
+      model::Block block;
+      block.height = height;
+      protocol::BlockEvent event;
+      *event.mutable_block() = factory.serialize(block);
+      writer->Write(event);
+    }
+    return grpc::Status::OK;
+  }
+
+  model::converters::PbBlockFactory factory;
+  std::mutex mutex;
+  // heights requested by subscriptions
+  std::vector<uint64_t> from_heights;
+};
+
+class ObserverGateTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    grpc::ServerBuilder builder;
+    int port = 0;
+    builder.AddListeningPort(
+        "0.0.0.0:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&validator);
+    server = builder.BuildAndStart();
+    ASSERT_TRUE(server);
+    ASSERT_NE(port, 0);
+    address = "127.0.0.1:" + std::to_string(port);
+
+    block_query = std::make_shared<MockBlockQuery>();
+    EXPECT_CALL(*block_query, getTopHeight())
+        .WillRepeatedly(Invoke([this] { return top.load(); }));
+  }
+
+  void TearDown() override {
+    gate.reset();
+    server->Shutdown();
+  }
+
+  /**
+   * Starts gate and waits for blocks up to TopHeight
+   * @return heights of received blocks
+   */
+  std::vector<uint64_t> receiveBlocks() {
+    std::vector<uint64_t> heights;
+    std::promise<void> received;
+    gate->on_commit()
+        .take(TopHeight - 1)
+        .subscribe([this, &heights](const model::Block &block) {
+                     heights.push_back(block.height);
+                     // block is applied by synchronizer
+                     top = block.height;
+                   },
+                   [&received] { received.set_value(); });
+    gate->start();
+    EXPECT_EQ(std::future_status::ready, received.get_future().wait_for(Wait));
+    return heights;
+  }
+
+  FakeValidator validator;
+  std::unique_ptr<grpc::Server> server;
+  std::string address;
+  std::shared_ptr<MockBlockQuery> block_query;
+  // top of the observer ledger
+  std::atomic<uint32_t> top{1};
+  std::unique_ptr<ObserverGate> gate;
+};
+
+/**
+ * @given observer with the top block at height 1
+ * @when observer follows validator
+ * @then blocks after its top are emitted in order
+ */
+TEST_F(ObserverGateTest, EmitsBlocksAfterTopOfLedger) {
+  gate = std::make_unique<ObserverGate>(std::vector<std::string>{address},
+                                        block_query,
+                                        std::chrono::seconds(10));
+  ASSERT_EQ(std::vector<uint64_t>({2, 3}), receiveBlocks());
+}
+
+/**
+ * @given observer of an unavailable validator and an available one
+ * @when stream of the first validator fails
+ * @then observer follows the next validator
+ */
+TEST_F(ObserverGateTest, FollowsNextValidatorOnFailure) {
+  gate = std::make_unique<ObserverGate>(
+      std::vector<std::string>{"127.0.0.1:1", address},
+      block_query,
+      std::chrono::milliseconds(10));
+  ASSERT_EQ(std::vector<uint64_t>({2, 3}), receiveBlocks());
+}
+
+/**
+ * @given observer following the same validator twice
+ * @when the first emitted block is not applied to the ledger
+ * @then the stream is cancelled and observer follows the next validator
+ * from the top of its ledger
+ */
+TEST_F(ObserverGateTest, FollowsNextValidatorWhenBlockIsNotApplied) {
+  gate = std::make_unique<ObserverGate>(
+      std::vector<std::string>{address, address},
+      block_query,
+      std::chrono::milliseconds(10));
+  std::vector<uint64_t> heights;
+  std::promise<void> received;
+  gate->on_commit().take(TopHeight).subscribe(
+      [this, &heights](const model::Block &block) {
+        // the first block is rejected by synchronizer
+        if (not heights.empty()) {
+          top = block.height;
+        }
+        heights.push_back(block.height);
+      },
+      [&received] { received.set_value(); });
+  gate->start();
+  ASSERT_EQ(std::future_status::ready, received.get_future().wait_for(Wait));
+  ASSERT_EQ(std::vector<uint64_t>({2, 2, 3}), heights);
+
+  std::lock_guard<std::mutex> lock(validator.mutex);
+  ASSERT_LE(2u, validator.from_heights.size());
+  ASSERT_EQ(2u, validator.from_heights.at(0));
+  ASSERT_EQ(2u, validator.from_heights.at(1));
+}
@@ -56,6 +56,7 @@ class GenesisBlockProcessorTest : public ::testing::Test {
     const auto drop =
         "DROP TABLE IF EXISTS account_has_asset;\n"
         "DROP TABLE IF EXISTS account_has_signatory;\n"
+        "DROP TABLE IF EXISTS account_has_tx;\n"
         "DROP TABLE IF EXISTS peer;\n"
         "DROP TABLE IF EXISTS account;\n"
         "DROP TABLE IF EXISTS exchange;\n"
@@ -104,35 +104,27 @@ class AddAssetQuantityTest : public CommandValidateExecuteTest {
   std::shared_ptr<AddAssetQuantity> add_asset_quantity;
 };
 
-TEST_F(AddAssetQuantityTest, ValidWhenNewWallet) {
-  // Add asset first time - no wallet
-  // When there is no wallet - new accountAsset will be created
+TEST_F(AddAssetQuantityTest, ValidWhenAmountAdded) {
+  // Wallet is created or updated by storage in one statement
   creator.permissions.issue_assets = true;
-  EXPECT_CALL(*wsv_query, getAccountAsset(add_asset_quantity->account_id, _))
-      .WillOnce(Return(nonstd::nullopt));
 
   EXPECT_CALL(*wsv_query, getAsset(asset_id)).WillOnce(Return(asset));
-  EXPECT_CALL(*wsv_query, getAccount(account_id)).WillOnce(Return(account));
-  EXPECT_CALL(*wsv_command, upsertAccountAsset(_))
+  EXPECT_CALL(*wsv_command,
+              addAccountAssetBalance(account_id, asset_id, 350ul))
       .WillOnce(Return(true));
 
   ASSERT_TRUE(validateAndExecute());
 }
 
-TEST_F(AddAssetQuantityTest, ValidWhenExistingWallet) {
-  // There is already asset- there is a wallet
-  // When there is a wallet - no new accountAsset created
+TEST_F(AddAssetQuantityTest, InvalidWhenBalanceOverflows) {
+  // Storage rejects the amount because the balance overflows
   creator.permissions.issue_assets = true;
-  EXPECT_CALL(*wsv_query, getAccountAsset(add_asset_quantity->account_id,
-                                          add_asset_quantity->asset_id))
-      .WillOnce(Return(wallet));
 
   EXPECT_CALL(*wsv_query, getAsset(asset_id)).WillOnce(Return(asset));
-  EXPECT_CALL(*wsv_query, getAccount(account_id)).WillOnce(Return(account));
-  EXPECT_CALL(*wsv_command, upsertAccountAsset(_))
-      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv_command, addAccountAssetBalance(account_id, asset_id, _))
+      .WillOnce(Return(false));
 
-  ASSERT_TRUE(validateAndExecute());
+  ASSERT_FALSE(validateAndExecute());
 }
 
 TEST_F(AddAssetQuantityTest, InvalidWhenNoPermission) {
@@ -166,8 +158,10 @@ TEST_F(AddAssetQuantityTest, InvalidWhenNoAccount) {
   add_asset_quantity->account_id = "noacc";
 
   EXPECT_CALL(*wsv_query, getAsset(asset_id)).WillOnce(Return(asset));
-  EXPECT_CALL(*wsv_query, getAccount(add_asset_quantity->account_id))
-      .WillOnce(Return(nonstd::nullopt));
+  // Storage rejects wallet of non-existing account
+  EXPECT_CALL(*wsv_command,
+              addAccountAssetBalance(add_asset_quantity->account_id, _, _))
+      .WillOnce(Return(false));
 
   ASSERT_FALSE(validateAndExecute());
 }
@@ -628,47 +622,44 @@ class TransferAssetTest : public CommandValidateExecuteTest {
   std::shared_ptr<TransferAsset> transfer_asset;
 };
 
-TEST_F(TransferAssetTest, ValidWhenNewWallet) {
-  // When there is no wallet - new accountAsset will be created
+TEST_F(TransferAssetTest, ValidWhenTransferred) {
+  // Both wallets are updated by storage in one statement
   creator.permissions.can_transfer = true;
-  EXPECT_CALL(*wsv_query, getAccountAsset(transfer_asset->dest_account_id, _))
-      .WillOnce(Return(nonstd::nullopt));
 
   EXPECT_CALL(*wsv_query, getAccountAsset(transfer_asset->src_account_id,
                                           transfer_asset->asset_id))
-      .Times(2).WillRepeatedly(Return(src_wallet));
+      .WillOnce(Return(src_wallet));
   EXPECT_CALL(*wsv_query, getAsset(transfer_asset->asset_id))
       .Times(2).WillRepeatedly(Return(asset));
   EXPECT_CALL(*wsv_query, getAccount(transfer_asset->dest_account_id))
       .WillOnce(Return(account));
 
-  EXPECT_CALL(*wsv_command, upsertAccountAsset(_))
-      .Times(2)
-      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*wsv_command,
+              transferAccountAsset(transfer_asset->src_account_id,
+                                   transfer_asset->dest_account_id,
+                                   transfer_asset->asset_id,
+                                   150ul))
+      .WillOnce(Return(true));
 
   ASSERT_TRUE(validateAndExecute());
 }
 
-TEST_F(TransferAssetTest, ValidWhenExistingWallet) {
-  // When there is a wallet - no new accountAsset created
+TEST_F(TransferAssetTest, InvalidWhenStorageRejectsTransfer) {
+  // Balance changed after validation, storage rejects the transfer
   creator.permissions.can_transfer = true;
-  EXPECT_CALL(*wsv_query, getAccountAsset(transfer_asset->dest_account_id,
-                                          transfer_asset->asset_id))
-      .WillOnce(Return(dst_wallet));
 
   EXPECT_CALL(*wsv_query, getAccountAsset(transfer_asset->src_account_id,
                                           transfer_asset->asset_id))
-      .Times(2).WillRepeatedly(Return(src_wallet));
+      .WillOnce(Return(src_wallet));
   EXPECT_CALL(*wsv_query, getAsset(transfer_asset->asset_id))
       .Times(2).WillRepeatedly(Return(asset));
   EXPECT_CALL(*wsv_query, getAccount(transfer_asset->dest_account_id))
       .WillOnce(Return(account));
 
-  EXPECT_CALL(*wsv_command, upsertAccountAsset(_))
-      .Times(2)
-      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*wsv_command, transferAccountAsset(_, _, _, _))
+      .WillOnce(Return(false));
 
-  ASSERT_TRUE(validateAndExecute());
+  ASSERT_FALSE(validateAndExecute());
 }
 
 TEST_F(TransferAssetTest, InvalidWhenNoPermissions) {
@@ -101,6 +101,35 @@ TEST(QueryResponseTest, AccountAsset) {
             des_account_asset.account_id);
 }
 
+TEST(QueryResponseTest, AccountAssets) {
+  model::converters::PbQueryResponseFactory pb_factory;
+
+  model::AccountAssetsResponse account_assets_response;
+  for (auto asset_id : {"coin", "dollar"}) {
+    model::AccountAsset account_asset;
+    account_asset.account_id = "123";
+    account_asset.asset_id = asset_id;
+    account_asset.balance = 1;
+    account_assets_response.acct_assets.push_back(account_asset);
+  }
+
+  auto shrd_aar = std::make_shared<decltype(account_assets_response)>(
+      account_assets_response);
+  auto query_response = *pb_factory.serialize(shrd_aar);
+
+  auto des_account_assets_response =
+      pb_factory.deserializeAccountAssetsResponse(
+          query_response.account_assets_response());
+
+  ASSERT_EQ(des_account_assets_response.acct_assets.size(), 2);
+  for (size_t i = 0; i < 2; i++) {
+    ASSERT_EQ(des_account_assets_response.acct_assets.at(i).asset_id,
+              account_assets_response.acct_assets.at(i).asset_id);
+    ASSERT_EQ(des_account_assets_response.acct_assets.at(i).balance,
+              account_assets_response.acct_assets.at(i).balance);
+  }
+}
+
 TEST(QueryResponseTest, SignatoriesTest) {
   model::converters::PbQueryResponseFactory pb_factory;
 
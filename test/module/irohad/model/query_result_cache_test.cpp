@@ -0,0 +1,122 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "model/commands/add_asset_quantity.hpp"
+#include "model/commands/transfer_asset.hpp"
+#include "model/queries/responses/account_response.hpp"
+#include "model/query_result_cache.hpp"
+
+using namespace iroha::model;
+
+/**
+ * Command the cache knows nothing about
+ */
+struct UnknownCommand : public Command {
+  bool validate(iroha::ametsuchi::WsvQuery &, const Account &) override {
+    return true;
+  }
+  bool execute(iroha::ametsuchi::WsvQuery &,
+               iroha::ametsuchi::WsvCommand &) override {
+    return true;
+  }
+  bool operator==(const Command &rhs) const override {
+    return iroha::instanceof<UnknownCommand>(rhs);
+  }
+  bool operator!=(const Command &rhs) const override {
+    return not(*this == rhs);
+  }
+};
+
+class QueryResultCacheTest : public ::testing::Test {
+ public:
+  /**
+   * @return block at given height with one transaction of given command
+   */
+  Block makeBlock(uint64_t height, std::shared_ptr<Command> command) {
+    Transaction tx;
+    tx.commands.push_back(command);
+    Block block;
+    block.height = height;
+    block.transactions.push_back(tx);
+    return block;
+  }
+
+  std::shared_ptr<AccountResponse> response =
+      std::make_shared<AccountResponse>();
+};
+
+/**
+ * Result is returned until a block touching its account is committed
+ */
+TEST_F(QueryResultCacheTest, EvictsTouchedAccounts) {
+  QueryResultCache cache(10);
+  cache.put("a@test", "GetAccount/a@test", cache.height(), response);
+  cache.put("b@test", "GetAccount/b@test", cache.height(), response);
+  ASSERT_EQ(cache.get("GetAccount/a@test"), response);
+
+  auto add = std::make_shared<AddAssetQuantity>();
+  add->account_id = "a@test";
+  cache.commit(makeBlock(1, add));
+  ASSERT_EQ(cache.get("GetAccount/a@test"), nullptr);
+  ASSERT_EQ(cache.get("GetAccount/b@test"), response);
+
+  auto transfer = std::make_shared<TransferAsset>();
+  transfer->src_account_id = "c@test";
+  transfer->dest_account_id = "b@test";
+  cache.commit(makeBlock(2, transfer));
+  ASSERT_EQ(cache.get("GetAccount/b@test"), nullptr);
+
+  ASSERT_EQ(cache.metrics().hits.load(), 2);
+  ASSERT_EQ(cache.metrics().misses.load(), 2);
+  ASSERT_EQ(cache.metrics().invalidated.load(), 2);
+}
+
+/**
+ * Result read before a commit is not cached, it may be stale
+ */
+TEST_F(QueryResultCacheTest, DropsResultReadBeforeCommit) {
+  QueryResultCache cache(10);
+  auto height = cache.height();
+  auto add = std::make_shared<AddAssetQuantity>();
+  add->account_id = "a@test";
+  cache.commit(makeBlock(1, add));
+  cache.put("a@test", "GetAccount/a@test", height, response);
+  ASSERT_EQ(cache.get("GetAccount/a@test"), nullptr);
+}
+
+/**
+ * Block with unknown command flushes the whole cache
+ */
+TEST_F(QueryResultCacheTest, FlushesOnUnknownCommand) {
+  QueryResultCache cache(10);
+  cache.put("a@test", "GetAccount/a@test", cache.height(), response);
+  cache.commit(makeBlock(1, std::make_shared<UnknownCommand>()));
+  ASSERT_EQ(cache.get("GetAccount/a@test"), nullptr);
+}
+
+/**
+ * Number of results never exceeds capacity
+ */
+TEST_F(QueryResultCacheTest, BoundedByCapacity) {
+  QueryResultCache cache(1);
+  cache.put("a@test", "GetAccount/a@test", cache.height(), response);
+  cache.put("b@test", "GetAccount/b@test", cache.height(), response);
+  ASSERT_EQ(cache.get("GetAccount/a@test"), nullptr);
+  ASSERT_EQ(cache.get("GetAccount/b@test"), response);
+  ASSERT_EQ(cache.metrics().evicted.load(), 1);
+}
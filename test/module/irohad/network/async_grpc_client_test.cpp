@@ -0,0 +1,72 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "network/impl/async_grpc_client.hpp"
+#include "ordering.grpc.pb.h"
+
+using namespace iroha::network;
+
+/**
+ * Client which sends proposals to address without server
+ */
+class UnreachableClient
+    : public AsyncGrpcClient<google::protobuf::Empty> {
+ public:
+  explicit UnreachableClient(std::shared_ptr<AsyncClientRuntime> runtime)
+      : AsyncGrpcClient(std::move(runtime)),
+        stub_(iroha::ordering::proto::OrderingGate::NewStub(grpc::CreateChannel(
+            "127.0.0.1:1", grpc::InsecureChannelCredentials()))) {}
+
+  void send(std::atomic<int> &failed) {
+    auto call = makeCall();
+    call->context.set_deadline(std::chrono::system_clock::now()
+                               + std::chrono::milliseconds(100));
+    call->on_response = [&failed](const auto &status, const auto &, auto) {
+      if (not status.ok()) {
+        ++failed;
+      }
+    };
+    call->response_reader = stub_->AsyncSendProposal(
+        &call->context, iroha::ordering::proto::Proposal(), queue());
+    call->response_reader->Finish(&call->reply, &call->status, call->tag());
+  }
+
+ private:
+  std::unique_ptr<iroha::ordering::proto::OrderingGate::Stub> stub_;
+};
+
+TEST(AsyncGrpcClientTest, StatusReportedWhenCallFailed) {
+  // Init => 5 calls to unreachable address on 2 shared queues => every
+  // call reports failure and is counted
+  auto runtime = std::make_shared<AsyncClientRuntime>(2);
+  std::atomic<int> failed(0);
+  {
+    UnreachableClient client(runtime);
+    for (size_t i = 0; i < 5; ++i) {
+      client.send(failed);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    ASSERT_EQ(client.callMetrics().started.load(), 5);
+    ASSERT_EQ(client.callMetrics().failed.load(), 5);
+    // client keeps sending after failed calls
+    client.send(failed);
+  }
+  // client waits for call in flight on destruction
+  ASSERT_EQ(failed.load(), 6);
+}
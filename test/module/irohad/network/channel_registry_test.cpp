@@ -0,0 +1,60 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "network/impl/channel_registry.hpp"
+
+using namespace iroha::network;
+
+TEST(ChannelRegistryTest, SameChannelWhenSameAddress) {
+  ChannelRegistry registry;
+  auto channel = registry.getChannel("0.0.0.0:50051");
+  ASSERT_EQ(channel, registry.getChannel("0.0.0.0:50051"));
+  ASSERT_NE(channel, registry.getChannel("0.0.0.0:50052"));
+}
+
+TEST(ChannelRegistryTest, NewChannelWhenEvicted) {
+  ChannelRegistry registry;
+  registry.retain("owner", {"0.0.0.0:50051", "0.0.0.0:50052"});
+  auto first = registry.getChannel("0.0.0.0:50051");
+  auto second = registry.getChannel("0.0.0.0:50052");
+
+  registry.retain("owner", {"0.0.0.0:50052"});
+
+  ASSERT_NE(first, registry.getChannel("0.0.0.0:50051"));
+  ASSERT_EQ(second, registry.getChannel("0.0.0.0:50052"));
+}
+
+/**
+ * @given channels used by two owners and a channel never retained
+ * @when one owner stops retaining all of its addresses
+ * @then only channels no other owner retains are evicted
+ */
+TEST(ChannelRegistryTest, ChannelKeptWhenRetainedByOtherOwner) {
+  ChannelRegistry registry;
+  registry.retain("first", {"0.0.0.0:50051", "0.0.0.0:50052"});
+  registry.retain("second", {"0.0.0.0:50052"});
+  auto only_first = registry.getChannel("0.0.0.0:50051");
+  auto shared = registry.getChannel("0.0.0.0:50052");
+  auto not_retained = registry.getChannel("0.0.0.0:50053");
+
+  registry.retain("first", {});
+
+  ASSERT_NE(only_first, registry.getChannel("0.0.0.0:50051"));
+  ASSERT_EQ(shared, registry.getChannel("0.0.0.0:50052"));
+  ASSERT_EQ(not_retained, registry.getChannel("0.0.0.0:50053"));
+}
@@ -33,6 +33,10 @@ namespace iroha {
 
       MOCK_METHOD0(on_proposal, rxcpp::observable<model::Proposal>());
 
+      MOCK_METHOD0(is_overloaded, bool());
+
+      MOCK_METHOD0(on_rejected, rxcpp::observable<model::Transaction>());
+
       MOCK_METHOD0(on_commit, rxcpp::observable<Commit>());
     };
 
@@ -49,6 +53,10 @@ namespace iroha {
                    void(std::shared_ptr<const model::Transaction> transaction));
 
       MOCK_METHOD0(on_proposal, rxcpp::observable<model::Proposal>());
+
+      MOCK_METHOD0(is_overloaded, bool());
+
+      MOCK_METHOD0(on_rejected, rxcpp::observable<model::Transaction>());
     };
 
     class MockConsensusGate : public ConsensusGate {
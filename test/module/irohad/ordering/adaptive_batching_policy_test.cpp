@@ -0,0 +1,66 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "ordering/impl/adaptive_batching_policy.hpp"
+
+using namespace iroha::ordering;
+
+class AdaptiveBatchingPolicyTest : public ::testing::Test {
+ public:
+  BatchingBounds bounds{100, 1024, std::chrono::milliseconds(1000)};
+};
+
+TEST_F(AdaptiveBatchingPolicyTest, ProposalWithoutWaitWhenIdle) {
+  AdaptiveBatchingPolicy policy(bounds);
+
+  auto decision = policy.decide(1);
+
+  ASSERT_EQ(1, decision.target_txs);
+  ASSERT_EQ(bounds.max_txs, decision.max_txs);
+  ASSERT_EQ(bounds.max_bytes, decision.max_bytes);
+  ASSERT_EQ(1, policy.metrics().target_txs);
+}
+
+TEST_F(AdaptiveBatchingPolicyTest, LargerProposalsWhenLoaded) {
+  AdaptiveBatchingPolicy policy(bounds);
+
+  // 1000 transactions in 100 ms are 10 transactions per millisecond
+  for (size_t i = 0; i < 1000; ++i) {
+    policy.onTransaction(100);
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  auto decision = policy.decide(0);
+
+  ASSERT_LT(1, decision.target_txs);
+  ASSERT_GE(bounds.max_txs, decision.target_txs);
+  ASSERT_GE(bounds.max_wait, decision.wait);
+  ASSERT_LT(0, policy.metrics().arrival_rate);
+}
+
+TEST_F(AdaptiveBatchingPolicyTest, CommitLatencyMeasuredWhenCommitted) {
+  AdaptiveBatchingPolicy policy(bounds);
+
+  policy.onProposal(2, 10, 100);
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  policy.onCommit(2);
+
+  ASSERT_LE(10, policy.metrics().commit_latency_milliseconds);
+  ASSERT_EQ(1, policy.metrics().proposals);
+  ASSERT_EQ(10, policy.metrics().last_proposal_txs);
+}
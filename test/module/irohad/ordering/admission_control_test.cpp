@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "ordering/impl/admission_control.hpp"
+
+using namespace iroha::ordering;
+
+TEST(AdmissionControlTest, RejectedWhenQueueFull) {
+  AdmissionControl admission(AdmissionLimits{2, 1000});
+
+  ASSERT_TRUE(admission.admit("a", 10));
+  ASSERT_TRUE(admission.admit("b", 10));
+  ASSERT_FALSE(admission.admit("c", 10));
+
+  admission.release("a", 10);
+  ASSERT_TRUE(admission.admit("c", 10));
+
+  ASSERT_EQ(admission.metrics().admitted.load(), 3);
+  ASSERT_EQ(admission.metrics().rejected.load(), 1);
+  ASSERT_EQ(admission.metrics().queued_txs.load(), 2);
+}
+
+TEST(AdmissionControlTest, RejectedWhenBytesExceeded) {
+  AdmissionControl admission(AdmissionLimits{100, 100});
+
+  ASSERT_TRUE(admission.admit("a", 40));
+  ASSERT_FALSE(admission.admit("b", 70));
+  ASSERT_TRUE(admission.admit("b", 30));
+  ASSERT_EQ(admission.metrics().queued_bytes.load(), 70);
+}
+
+TEST(AdmissionControlTest, FloodingSourceLimitedToFairShare) {
+  // Queue of 10 => flooding source takes half of the queue freely, then is
+  // limited by its share among active sources
+  AdmissionControl admission(AdmissionLimits{10, 1000});
+
+  for (size_t i = 0; i < 6; ++i) {
+    ASSERT_TRUE(admission.admit("flood", 1));
+  }
+  // share of the only source is the whole queue
+  ASSERT_TRUE(admission.admit("flood", 1));
+
+  // other source is admitted, flood is over its share of 10 / 2
+  ASSERT_TRUE(admission.admit("other", 1));
+  ASSERT_FALSE(admission.admit("flood", 1));
+  ASSERT_TRUE(admission.admit("other", 1));
+}
@@ -17,6 +17,7 @@
 
 #include "module/irohad/ordering/ordering_mocks.hpp"
 
+#include <future>
 #include "framework/test_subscriber.hpp"
 #include "ordering/impl/ordering_gate_impl.hpp"
 
@@ -26,6 +27,7 @@ using namespace iroha::network;
 using namespace framework::test_subscriber;
 
 using ::testing::_;
+using ::testing::Invoke;
 
 class OrderingGateTest : public OrderingTest {
  public:
@@ -41,19 +43,34 @@ class OrderingGateTest : public OrderingTest {
 
 TEST_F(OrderingGateTest, TransactionReceivedByServerWhenSent) {
   // Init => send 5 transactions => 5 transactions are processed by server
-  EXPECT_CALL(*fake_service, SendTransaction(_, _, _)).Times(5);
+  std::atomic<int> received(0);
+  std::promise<void> all_received;
+  EXPECT_CALL(*fake_service, SendTransactions(_, _, _))
+      .WillRepeatedly(
+          Invoke([&received, &all_received](auto, auto request, auto response) {
+            for (int i = 0; i < request->transactions_size(); ++i) {
+              response->add_acks()->set_accepted(true);
+            }
+            received += request->transactions_size();
+            if (received == 5) {
+              all_received.set_value();
+            }
+            return grpc::Status::OK;
+          }));
 
   for (size_t i = 0; i < 5; ++i) {
     gate_impl->propagate_transaction(std::make_shared<Transaction>());
   }
 
-  // Ensure that server processed the transactions
-  std::this_thread::sleep_for(std::chrono::seconds(1));
+  ASSERT_EQ(all_received.get_future().wait_for(std::chrono::seconds(1)),
+            std::future_status::ready);
+  ASSERT_EQ(received.load(), 5);
 }
 
 TEST_F(OrderingGateTest, ProposalReceivedByGateWhenSent) {
+  std::promise<void> delivered;
   auto wrapper = make_test_subscriber<CallExact>(gate_impl->on_proposal(), 1);
-  wrapper.subscribe();
+  wrapper.subscribe([&delivered](auto) { delivered.set_value(); });
 
   grpc::ServerContext context;
   iroha::ordering::proto::Proposal proposal;
@@ -62,5 +79,175 @@ TEST_F(OrderingGateTest, ProposalReceivedByGateWhenSent) {
 
   gate_impl->SendProposal(&context, &proposal, &response);
 
+  // proposal is delivered on separate thread
+  ASSERT_EQ(delivered.get_future().wait_for(std::chrono::seconds(1)),
+            std::future_status::ready);
   ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(gate_impl->deliveryMetrics().delivered.load(), 1);
+}
+
+TEST_F(OrderingGateTest, ProposalHandlerReturnsWhenSubscriberBusy) {
+  // Init => subscriber is blocked until handler returns => handler returns
+  // and proposal is delivered after subscriber is released
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::promise<void> delivered;
+  auto wrapper = make_test_subscriber<CallExact>(gate_impl->on_proposal(), 1);
+  wrapper.subscribe([released, &delivered](auto) {
+    released.wait();
+    delivered.set_value();
+  });
+
+  grpc::ServerContext context;
+  iroha::ordering::proto::Proposal proposal;
+  google::protobuf::Empty response;
+
+  ASSERT_TRUE(gate_impl->SendProposal(&context, &proposal, &response).ok());
+  release.set_value();
+
+  ASSERT_EQ(delivered.get_future().wait_for(std::chrono::seconds(1)),
+            std::future_status::ready);
+  ASSERT_TRUE(wrapper.validate());
+}
+
+TEST_F(OrderingGateTest, ProposalRejectedWhenQueueFull) {
+  // Init => subscriber is blocked on the first proposal => 32 proposals
+  // are queued => the next one is rejected
+  // queued proposals are delivered after the test body, so subscriber
+  // owns its state
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  auto entered = std::make_shared<std::promise<void>>();
+  auto first = std::make_shared<std::atomic<bool>>(true);
+  gate_impl->on_proposal().subscribe([released, entered, first](auto) {
+    if (first->exchange(false)) {
+      entered->set_value();
+    }
+    released.wait();
+  });
+
+  grpc::ServerContext context;
+  iroha::ordering::proto::Proposal proposal;
+  google::protobuf::Empty response;
+
+  ASSERT_TRUE(gate_impl->SendProposal(&context, &proposal, &response).ok());
+  ASSERT_EQ(entered->get_future().wait_for(std::chrono::seconds(1)),
+            std::future_status::ready);
+  for (size_t i = 0; i < 32; ++i) {
+    ASSERT_TRUE(gate_impl->SendProposal(&context, &proposal, &response).ok());
+  }
+  ASSERT_EQ(gate_impl->SendProposal(&context, &proposal, &response)
+                .error_code(),
+            grpc::StatusCode::RESOURCE_EXHAUSTED);
+  ASSERT_EQ(gate_impl->deliveryMetrics().dropped.load(), 1);
+  release.set_value();
+}
+
+TEST_F(OrderingGateTest, CompactProposalResolvedWhenTransactionsKnown) {
+  // Init => propagate transaction => compact proposal with its hash and hash
+  // of unknown transaction => unknown transaction is fetched from service
+  std::promise<Proposal> delivered;
+  gate_impl->on_proposal().subscribe(
+      [&delivered](auto proposal) { delivered.set_value(proposal); });
+
+  iroha::model::converters::PbTransactionFactory factory;
+  Transaction known, unknown;
+  known.tx_counter = 1;
+  unknown.tx_counter = 2;
+  auto unknown_hash = orderingHash(factory.serialize(unknown));
+
+  EXPECT_CALL(*fake_service, SendTransactions(_, _, _)).Times(1);
+  EXPECT_CALL(*fake_service, FetchTransactions(_, _, _))
+      .WillOnce(Invoke([&](auto, auto request, auto response) {
+        EXPECT_EQ(request->tx_hashes_size(), 1);
+        EXPECT_EQ(request->tx_hashes(0), unknown_hash);
+        *response->add_transactions() = factory.serialize(unknown);
+        return grpc::Status::OK;
+      }));
+
+  gate_impl->propagate_transaction(std::make_shared<Transaction>(known));
+
+  grpc::ServerContext context;
+  iroha::ordering::proto::CompactProposal proposal;
+  proposal.add_tx_hashes(orderingHash(factory.serialize(known)));
+  proposal.add_tx_hashes(unknown_hash);
+  google::protobuf::Empty response;
+
+  // missing transaction is fetched after handler returns
+  ASSERT_TRUE(gate_impl->SendCompactProposal(&context, &proposal, &response)
+                  .ok());
+
+  auto result = delivered.get_future();
+  ASSERT_EQ(result.wait_for(std::chrono::seconds(1)),
+            std::future_status::ready);
+  auto transactions = result.get().transactions;
+  ASSERT_EQ(transactions.size(), 2);
+  ASSERT_EQ(transactions.at(0).tx_counter, 1);
+  ASSERT_EQ(transactions.at(1).tx_counter, 2);
+}
+
+TEST_F(OrderingGateTest, AttachedTransactionsResolvedWithoutFetch) {
+  // Init => compact proposal with attached transaction => proposal is
+  // delivered without fetching from service
+  std::promise<Proposal> delivered;
+  gate_impl->on_proposal().subscribe(
+      [&delivered](auto proposal) { delivered.set_value(proposal); });
+
+  EXPECT_CALL(*fake_service, FetchTransactions(_, _, _)).Times(0);
+
+  iroha::model::converters::PbTransactionFactory factory;
+  Transaction tx;
+  tx.tx_counter = 3;
+  auto pb_tx = factory.serialize(tx);
+
+  grpc::ServerContext context;
+  iroha::ordering::proto::CompactProposal proposal;
+  proposal.add_tx_hashes(orderingHash(pb_tx));
+  *proposal.mutable_attached()->add_transactions() = pb_tx;
+  google::protobuf::Empty response;
+
+  ASSERT_TRUE(gate_impl->SendCompactProposal(&context, &proposal, &response)
+                  .ok());
+
+  auto result = delivered.get_future();
+  ASSERT_EQ(result.wait_for(std::chrono::seconds(1)),
+            std::future_status::ready);
+  auto transactions = result.get().transactions;
+  ASSERT_EQ(transactions.size(), 1);
+  ASSERT_EQ(transactions.at(0).tx_counter, 3);
+}
+
+TEST_F(OrderingGateTest, FetchRetriedWhenServiceUnavailable) {
+  // Init => first fetch of missing transaction fails => fetch is retried
+  // and proposal is delivered
+  std::promise<Proposal> delivered;
+  gate_impl->on_proposal().subscribe(
+      [&delivered](auto proposal) { delivered.set_value(proposal); });
+
+  iroha::model::converters::PbTransactionFactory factory;
+  Transaction tx;
+  tx.tx_counter = 4;
+  auto pb_tx = factory.serialize(tx);
+
+  EXPECT_CALL(*fake_service, FetchTransactions(_, _, _))
+      .WillOnce(Invoke([](auto, auto, auto) {
+        return grpc::Status(grpc::StatusCode::UNAVAILABLE, "busy");
+      }))
+      .WillOnce(Invoke([&pb_tx](auto, auto, auto response) {
+        *response->add_transactions() = pb_tx;
+        return grpc::Status::OK;
+      }));
+
+  grpc::ServerContext context;
+  iroha::ordering::proto::CompactProposal proposal;
+  proposal.add_tx_hashes(orderingHash(pb_tx));
+  google::protobuf::Empty response;
+
+  ASSERT_TRUE(gate_impl->SendCompactProposal(&context, &proposal, &response)
+                  .ok());
+
+  auto result = delivered.get_future();
+  ASSERT_EQ(result.wait_for(std::chrono::seconds(1)),
+            std::future_status::ready);
+  ASSERT_EQ(result.get().transactions.at(0).tx_counter, 4);
 }
@@ -32,6 +32,10 @@ namespace iroha {
       MOCK_METHOD3(SendProposal,
                    grpc::Status(::grpc::ServerContext*, const proto::Proposal*,
                                 ::google::protobuf::Empty*));
+      MOCK_METHOD3(SendCompactProposal,
+                   grpc::Status(::grpc::ServerContext*,
+                                const proto::CompactProposal*,
+                                ::google::protobuf::Empty*));
     };
 
     class MockOrderingService : public proto::OrderingService::Service {
@@ -39,6 +43,14 @@ namespace iroha {
       MOCK_METHOD3(SendTransaction, ::grpc::Status(::grpc::ServerContext*,
                                                    const protocol::Transaction*,
                                                    ::google::protobuf::Empty*));
+      MOCK_METHOD3(SendTransactions,
+                   ::grpc::Status(::grpc::ServerContext*,
+                                  const proto::Transactions*,
+                                  proto::TransactionAcks*));
+      MOCK_METHOD3(FetchTransactions,
+                   ::grpc::Status(::grpc::ServerContext*,
+                                  const proto::TransactionsRequest*,
+                                  proto::Transactions*));
     };
 
     class OrderingTest : public ::testing::Test {
@@ -18,6 +18,8 @@
 #include "module/irohad/ordering/ordering_mocks.hpp"
 
 #include <grpc++/grpc++.h>
+#include "model/converters/pb_transaction_factory.hpp"
+#include "ordering/impl/adaptive_batching_policy.hpp"
 #include "ordering/impl/ordering_service_impl.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 
@@ -29,6 +31,7 @@ using namespace iroha::ametsuchi;
 
 using ::testing::_;
 using ::testing::AtLeast;
+using ::testing::Invoke;
 using ::testing::Return;
 
 class OrderingServiceTest : public OrderingTest {
@@ -69,7 +72,7 @@ TEST_F(OrderingServiceTest, ValidWhenProposalSizeStrategy) {
 
   service = std::make_shared<OrderingServiceImpl>(wsv, 5, 1000, loop);
 
-  EXPECT_CALL(*fake_gate, SendProposal(_, _, _)).Times(2);
+  EXPECT_CALL(*fake_gate, SendCompactProposal(_, _, _)).Times(2);
 
   start();
 
@@ -78,7 +81,9 @@ TEST_F(OrderingServiceTest, ValidWhenProposalSizeStrategy) {
 
     google::protobuf::Empty reply;
 
-    client->SendTransaction(&context, iroha::protocol::Transaction(), &reply);
+    iroha::protocol::Transaction tx;
+    tx.mutable_meta()->set_tx_counter(i);
+    client->SendTransaction(&context, tx, &reply);
   }
 
   std::this_thread::sleep_for(std::chrono::seconds(1));
@@ -93,7 +98,7 @@ TEST_F(OrderingServiceTest, ValidWhenTimerStrategy) {
 
   service = std::make_shared<OrderingServiceImpl>(wsv, 100, 400, loop);
 
-  EXPECT_CALL(*fake_gate, SendProposal(_, _, _)).Times(2);
+  EXPECT_CALL(*fake_gate, SendCompactProposal(_, _, _)).Times(2);
 
   start();
 
@@ -102,10 +107,244 @@ TEST_F(OrderingServiceTest, ValidWhenTimerStrategy) {
 
     google::protobuf::Empty reply;
 
-    client->SendTransaction(&context, iroha::protocol::Transaction(), &reply);
+    iroha::protocol::Transaction tx;
+    tx.mutable_meta()->set_tx_counter(i);
+    client->SendTransaction(&context, tx, &reply);
 
     std::this_thread::sleep_for(std::chrono::milliseconds(50));
   }
 
   std::this_thread::sleep_for(std::chrono::seconds(1));
 }
+
+TEST_F(OrderingServiceTest, TransactionsFetchedWhenProposalPublished) {
+  // Init => proposal of 2 transactions sent as hashes => transactions are
+  // fetched by these hashes
+
+  std::shared_ptr<MockPeerQuery> wsv = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillRepeatedly(Return(std::vector<Peer>{
+      peer}));
+
+  service = std::make_shared<OrderingServiceImpl>(wsv, 2, 1000, loop);
+
+  proto::CompactProposal compact;
+  EXPECT_CALL(*fake_gate, SendCompactProposal(_, _, _))
+      .WillOnce(Invoke([&compact](auto, auto request, auto) {
+        compact = *request;
+        return grpc::Status::OK;
+      }));
+
+  start();
+
+  model::converters::PbTransactionFactory factory;
+  for (size_t i = 0; i < 2; ++i) {
+    grpc::ClientContext context;
+    google::protobuf::Empty reply;
+    Transaction tx;
+    tx.tx_counter = i;
+    client->SendTransaction(&context, factory.serialize(tx), &reply);
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  ASSERT_EQ(compact.tx_hashes_size(), 2);
+
+  proto::TransactionsRequest request;
+  request.add_tx_hashes(compact.tx_hashes(1));
+  request.add_tx_hashes("unknown");
+  proto::Transactions response;
+  grpc::ClientContext context;
+  ASSERT_TRUE(client->FetchTransactions(&context, request, &response).ok());
+  ASSERT_EQ(response.transactions_size(), 1);
+  ASSERT_EQ(factory.deserialize(response.transactions(0))->tx_counter, 1);
+  ASSERT_EQ(orderingHash(response.transactions(0)), compact.tx_hashes(1));
+}
+
+TEST_F(OrderingServiceTest, DuplicatesDroppedWhenTransactionRetried) {
+  // Init => same transaction sent 3 times and another one once => one
+  // proposal of 2 transactions, 2 duplicates counted
+
+  std::shared_ptr<MockPeerQuery> wsv = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillRepeatedly(Return(std::vector<Peer>{
+      peer}));
+
+  auto service_impl =
+      std::make_shared<OrderingServiceImpl>(wsv, 2, 1000, loop);
+  service = service_impl;
+
+  proto::CompactProposal compact;
+  EXPECT_CALL(*fake_gate, SendCompactProposal(_, _, _))
+      .WillOnce(Invoke([&compact](auto, auto request, auto) {
+        compact = *request;
+        return grpc::Status::OK;
+      }));
+
+  start();
+
+  for (auto counter : {1, 1, 1, 2}) {
+    grpc::ClientContext context;
+    google::protobuf::Empty reply;
+    iroha::protocol::Transaction tx;
+    tx.mutable_meta()->set_tx_counter(counter);
+    client->SendTransaction(&context, tx, &reply);
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  ASSERT_EQ(compact.tx_hashes_size(), 2);
+  ASSERT_NE(compact.tx_hashes(0), compact.tx_hashes(1));
+  ASSERT_EQ(service_impl->replayMetrics().accepted.load(), 2);
+  ASSERT_EQ(service_impl->replayMetrics().duplicates.load(), 2);
+}
+
+TEST_F(OrderingServiceTest, OverloadReportedWhenQueueFull) {
+  // Init => queue limit 2 => third transaction is rejected as overload
+
+  std::shared_ptr<MockPeerQuery> wsv = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillRepeatedly(Return(std::vector<Peer>{
+      peer}));
+
+  auto service_impl = std::make_shared<OrderingServiceImpl>(
+      wsv,
+      100,
+      10000,
+      loop,
+      ChannelRegistry::getDefault(),
+      AdmissionLimits{2, 1024 * 1024});
+  service = service_impl;
+
+  start();
+
+  proto::Transactions batch;
+  for (auto counter : {1, 2, 3}) {
+    batch.add_transactions()->mutable_meta()->set_tx_counter(counter);
+  }
+  proto::TransactionAcks acks;
+  grpc::ClientContext context;
+  ASSERT_TRUE(client->SendTransactions(&context, batch, &acks).ok());
+
+  ASSERT_EQ(acks.acks_size(), 3);
+  ASSERT_TRUE(acks.acks(0).accepted());
+  ASSERT_TRUE(acks.acks(1).accepted());
+  ASSERT_FALSE(acks.acks(2).accepted());
+  ASSERT_TRUE(acks.acks(2).overloaded());
+  ASSERT_EQ(service_impl->admissionMetrics().rejected.load(), 1);
+
+  grpc::ClientContext single_context;
+  google::protobuf::Empty reply;
+  iroha::protocol::Transaction tx;
+  tx.mutable_meta()->set_tx_counter(4);
+  ASSERT_EQ(client->SendTransaction(&single_context, tx, &reply).error_code(),
+            grpc::StatusCode::RESOURCE_EXHAUSTED);
+}
+
+TEST_F(OrderingServiceTest, TransactionsAttachedUnlessForwardedByPeer) {
+  // Init => one transaction forwarded by the peer, one by other peer =>
+  // proposal to the peer carries both hashes and attaches the other one
+
+  // origin is trusted on the calling host only
+  auto local = peer;
+  local.address = "127.0.0.1:50051";
+  std::shared_ptr<MockPeerQuery> wsv = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillRepeatedly(Return(std::vector<Peer>{
+      local}));
+
+  service = std::make_shared<OrderingServiceImpl>(wsv, 2, 1000, loop);
+
+  proto::CompactProposal compact;
+  EXPECT_CALL(*fake_gate, SendCompactProposal(_, _, _))
+      .WillOnce(Invoke([&compact](auto, auto request, auto) {
+        compact = *request;
+        return grpc::Status::OK;
+      }));
+
+  start();
+
+  for (auto origin : {local.address, std::string("other")}) {
+    proto::Transactions batch;
+    batch.set_origin(origin);
+    batch.add_transactions()->mutable_meta()->set_tx_counter(origin.size());
+    proto::TransactionAcks acks;
+    grpc::ClientContext context;
+    ASSERT_TRUE(client->SendTransactions(&context, batch, &acks).ok());
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  ASSERT_EQ(compact.tx_hashes_size(), 2);
+  ASSERT_EQ(compact.attached().transactions_size(), 1);
+  ASSERT_EQ(compact.attached().transactions(0).meta().tx_counter(), 5);
+  ASSERT_EQ(orderingHash(compact.attached().transactions(0)),
+            compact.tx_hashes(1));
+}
+
+TEST_F(OrderingServiceTest, OriginOfOtherHostIgnored) {
+  // Init => transaction claims to be forwarded by the peer from other host =>
+  // proposal to the peer attaches it
+
+  auto remote = peer;
+  remote.address = "127.0.0.2:50051";
+  std::shared_ptr<MockPeerQuery> wsv = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillRepeatedly(Return(std::vector<Peer>{
+      remote}));
+
+  service = std::make_shared<OrderingServiceImpl>(wsv, 1, 1000, loop);
+
+  proto::CompactProposal compact;
+  EXPECT_CALL(*fake_gate, SendCompactProposal(_, _, _))
+      .WillOnce(Invoke([&compact](auto, auto request, auto) {
+        compact = *request;
+        return grpc::Status::OK;
+      }));
+
+  start();
+
+  proto::Transactions batch;
+  batch.set_origin(remote.address);
+  batch.add_transactions()->mutable_meta()->set_tx_counter(1);
+  proto::TransactionAcks acks;
+  grpc::ClientContext context;
+  ASSERT_TRUE(client->SendTransactions(&context, batch, &acks).ok());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  ASSERT_EQ(compact.tx_hashes_size(), 1);
+  ASSERT_EQ(compact.attached().transactions_size(), 1);
+}
+
+TEST_F(OrderingServiceTest, ProposalHeightsFollowLedger) {
+  // Init => ledger of 5 blocks on start => proposal 6 is committed with its
+  // latency measured => block 9 comes by synchronization => next proposal 10
+
+  std::shared_ptr<MockPeerQuery> wsv = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillRepeatedly(Return(std::vector<Peer>{
+      peer}));
+
+  auto policy = std::make_shared<AdaptiveBatchingPolicy>(
+      BatchingBounds{1, 1024, std::chrono::milliseconds(100)});
+  service = std::make_shared<OrderingServiceImpl>(
+      wsv, policy, loop, ChannelRegistry::getDefault(), AdmissionLimits(), 5);
+
+  std::vector<uint64_t> heights;
+  EXPECT_CALL(*fake_gate, SendCompactProposal(_, _, _))
+      .Times(2)
+      .WillRepeatedly(Invoke([&heights](auto, auto request, auto) {
+        heights.push_back(request->height());
+        return grpc::Status::OK;
+      }));
+
+  start();
+
+  auto send = [this](uint64_t counter) {
+    iroha::protocol::Transaction tx;
+    tx.mutable_meta()->set_tx_counter(counter);
+    grpc::ClientContext context;
+    google::protobuf::Empty reply;
+    client->SendTransaction(&context, tx, &reply);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  };
+
+  send(1);
+  service->onCommit(6);
+  ASSERT_LE(400, policy->metrics().commit_latency_milliseconds);
+
+  service->onCommit(9);
+  send(2);
+  ASSERT_EQ(heights, (std::vector<uint64_t>{6, 10}));
+}
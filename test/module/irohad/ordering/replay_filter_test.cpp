@@ -0,0 +1,54 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "ordering/impl/replay_filter.hpp"
+
+using namespace iroha::ordering;
+
+TEST(ReplayFilterTest, DuplicateDroppedWhenSeenRecently) {
+  ReplayFilter filter(10, std::chrono::minutes(1));
+
+  ASSERT_TRUE(filter.insert("a"));
+  ASSERT_TRUE(filter.insert("b"));
+  ASSERT_FALSE(filter.insert("a"));
+
+  ASSERT_EQ(filter.metrics().accepted.load(), 2);
+  ASSERT_EQ(filter.metrics().duplicates.load(), 1);
+}
+
+TEST(ReplayFilterTest, HashForgottenWhenTtlPassed) {
+  ReplayFilter filter(10, std::chrono::milliseconds(50));
+
+  ASSERT_TRUE(filter.insert("a"));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  ASSERT_TRUE(filter.insert("a"));
+
+  ASSERT_EQ(filter.metrics().expired.load(), 1);
+}
+
+TEST(ReplayFilterTest, OldestForgottenWhenCapacityReached) {
+  ReplayFilter filter(2, std::chrono::minutes(1));
+
+  ASSERT_TRUE(filter.insert("a"));
+  ASSERT_TRUE(filter.insert("b"));
+  ASSERT_TRUE(filter.insert("c"));
+
+  ASSERT_TRUE(filter.insert("a"));
+  ASSERT_FALSE(filter.insert("c"));
+}
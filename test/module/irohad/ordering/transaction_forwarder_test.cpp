@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "module/irohad/ordering/ordering_mocks.hpp"
+
+#include "framework/test_subscriber.hpp"
+#include "model/converters/pb_transaction_factory.hpp"
+#include "ordering/impl/transaction_forwarder.hpp"
+
+using namespace iroha::ordering;
+using namespace framework::test_subscriber;
+
+using ::testing::_;
+using ::testing::Invoke;
+
+class TransactionForwarderTest : public OrderingTest {
+ public:
+  TransactionForwarderTest() {
+    fake_service = static_cast<MockOrderingService *>(service.get());
+  }
+
+  void SetUp() override {
+    OrderingTest::SetUp();
+    forwarder = std::make_unique<TransactionForwarder>(
+        grpc::CreateChannel(address, grpc::InsecureChannelCredentials()),
+        2,
+        std::chrono::microseconds(200000));
+  }
+
+  void TearDown() override {
+    forwarder.reset();
+    OrderingTest::TearDown();
+  }
+
+  MockOrderingService *fake_service;
+  std::unique_ptr<TransactionForwarder> forwarder;
+};
+
+TEST_F(TransactionForwarderTest, BatchesSentWhenFullOrDelayPassed) {
+  // Init => forward 5 transactions with batch size 2 => two full batches
+  // and one batch after delay => every transaction acknowledged in order
+  std::vector<int> batch_sizes;
+  EXPECT_CALL(*fake_service, SendTransactions(_, _, _))
+      .Times(3)
+      .WillRepeatedly(Invoke([&batch_sizes](auto, auto request, auto response) {
+        batch_sizes.push_back(request->transactions_size());
+        for (int i = 0; i < request->transactions_size(); ++i) {
+          // reject odd transactions
+          response->add_acks()->set_accepted(
+              request->transactions(i).meta().tx_counter() % 2 == 0);
+        }
+        return grpc::Status::OK;
+      }));
+
+  std::vector<TransactionAck> acks;
+  auto wrapper = make_test_subscriber<CallExact>(forwarder->on_ack(), 5);
+  wrapper.subscribe([&acks](auto ack) { acks.push_back(ack); });
+
+  iroha::model::converters::PbTransactionFactory factory;
+  for (size_t i = 0; i < 5; ++i) {
+    iroha::model::Transaction tx;
+    tx.tx_counter = i;
+    forwarder->forward(std::to_string(i), factory.serialize(tx));
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(batch_sizes, std::vector<int>({2, 2, 1}));
+  for (size_t i = 0; i < acks.size(); ++i) {
+    ASSERT_EQ(acks.at(i).hash, std::to_string(i));
+    ASSERT_EQ(acks.at(i).accepted, i % 2 == 0);
+  }
+}
@@ -20,6 +20,7 @@
 
 #include <gmock/gmock.h>
 #include "simulator/block_creator.hpp"
+#include "simulator/verified_proposal_creator.hpp"
 
 namespace iroha {
   namespace simulator {
@@ -28,6 +29,13 @@ namespace iroha {
       MOCK_METHOD1(process_verified_proposal, void(model::Proposal));
       MOCK_METHOD0(on_block, rxcpp::observable<model::Block>());
     };
+
+    class MockVerifiedProposalCreator : public VerifiedProposalCreator {
+     public:
+      MOCK_METHOD1(process_proposal, void(model::Proposal));
+      MOCK_METHOD0(on_verified_proposal,
+                   rxcpp::observable<model::Proposal>());
+    };
   }  // namespace simulator
 }  // namespace iroha
 
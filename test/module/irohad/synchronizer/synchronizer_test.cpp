@@ -74,7 +74,7 @@ TEST_F(SynchronizerTest, ValidWhenSingleCommitSynchronized) {
       &createMockMutableStorage);
   EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
 
-  EXPECT_CALL(*mutable_factory, commit_(_)).Times(1);
+  EXPECT_CALL(*mutable_factory, commit_(_)).WillOnce(Return(true));
 
   EXPECT_CALL(*chain_validator, validateBlock(test_block, _))
       .WillOnce(Return(true));
@@ -139,7 +139,7 @@ TEST_F(SynchronizerTest, ValidWhenBlockValidationFailure) {
       &createMockMutableStorage);
   EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(2);
 
-  EXPECT_CALL(*mutable_factory, commit_(_)).Times(1);
+  EXPECT_CALL(*mutable_factory, commit_(_)).WillOnce(Return(true));
 
   EXPECT_CALL(*chain_validator, validateBlock(test_block, _))
       .WillOnce(Return(false));
@@ -168,3 +168,34 @@ TEST_F(SynchronizerTest, ValidWhenBlockValidationFailure) {
 
   ASSERT_TRUE(wrapper.validate());
 }
+
+TEST_F(SynchronizerTest, ValidWhenCommitFailure) {
+  // commit from consensus => block validation passed => commit failed =>
+  // no commit is published
+  Block test_block;
+  test_block.height = 5;
+
+  DefaultValue<std::unique_ptr<MutableStorage>>::SetFactory(
+      &createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
+
+  EXPECT_CALL(*mutable_factory, commit_(_)).WillOnce(Return(false));
+
+  EXPECT_CALL(*chain_validator, validateBlock(test_block, _))
+      .WillOnce(Return(true));
+
+  EXPECT_CALL(*block_loader, requestBlocks(_, _)).Times(0);
+
+  EXPECT_CALL(*consensus_gate, on_commit())
+      .WillOnce(Return(rxcpp::observable<>::empty<Block>()));
+
+  init();
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 0);
+  wrapper.subscribe();
+
+  synchronizer->process_commit(test_block);
+
+  ASSERT_TRUE(wrapper.validate());
+}
@@ -0,0 +1,211 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/irohad/network/network_mocks.hpp"
+
+#include <future>
+#include "torii/processor/block_streamer.hpp"
+
+using namespace iroha;
+using namespace iroha::ametsuchi;
+using namespace iroha::network;
+using namespace iroha::torii;
+using namespace iroha::model;
+
+using ::testing::Return;
+using ::testing::Invoke;
+using ::testing::_;
+
+constexpr size_t Window = 2;
+
+/**
+ * Collects heights of blocks, which are sent on streaming thread
+ */
+class Received {
+ public:
+  BlockStreamer::Sink sink() {
+    return [this](const Block &block) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      heights_.push_back(block.height);
+      cv_.notify_all();
+    };
+  }
+
+  /**
+   * @return heights once there are count of them, or after timeout
+   */
+  std::vector<uint64_t> waitFor(
+      size_t count,
+      std::chrono::milliseconds timeout = std::chrono::seconds(1)) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait_for(
+        lock, timeout, [this, count] { return heights_.size() >= count; });
+    return heights_;
+  }
+
+ private:
+  std::vector<uint64_t> heights_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+// time to make sure that nothing more is sent
+constexpr auto Quiet = std::chrono::milliseconds(100);
+
+class BlockStreamerTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    pcs = std::make_shared<MockPeerCommunicationService>();
+    block_query = std::make_shared<MockBlockQuery>();
+
+    EXPECT_CALL(*pcs, on_commit())
+        .WillRepeatedly(Return(commit_notifier.get_observable()));
+    EXPECT_CALL(*block_query, getBlocks(_, _))
+        .WillRepeatedly(Invoke([this](uint32_t from, uint32_t to) {
+          std::lock_guard<std::mutex> lock(ledger_mutex);
+          std::vector<Block> blocks;
+          for (auto height = from; height <= to and height <= ledger.size();
+               ++height) {
+            blocks.push_back(ledger.at(height - 1));
+          }
+          return rxcpp::observable<>::iterate(blocks);
+        }));
+
+    streamer = std::make_shared<BlockStreamer>(block_query, pcs, Window);
+  }
+
+  void TearDown() override { streamer.reset(); }
+
+  /**
+   * appends block to the ledger and notifies about commit
+   */
+  void commit() {
+    Block block;
+    {
+      std::lock_guard<std::mutex> lock(ledger_mutex);
+      block.height = ledger.size() + 1;
+      block.hash.fill(block.height);
+      ledger.push_back(block);
+    }
+    commit_notifier.get_subscriber().on_next(
+        rxcpp::observable<>::just(block));
+  }
+
+  std::shared_ptr<MockPeerCommunicationService> pcs;
+  std::shared_ptr<MockBlockQuery> block_query;
+  rxcpp::subjects::subject<Commit> commit_notifier;
+  std::vector<Block> ledger;
+  std::mutex ledger_mutex;
+  std::shared_ptr<BlockStreamer> streamer;
+};
+
+/**
+ * Blocks from storage are sent up to window, the rest after acknowledgement
+ */
+TEST_F(BlockStreamerTest, ReplaysHistoryWithinWindow) {
+  for (size_t i = 0; i < 4; ++i) {
+    commit();
+  }
+
+  Received received;
+  auto id = streamer->subscribe(2, received.sink());
+  ASSERT_EQ(received.waitFor(2), (std::vector<uint64_t>{2, 3}));
+  ASSERT_EQ(received.waitFor(3, Quiet).size(), 2);
+
+  streamer->ack(id);
+  ASSERT_EQ(received.waitFor(3), (std::vector<uint64_t>{2, 3, 4}));
+
+  // caught up, nothing to send
+  streamer->ack(id);
+  streamer->ack(id);
+  ASSERT_EQ(received.waitFor(4, Quiet).size(), 3);
+}
+
+/**
+ * Subscriber which is caught up receives new commits,
+ * a slow one catches up from storage after acknowledgement
+ */
+TEST_F(BlockStreamerTest, FollowsCommits) {
+  commit();
+
+  Received received;
+  auto id = streamer->subscribe(1, received.sink());
+  ASSERT_EQ(received.waitFor(1), (std::vector<uint64_t>{1}));
+  commit();
+  ASSERT_EQ(received.waitFor(2), (std::vector<uint64_t>{1, 2}));
+
+  // window is full
+  commit();
+  commit();
+  ASSERT_EQ(received.waitFor(3, Quiet).size(), 2);
+
+  streamer->ack(id);
+  streamer->ack(id);
+  ASSERT_EQ(received.waitFor(4), (std::vector<uint64_t>{1, 2, 3, 4}));
+}
+
+/**
+ * Blocks are not sent after unsubscribe
+ */
+TEST_F(BlockStreamerTest, StopsAfterUnsubscribe) {
+  Received received;
+  auto id = streamer->subscribe(1, received.sink());
+  commit();
+  ASSERT_EQ(received.waitFor(1).size(), 1);
+  streamer->unsubscribe(id);
+  commit();
+  ASSERT_EQ(received.waitFor(2, Quiet).size(), 1);
+}
+
+/**
+ * Sink is invoked without lock of streamer, so it may acknowledge and
+ * unsubscribe on its own
+ */
+TEST_F(BlockStreamerTest, SinkMayCallStreamer) {
+  for (size_t i = 0; i < 4; ++i) {
+    commit();
+  }
+
+  std::promise<void> done;
+  uint64_t id = 0;
+  std::mutex id_mutex;
+  std::vector<uint64_t> heights;
+  std::unique_lock<std::mutex> id_lock(id_mutex);
+  id = streamer->subscribe(1, [&](const Block &block) {
+    std::lock_guard<std::mutex> lock(id_mutex);
+    heights.push_back(block.height);
+    streamer->ack(id);
+    if (block.height == 3) {
+      streamer->unsubscribe(id);
+      done.set_value();
+    }
+  });
+  id_lock.unlock();
+
+  ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(1)),
+            std::future_status::ready);
+  ASSERT_EQ(heights, (std::vector<uint64_t>{1, 2, 3}));
+}
+
+/**
+ * Hash is known only for committed blocks
+ */
+TEST_F(BlockStreamerTest, BlockHash) {
+  commit();
+  ASSERT_EQ(streamer->blockHash(1), ledger.at(0).hash);
+  ASSERT_FALSE(streamer->blockHash(2).has_value());
+}
@@ -0,0 +1,137 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <future>
+#include <thread>
+
+#include "torii/processor/query_executor.hpp"
+
+using namespace iroha::torii;
+
+constexpr size_t Lookup = 0;
+constexpr size_t History = 1;
+constexpr auto Wait = std::chrono::seconds(5);
+
+class QueryExecutorTest : public ::testing::Test {
+ public:
+  /**
+   * @return job blocking its worker until release()
+   */
+  QueryExecutor::Job blockingJob() {
+    return [this](size_t) {
+      started.set_value();
+      released.wait();
+    };
+  }
+
+  void release() {
+    if (not is_released) {
+      is_released = true;
+      release_promise.set_value();
+    }
+  }
+
+  void TearDown() override {
+    // blocked worker would never be joined
+    release();
+    executor.reset();
+  }
+
+  std::unique_ptr<QueryExecutor> executor;
+  bool is_released = false;
+  std::promise<void> started;
+  std::promise<void> release_promise;
+  std::shared_future<void> released = release_promise.get_future().share();
+};
+
+/**
+ * @given executor with a single worker busy with a query
+ * @when more queries are submitted than the class may queue
+ * @then excess query is rejected, queued one is executed later
+ */
+TEST_F(QueryExecutorTest, RejectsQueriesOverQueueLimit) {
+  executor = std::make_unique<QueryExecutor>(
+      1, std::vector<QueryClassLimits>{{1, 1, std::chrono::seconds(10)}});
+  ASSERT_TRUE(executor->submit(Lookup, blockingJob(), [] {}));
+  ASSERT_EQ(std::future_status::ready, started.get_future().wait_for(Wait));
+
+  std::promise<size_t> executed;
+  ASSERT_TRUE(executor->submit(
+      Lookup, [&executed](size_t worker) { executed.set_value(worker); },
+      [] {}));
+  ASSERT_FALSE(executor->submit(Lookup, [](size_t) {}, [] {}));
+  ASSERT_EQ(1, executor->metrics().rejected.load());
+
+  release();
+  auto worker = executed.get_future();
+  ASSERT_EQ(std::future_status::ready, worker.wait_for(Wait));
+  ASSERT_EQ(0, worker.get());
+}
+
+/**
+ * @given executor with a single worker busy with a query
+ * @when query waits for the worker longer than its deadline
+ * @then query is not executed and expired callback is invoked
+ */
+TEST_F(QueryExecutorTest, ExpiresQueriesOverDeadline) {
+  executor = std::make_unique<QueryExecutor>(
+      1,
+      std::vector<QueryClassLimits>{{1, 10, std::chrono::seconds(10)},
+                                    {1, 10, std::chrono::milliseconds(0)}});
+  ASSERT_TRUE(executor->submit(Lookup, blockingJob(), [] {}));
+  ASSERT_EQ(std::future_status::ready, started.get_future().wait_for(Wait));
+
+  std::promise<void> expired;
+  ASSERT_TRUE(executor->submit(
+      History,
+      [](size_t) { FAIL() << "expired query is executed"; },
+      [&expired] { expired.set_value(); }));
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  release();
+  ASSERT_EQ(std::future_status::ready, expired.get_future().wait_for(Wait));
+  ASSERT_EQ(1, executor->metrics().expired.load());
+}
+
+/**
+ * @given executor with two workers, history queries run one at a time
+ * @when history query is running and another one is queued
+ * @then lookup query is executed by the second worker meanwhile
+ */
+TEST_F(QueryExecutorTest, HistoryQueriesDoNotDelayLookups) {
+  executor = std::make_unique<QueryExecutor>(
+      2,
+      std::vector<QueryClassLimits>{{2, 10, std::chrono::seconds(10)},
+                                    {1, 10, std::chrono::seconds(10)}});
+  ASSERT_TRUE(executor->submit(History, blockingJob(), [] {}));
+  ASSERT_EQ(std::future_status::ready, started.get_future().wait_for(Wait));
+
+  std::promise<void> history;
+  ASSERT_TRUE(executor->submit(
+      History, [&history](size_t) { history.set_value(); }, [] {}));
+  std::promise<void> lookup;
+  ASSERT_TRUE(executor->submit(
+      Lookup, [&lookup](size_t) { lookup.set_value(); }, [] {}));
+
+  ASSERT_EQ(std::future_status::ready, lookup.get_future().wait_for(Wait));
+  auto history_done = history.get_future();
+  ASSERT_EQ(std::future_status::timeout,
+            history_done.wait_for(std::chrono::milliseconds(10)));
+
+  release();
+  ASSERT_EQ(std::future_status::ready, history_done.wait_for(Wait));
+}
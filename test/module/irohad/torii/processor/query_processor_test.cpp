@@ -56,3 +56,54 @@ TEST(QueryProcessorTest, QueryProcessorWhereInvokeInvalidQuery) {
   });
   qpi.queryHandle(query);
 }
+
+/**
+ * @given query processor which may not queue lookup queries
+ * @when valid query is handled
+ * @then query is rejected as the peer is overloaded
+ */
+TEST(QueryProcessorTest, QueryProcessorWhereQueueIsFull) {
+  auto wsv_queries = std::make_shared<MockWsvQuery>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+  std::vector<std::unique_ptr<model::QueryProcessingFactory>> qpfs;
+  qpfs.push_back(std::make_unique<model::QueryProcessingFactory>(
+      wsv_queries, block_queries));
+
+  auto validation = std::make_shared<MockStatelessValidator>();
+  EXPECT_CALL(*validation, validate(A<std::shared_ptr<const model::Query>>()))
+      .WillRepeatedly(Return(true));
+
+  auto limits = iroha::torii::QueryProcessorImpl::defaultLimits(1);
+  limits[iroha::torii::QueryProcessorImpl::LOOKUP].max_queued = 0;
+  iroha::torii::QueryProcessorImpl qpi(std::move(qpfs), validation, limits);
+  auto query = std::make_shared<model::GetAccount>();
+
+  auto wrapper = make_test_subscriber<CallExact>(
+      qpi.queryNotifier().filter([](auto response) {
+        return instanceof <model::ErrorResponse>(response);
+      }), 1);
+  wrapper.subscribe([](auto response) {
+    auto resp = static_cast<model::ErrorResponse &>(*response);
+    ASSERT_EQ(resp.reason, iroha::model::ErrorResponse::OVERLOADED);
+  });
+  qpi.queryHandle(query);
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given number of query workers
+ * @when default limits are made for them
+ * @then history queries leave one worker to lookups
+ */
+TEST(QueryProcessorTest, HistoryLeavesWorkerToLookups) {
+  using iroha::torii::QueryProcessorImpl;
+  ASSERT_EQ(QueryProcessorImpl::defaultLimits(1)[QueryProcessorImpl::HISTORY]
+                .max_running,
+            1);
+  ASSERT_EQ(QueryProcessorImpl::defaultLimits(2)[QueryProcessorImpl::HISTORY]
+                .max_running,
+            1);
+  ASSERT_EQ(QueryProcessorImpl::defaultLimits(4)[QueryProcessorImpl::HISTORY]
+                .max_running,
+            3);
+}
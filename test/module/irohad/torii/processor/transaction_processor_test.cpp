@@ -15,10 +15,15 @@
  * limitations under the License.
  */
 
+#include <future>
+
 #include "module/irohad/network/network_mocks.hpp"
+#include "module/irohad/simulator/simulator_mocks.hpp"
 #include "module/irohad/validation/validation_mocks.hpp"
 
 #include "torii/processor/transaction_processor_impl.hpp"
+#include "model/tx_responses/commit_response.hpp"
+#include "model/tx_responses/stateful_response.hpp"
 #include "model/tx_responses/stateless_response.hpp"
 #include "framework/test_subscriber.hpp"
 
@@ -39,10 +44,46 @@ class TransactionProcessorTest : public ::testing::Test {
   void SetUp() override {
     pcs = std::make_shared<MockPeerCommunicationService>();
     validation = std::make_shared<MockStatelessValidator>();
-    tp = std::make_shared<TransactionProcessorImpl>(pcs, validation);
+    proposal_creator =
+        std::make_shared<simulator::MockVerifiedProposalCreator>();
+
+    EXPECT_CALL(*pcs, on_proposal())
+        .WillRepeatedly(Return(prop_notifier.get_observable()));
+    EXPECT_CALL(*pcs, on_commit())
+        .WillRepeatedly(Return(commit_notifier.get_observable()));
+    EXPECT_CALL(*pcs, on_rejected())
+        .WillRepeatedly(Return(rejected_notifier.get_observable()));
+    EXPECT_CALL(*proposal_creator, on_verified_proposal())
+        .WillRepeatedly(Return(verified_prop_notifier.get_observable()));
+
+    tp = std::make_shared<TransactionProcessorImpl>(
+        pcs, validation, proposal_creator);
+  }
+
+  /**
+   * Wait until handled transactions are validated and their statuses are
+   * notified, processor waits for them when destroyed
+   */
+  void waitValidated() {
+    tp.reset();
+  }
+
+  /**
+   * @return transaction with given counter and hash
+   */
+  Transaction makeTx(uint64_t counter) {
+    Transaction tx;
+    tx.tx_counter = counter;
+    tx.tx_hash.fill(counter);
+    return tx;
   }
 
   std::shared_ptr<MockPeerCommunicationService> pcs;
+  std::shared_ptr<simulator::MockVerifiedProposalCreator> proposal_creator;
+  rxcpp::subjects::subject<Proposal> prop_notifier;
+  rxcpp::subjects::subject<Proposal> verified_prop_notifier;
+  rxcpp::subjects::subject<Commit> commit_notifier;
+  rxcpp::subjects::subject<Transaction> rejected_notifier;
   std::shared_ptr<MockStatelessValidator> validation;
   std::shared_ptr<TransactionProcessorImpl> tp;
 };
@@ -65,6 +106,7 @@ TEST_F(TransactionProcessorTest,
     ASSERT_EQ(resp.passed, true);
   });
   tp->transactionHandle(tx);
+  waitValidated();
 
   ASSERT_TRUE(wrapper.validate());
 }
@@ -88,6 +130,241 @@ TEST_F(TransactionProcessorTest,
     ASSERT_EQ(resp.passed, false);
   });
   tp->transactionHandle(tx);
+  waitValidated();
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * Transaction processor test case, when network is overloaded
+ */
+TEST_F(TransactionProcessorTest,
+     TransactionProcessorWhereNetworkOverloaded) {
+
+  EXPECT_CALL(*pcs, is_overloaded()).WillOnce(Return(true));
+  EXPECT_CALL(*pcs, propagate_transaction(_)).Times(0);
+
+  EXPECT_CALL(*validation, validate(A<const Transaction&>())).WillRepeatedly(Return(true));
+
+  auto tx = std::make_shared<Transaction>();
+
+  auto wrapper = make_test_subscriber<CallExact>(tp->transactionNotifier(), 1);
+  wrapper.subscribe([](auto response) {
+    auto resp = static_cast<TransactionStatelessResponse &>(*response);
+    ASSERT_EQ(resp.passed, true);
+    ASSERT_EQ(resp.overloaded, true);
+  });
+  tp->transactionHandle(tx);
+  waitValidated();
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * Transaction processor test case, when ordering service rejects propagated
+ * transaction
+ * Overloaded status follows the status of stateless validation
+ */
+TEST_F(TransactionProcessorTest,
+     TransactionProcessorWhereRejectedByOrderingService) {
+  EXPECT_CALL(*pcs, is_overloaded()).WillOnce(Return(false));
+  EXPECT_CALL(*pcs, propagate_transaction(_)).Times(1);
+
+  EXPECT_CALL(*validation, validate(A<const Transaction&>())).WillRepeatedly(Return(true));
+
+  auto tx = std::make_shared<Transaction>(makeTx(1));
+
+  std::vector<bool> overloaded;
+  std::promise<void> accepted;
+  auto wrapper = make_test_subscriber<CallExact>(tp->transactionNotifier(), 2);
+  wrapper.subscribe([&overloaded, &accepted](auto response) {
+    auto resp = static_cast<TransactionStatelessResponse &>(*response);
+    ASSERT_EQ(resp.passed, true);
+    overloaded.push_back(resp.overloaded);
+    if (overloaded.size() == 1) {
+      accepted.set_value();
+    }
+  });
+  tp->transactionHandle(tx);
+  // ordering service rejects transaction after it is propagated
+  accepted.get_future().wait();
+  rejected_notifier.get_subscriber().on_next(*tx);
+
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(overloaded, std::vector<bool>({false, true}));
+}
+
+/**
+ * Transaction processor test case, when handling batch of transactions
+ * Valid ones are propagated, statuses are notified in the batch order
+ */
+TEST_F(TransactionProcessorTest,
+     TransactionProcessorWhereInvokeBatch) {
+  constexpr size_t batch_size = 10;
+
+  EXPECT_CALL(*pcs, propagate_transaction(_)).Times(batch_size / 2);
+
+  // transactions with even counter are valid
+  EXPECT_CALL(*validation, validate(A<const Transaction&>()))
+      .WillRepeatedly(::testing::Invoke(
+          [](const Transaction &tx) { return tx.tx_counter % 2 == 0; }));
+
+  std::vector<std::shared_ptr<Transaction>> txs;
+  for (size_t i = 0; i < batch_size; ++i) {
+    auto tx = std::make_shared<Transaction>();
+    tx->tx_counter = i;
+    txs.push_back(tx);
+  }
+
+  size_t counter = 0;
+  auto wrapper =
+      make_test_subscriber<CallExact>(tp->transactionNotifier(), batch_size);
+  wrapper.subscribe([&counter](auto response) {
+    auto resp = static_cast<TransactionStatelessResponse &>(*response);
+    ASSERT_EQ(resp.transaction.tx_counter, counter);
+    ASSERT_EQ(resp.passed, counter % 2 == 0);
+    ++counter;
+  });
+  tp->transactionBatchHandle(txs);
+  waitValidated();
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * Transaction processor test case, when more transactions are submitted
+ * than may wait for validation
+ * Transactions over the bound are answered as overloaded at once,
+ * queued ones are validated and propagated
+ */
+TEST_F(TransactionProcessorTest,
+     TransactionProcessorWhereValidationQueueIsFull) {
+  constexpr size_t max_queued = 2;
+  constexpr size_t flood = 5;
+  tp = std::make_shared<TransactionProcessorImpl>(
+      pcs, validation, proposal_creator, 1, max_queued);
+
+  EXPECT_CALL(*pcs, propagate_transaction(_)).Times(max_queued);
+
+  // validation is held until the flood is submitted
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  EXPECT_CALL(*validation, validate(A<const Transaction&>()))
+      .WillRepeatedly(::testing::Invoke([released](const Transaction &) {
+        released.wait();
+        return true;
+      }));
+
+  std::vector<std::shared_ptr<Transaction>> txs;
+  for (size_t i = 0; i < flood; ++i) {
+    txs.push_back(std::make_shared<Transaction>(makeTx(i)));
+  }
+
+  std::vector<uint64_t> overloaded, passed;
+  auto wrapper =
+      make_test_subscriber<CallExact>(tp->transactionNotifier(), flood);
+  wrapper.subscribe([&overloaded, &passed](auto response) {
+    auto resp = static_cast<TransactionStatelessResponse &>(*response);
+    (resp.overloaded ? overloaded : passed)
+        .push_back(resp.transaction.tx_counter);
+  });
+  tp->transactionBatchHandle(txs);
+
+  ASSERT_EQ(overloaded, (std::vector<uint64_t>{2, 3, 4}));
+  release.set_value();
+  waitValidated();
+
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(passed, (std::vector<uint64_t>{0, 1}));
+}
+
+/**
+ * Transaction processor test case, when transactions of one creator are
+ * validated out of order
+ * Statuses of the creator are notified in order of submission,
+ * another creator is not blocked by slow validation
+ */
+TEST_F(TransactionProcessorTest,
+     TransactionProcessorWhereValidatedOutOfOrder) {
+  tp = std::make_shared<TransactionProcessorImpl>(
+      pcs, validation, proposal_creator, 2);
+
+  EXPECT_CALL(*pcs, propagate_transaction(_)).Times(3);
+
+  // the first transaction of the creator is validated the longest
+  EXPECT_CALL(*validation, validate(A<const Transaction&>()))
+      .WillRepeatedly(::testing::Invoke([](const Transaction &tx) {
+        if (tx.tx_counter == 0) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+        return true;
+      }));
+
+  std::vector<std::shared_ptr<Transaction>> txs;
+  for (size_t i = 0; i < 3; ++i) {
+    auto tx = std::make_shared<Transaction>();
+    tx->tx_counter = i;
+    tx->creator_account_id = i < 2 ? "slow@test" : "fast@test";
+    txs.push_back(tx);
+  }
+
+  std::vector<uint64_t> counters;
+  auto wrapper = make_test_subscriber<CallExact>(tp->transactionNotifier(), 3);
+  wrapper.subscribe([&counters](auto response) {
+    auto resp = static_cast<TransactionStatelessResponse &>(*response);
+    counters.push_back(resp.transaction.tx_counter);
+  });
+  tp->transactionBatchHandle(txs);
+  waitValidated();
+
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(counters, (std::vector<uint64_t>{2, 0, 1}));
+}
+
+/**
+ * Transaction processor test case, when proposal is verified
+ * Transactions of verified proposal pass stateful validation,
+ * other transactions of the proposal are rejected.
+ * Proposal may arrive after its verified counterpart.
+ */
+TEST_F(TransactionProcessorTest,
+     TransactionProcessorWhereProposalVerified) {
+  Proposal proposal(std::vector<Transaction>{makeTx(1), makeTx(2)});
+  proposal.height = 5;
+  Proposal verified(std::vector<Transaction>{makeTx(1)});
+  verified.height = 5;
+
+  std::vector<std::pair<uint64_t, bool>> statuses;
+  auto wrapper = make_test_subscriber<CallExact>(tp->transactionNotifier(), 2);
+  wrapper.subscribe([&statuses](auto response) {
+    auto resp = static_cast<TransactionStatefulResponse &>(*response);
+    ASSERT_EQ(resp.height, 5);
+    statuses.emplace_back(resp.transaction.tx_counter, resp.passed);
+  });
+  verified_prop_notifier.get_subscriber().on_next(verified);
+  prop_notifier.get_subscriber().on_next(proposal);
+
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(statuses,
+            (std::vector<std::pair<uint64_t, bool>>{{1, true}, {2, false}}));
+}
+
+/**
+ * Transaction processor test case, when block is committed
+ * Each transaction of the block is reported as committed
+ */
+TEST_F(TransactionProcessorTest,
+     TransactionProcessorWhereBlockCommitted) {
+  Block block;
+  block.height = 7;
+  block.transactions = {makeTx(1), makeTx(2)};
+
+  auto wrapper = make_test_subscriber<CallExact>(tp->transactionNotifier(), 2);
+  wrapper.subscribe([](auto response) {
+    auto resp = static_cast<TransactionCommitResponse &>(*response);
+    ASSERT_EQ(resp.height, 7);
+  });
+  commit_notifier.get_subscriber().on_next(rxcpp::observable<>::just(block));
 
   ASSERT_TRUE(wrapper.validate());
 }
@@ -0,0 +1,146 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "torii/response_map.hpp"
+#include <endpoint.pb.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace torii;
+using iroha::protocol::ToriiResponse;
+
+/**
+ * @given response map
+ * @when response is inserted twice
+ * @then second insert is rejected until request is completed
+ */
+TEST(ResponseMapTest, RejectsPendingDuplicate) {
+  ResponseMap<ToriiResponse> map(10, std::chrono::minutes(1));
+  ToriiResponse first, second;
+
+  ASSERT_TRUE(map.insert("hash", first));
+  ASSERT_FALSE(map.insert("hash", second));
+  ASSERT_EQ(1, map.metrics().outstanding.load());
+
+  map.complete("hash");
+  ASSERT_EQ(0, map.metrics().outstanding.load());
+  ASSERT_EQ(1, map.metrics().completed.load());
+  ASSERT_TRUE(map.insert("hash", second));
+}
+
+/**
+ * @given response map with pending request
+ * @when response is updated by hash
+ * @then registered response is changed, unknown hash is reported
+ */
+TEST(ResponseMapTest, UpdatesRegisteredResponse) {
+  ResponseMap<ToriiResponse> map(10, std::chrono::minutes(1));
+  ToriiResponse response;
+  map.insert("hash", response);
+
+  ASSERT_TRUE(map.update("hash", [](ToriiResponse &r) {
+    r.set_validation(iroha::protocol::STATELESS_VALIDATION_SUCCESS);
+  }));
+  ASSERT_EQ(iroha::protocol::STATELESS_VALIDATION_SUCCESS,
+            response.validation());
+  ASSERT_FALSE(map.update("unknown", [](ToriiResponse &) {}));
+}
+
+/**
+ * @given response map with capacity 2
+ * @when third request is inserted
+ * @then the oldest one is evicted
+ */
+TEST(ResponseMapTest, EvictsOldestOverCapacity) {
+  ResponseMap<ToriiResponse> map(2, std::chrono::minutes(1));
+  ToriiResponse a, b, c;
+  map.insert("a", a);
+  map.insert("b", b);
+  map.insert("c", c);
+
+  ASSERT_EQ(2, map.metrics().outstanding.load());
+  ASSERT_EQ(1, map.metrics().evicted.load());
+  ASSERT_FALSE(map.update("a", [](ToriiResponse &) {}));
+  ASSERT_TRUE(map.update("c", [](ToriiResponse &) {}));
+}
+
+/**
+ * @given response map with short ttl
+ * @when request is not completed in time
+ * @then it is forgotten on next insert
+ */
+TEST(ResponseMapTest, ExpiresStaleRequests) {
+  ResponseMap<ToriiResponse> map(10, std::chrono::milliseconds(10));
+  ToriiResponse stale, fresh;
+  map.insert("stale", stale);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  map.insert("fresh", fresh);
+
+  ASSERT_EQ(1, map.metrics().expired.load());
+  ASSERT_EQ(1, map.metrics().outstanding.load());
+  ASSERT_FALSE(map.update("stale", [](ToriiResponse &) {}));
+}
+
+/**
+ * @given response map with pending request and its callback
+ * @when the same request is inserted again and then completed
+ * @then callback of the first request is kept and invoked once
+ */
+TEST(ResponseMapTest, InvokesCallbackOnComplete) {
+  ResponseMap<ToriiResponse> map(10, std::chrono::minutes(1));
+  ToriiResponse first, second;
+  size_t first_calls = 0, second_calls = 0;
+
+  ASSERT_TRUE(map.insert("hash", first, [&first_calls] { ++first_calls; }));
+  ASSERT_FALSE(
+      map.insert("hash", second, [&second_calls] { ++second_calls; }));
+  map.complete("hash");
+  map.complete("hash");
+
+  ASSERT_EQ(1, first_calls);
+  ASSERT_EQ(0, second_calls);
+}
+
+/**
+ * @given response map with drop handler and capacity 1
+ * @when request is evicted or expires
+ * @then its response is filled by drop handler and its callback is invoked
+ */
+TEST(ResponseMapTest, AnswersDroppedRequests) {
+  ResponseMap<ToriiResponse> map(
+      1, std::chrono::milliseconds(10), [](ToriiResponse &r) {
+        r.set_admission(iroha::protocol::ADMISSION_OVERLOADED);
+      });
+  ToriiResponse evicted, stale, fresh;
+  std::vector<std::string> answered;
+  auto answer = [&answered](const std::string &name) {
+    return [&answered, name] { answered.push_back(name); };
+  };
+
+  map.insert("evicted", evicted, answer("evicted"));
+  map.insert("stale", stale, answer("stale"));
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  map.insert("fresh", fresh, answer("fresh"));
+
+  ASSERT_EQ(std::vector<std::string>({"evicted", "stale"}), answered);
+  ASSERT_EQ(iroha::protocol::ADMISSION_OVERLOADED, evicted.admission());
+  ASSERT_EQ(iroha::protocol::ADMISSION_OVERLOADED, stale.admission());
+  ASSERT_EQ(iroha::protocol::ADMISSION_ACCEPTED, fresh.admission());
+  ASSERT_EQ(1, map.metrics().evicted.load());
+  ASSERT_EQ(1, map.metrics().expired.load());
+}
@@ -16,7 +16,9 @@ limitations under the License.
 
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 #include "module/irohad/network/network_mocks.hpp"
+#include "module/irohad/simulator/simulator_mocks.hpp"
 #include "module/irohad/validation/validation_mocks.hpp"
+#include <algorithm>
 
 #include "main/server_runner.hpp"
 #include "torii/command_service.hpp"
@@ -35,6 +37,7 @@ using ::testing::Return;
 using ::testing::A;
 using ::testing::_;
 using ::testing::AtLeast;
+using ::testing::Invoke;
 
 using namespace iroha::network;
 using namespace iroha::validation;
@@ -47,13 +50,31 @@ class ToriiServiceTest : public testing::Test {
     th = std::thread([this] {
       // ----------- Command Service --------------
       pcsMock = std::make_shared<MockPeerCommunicationService>();
+      vpcMock = std::make_shared<
+          iroha::simulator::MockVerifiedProposalCreator>();
+      EXPECT_CALL(*pcsMock, on_proposal())
+          .WillRepeatedly(
+              Return(rxcpp::observable<>::empty<iroha::model::Proposal>()));
+      EXPECT_CALL(*pcsMock, on_commit())
+          .WillRepeatedly(Return(rxcpp::observable<>::empty<Commit>()));
+      EXPECT_CALL(*pcsMock, on_rejected())
+          .WillRepeatedly(Return(
+              rxcpp::observable<>::empty<iroha::model::Transaction>()));
+      EXPECT_CALL(*vpcMock, on_verified_proposal())
+          .WillRepeatedly(
+              Return(rxcpp::observable<>::empty<iroha::model::Proposal>()));
       statelessValidatorMock = std::make_shared<MockStatelessValidator>();
-      wsv_query = std::make_shared<MockWsvQuery>();
+      wsv_query = std::make_shared<MockReadOnlyWsv>();
+      ON_CALL(*wsv_query, snapshot(_))
+          .WillByDefault(Invoke([](std::function<void()> function) {
+            function();
+            return true;
+          }));
       block_query = std::make_shared<MockBlockQuery>();
 
       auto tx_processor =
           std::make_shared<iroha::torii::TransactionProcessorImpl>(
-              pcsMock, statelessValidatorMock);
+              pcsMock, statelessValidatorMock, vpcMock);
       auto pb_tx_factory =
           std::make_shared<iroha::model::converters::PbTransactionFactory>();
 
@@ -73,8 +94,11 @@ class ToriiServiceTest : public testing::Test {
       auto pb_query_resp_factory =
           std::make_shared<iroha::model::converters::PbQueryResponseFactory>();
 
+      auto block_streamer =
+          std::make_shared<iroha::torii::BlockStreamer>(block_query, pcsMock);
+
       auto query_service = std::make_unique<torii::QueryService>(
-          pb_query_factory, pb_query_resp_factory, qpi);
+          pb_query_factory, pb_query_resp_factory, qpi, block_streamer);
 
       //----------- Server run ----------------
       runner->run(std::move(command_service), std::move(query_service));
@@ -93,9 +117,10 @@ class ToriiServiceTest : public testing::Test {
   std::thread th;
 
   std::shared_ptr<MockPeerCommunicationService> pcsMock;
+  std::shared_ptr<iroha::simulator::MockVerifiedProposalCreator> vpcMock;
   std::shared_ptr<MockStatelessValidator> statelessValidatorMock;
 
-  std::shared_ptr<MockWsvQuery> wsv_query;
+  std::shared_ptr<MockReadOnlyWsv> wsv_query;
   std::shared_ptr<MockBlockQuery> block_query;
 };
 
@@ -360,6 +385,50 @@ TEST_F(ToriiServiceTest, FindSignatoriesWhenValid) {
   ASSERT_EQ(response_pubkey, pubkey);
 }
 
+/**
+ * Test for query batch response
+ */
+
+TEST_F(ToriiServiceTest, FindBatchReturnsResponsesInOrder) {
+  // batch is validated once
+  EXPECT_CALL(*statelessValidatorMock,
+              validate(A<std::shared_ptr<const iroha::model::Query>>()))
+      .WillOnce(Return(true));
+
+  iroha::model::Account account;
+  account.account_id = "accountA";
+
+  iroha::ed25519::pubkey_t pubkey;
+  std::fill(pubkey.begin(), pubkey.end(), 0x1);
+  std::vector<iroha::ed25519::pubkey_t> keys;
+  keys.push_back(pubkey);
+
+  EXPECT_CALL(*wsv_query, snapshot(_)).Times(1);
+  EXPECT_CALL(*wsv_query, getAccount("accountA"))
+      .WillRepeatedly(Return(account));
+  EXPECT_CALL(*wsv_query, getSignatories("accountA")).WillOnce(Return(keys));
+
+  iroha::protocol::QueryBatch batch;
+  batch.set_creator_account_id("accountA");
+  batch.add_queries()->mutable_get_account_signatories()->set_account_id(
+      "accountA");
+  batch.add_queries()->mutable_get_account()->set_account_id("accountA");
+  // queries are executed on behalf of the batch creator
+  batch.add_queries()->mutable_get_account()->set_account_id("accountB");
+
+  iroha::protocol::QueryBatchResponse response;
+  auto stat =
+      torii_utils::QuerySyncClient(Ip, Port).FindBatch(batch, response);
+  ASSERT_TRUE(stat.ok());
+  ASSERT_FALSE(response.has_error_response());
+  ASSERT_EQ(response.responses_size(), 3);
+  ASSERT_TRUE(response.responses(0).has_signatories_response());
+  ASSERT_EQ(response.responses(1).account_response().account().account_id(),
+            "accountA");
+  ASSERT_EQ(response.responses(2).error_response().reason(),
+            iroha::protocol::ErrorResponse::STATEFUL_INVALID);
+}
+
 /**
  * Test for transactions response
  */
@@ -372,21 +441,18 @@ TEST_F(ToriiServiceTest, FindTransactionsWhenValid) {
   iroha::model::Account account;
   account.account_id = "accountA";
 
-  auto txs_observable  =
-          rxcpp::observable<>::iterate([account] {
-              std::vector<iroha::model::Transaction> result;
-              for (size_t i = 0; i < 3; ++i) {
-                iroha::model::Transaction current;
-                current.creator_account_id = account.account_id;
-                current.tx_counter = i;
-                result.push_back(current);
-              }
-              return result;
-          }());
+  iroha::ametsuchi::TransactionPage page;
+  for (size_t i = 0; i < 3; ++i) {
+    iroha::model::Transaction current;
+    current.creator_account_id = account.account_id;
+    current.tx_counter = i;
+    page.transactions.push_back(current);
+  }
 
   EXPECT_CALL(*wsv_query, getAccount(_)).WillOnce(Return(account));
-  EXPECT_CALL(*block_query, getAccountTransactions(account.account_id))
-      .WillOnce(Return(txs_observable));
+  EXPECT_CALL(*block_query,
+              getAccountTransactions(account.account_id, _, _))
+      .WillOnce(Return(page));
 
   iroha::protocol::QueryResponse response;
 
@@ -411,6 +477,90 @@ TEST_F(ToriiServiceTest, FindTransactionsWhenValid) {
   }
 }
 
+TEST_F(ToriiServiceTest, FindStreamReturnsTransactionsPageByPage) {
+  EXPECT_CALL(*statelessValidatorMock,
+              validate(A<std::shared_ptr<const iroha::model::Query>>()))
+      .WillRepeatedly(Return(true));
+
+  iroha::model::Account account;
+  account.account_id = "accountA";
+  EXPECT_CALL(*wsv_query, getAccount(_)).WillRepeatedly(Return(account));
+
+  // ledger of five transactions, cursor of each is its counter
+  std::vector<iroha::model::Transaction> txs;
+  std::vector<iroha::hash256_t> cursors;
+  for (size_t i = 0; i < 5; ++i) {
+    iroha::model::Transaction tx;
+    tx.creator_account_id = account.account_id;
+    tx.tx_counter = i;
+    txs.push_back(tx);
+    iroha::hash256_t cursor;
+    cursor.fill(i + 1);
+    cursors.push_back(cursor);
+  }
+  // read in pages of two
+  EXPECT_CALL(*block_query,
+              getAccountTransactions(account.account_id, _, _))
+      .WillRepeatedly(Invoke(
+          [&txs, &cursors](const std::string &,
+                           const nonstd::optional<iroha::hash256_t> &after_hash,
+                           uint32_t limit) {
+            size_t begin = 0;
+            if (after_hash.has_value()) {
+              begin = std::find(cursors.begin(), cursors.end(),
+                                after_hash.value())
+                  - cursors.begin() + 1;
+            }
+            auto end = std::min(txs.size(), begin + limit);
+            iroha::ametsuchi::TransactionPage page;
+            page.transactions.assign(txs.begin() + begin, txs.begin() + end);
+            if (end < txs.size()) {
+              page.next_hash = cursors.at(end - 1);
+            }
+            return nonstd::make_optional(page);
+          }));
+
+  auto query = iroha::protocol::Query();
+  query.set_creator_account_id(account.account_id);
+  query.mutable_get_account_transactions()->set_account_id(account.account_id);
+  query.mutable_get_account_transactions()->set_page_size(2);
+
+  std::vector<int> page_sizes;
+  std::vector<uint64_t> counters;
+  auto stat = torii_utils::QuerySyncClient(Ip, Port).FindStream(
+      query, [&](const iroha::protocol::QueryResponse &response) {
+        ASSERT_TRUE(response.has_transactions_response());
+        const auto &page = response.transactions_response();
+        page_sizes.push_back(page.transactions_size());
+        for (const auto &tx : page.transactions()) {
+          counters.push_back(tx.meta().tx_counter());
+        }
+      });
+  ASSERT_TRUE(stat.ok());
+  ASSERT_EQ(page_sizes, (std::vector<int>{2, 2, 1}));
+  ASSERT_EQ(counters, (std::vector<uint64_t>{0, 1, 2, 3, 4}));
+
+  // a single page continues from the cursor
+  query.mutable_get_account_transactions()->set_after_tx_hash(
+      cursors.at(1).to_string());
+  iroha::protocol::QueryResponse response;
+  stat = torii_utils::QuerySyncClient(Ip, Port).Find(query, response);
+  ASSERT_TRUE(stat.ok());
+  ASSERT_EQ(response.transactions_response().transactions_size(), 2);
+  ASSERT_EQ(
+      response.transactions_response().transactions(0).meta().tx_counter(),
+      2);
+  ASSERT_EQ(response.transactions_response().next_tx_hash(),
+            cursors.at(3).to_string());
+
+  // a malformed cursor is rejected
+  query.mutable_get_account_transactions()->set_after_tx_hash("cursor");
+  stat = torii_utils::QuerySyncClient(Ip, Port).Find(query, response);
+  ASSERT_TRUE(stat.ok());
+  ASSERT_EQ(response.error_response().reason(),
+            iroha::protocol::ErrorResponse::WRONG_FORMAT);
+}
+
 TEST_F(ToriiServiceTest, FindManyTimesWhereQueryServiceSync) {
   EXPECT_CALL(*statelessValidatorMock,
               validate(A<std::shared_ptr<const iroha::model::Query>>()))
@@ -16,6 +16,7 @@ limitations under the License.
 
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 #include "module/irohad/network/network_mocks.hpp"
+#include "module/irohad/simulator/simulator_mocks.hpp"
 #include "module/irohad/validation/validation_mocks.hpp"
 
 #include <endpoint.pb.h>
@@ -24,7 +25,9 @@ limitations under the License.
 #include <chrono>
 #include <main/server_runner.hpp>
 #include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 #include <torii/command_client.hpp>
 #include <torii/command_service.hpp>
 #include <torii/processor/query_processor_impl.hpp>
@@ -38,11 +41,15 @@ constexpr int Port = 50051;
 constexpr size_t TimesToriiBlocking = 5;
 constexpr size_t TimesToriiNonBlocking = 5;
 constexpr size_t TimesFind = 10;
+constexpr size_t ToriiQueues = 2;
+constexpr size_t ToriiThreads = 4;
+constexpr size_t ConcurrentClients = 8;
 
 using ::testing::Return;
 using ::testing::A;
 using ::testing::_;
 using ::testing::AtLeast;
+using ::testing::Invoke;
 
 using namespace iroha::network;
 using namespace iroha::validation;
@@ -51,10 +58,22 @@ using namespace iroha::ametsuchi;
 class ToriiServiceTest : public testing::Test {
  public:
   virtual void SetUp() {
-    runner = new ServerRunner(std::string(Ip) + ":" + std::to_string(Port));
+    runner = new ServerRunner(std::string(Ip) + ":" + std::to_string(Port),
+                              ToriiQueues, ToriiThreads);
     th = std::thread([this] {
       // ----------- Command Service --------------
       pcsMock = std::make_shared<MockPeerCommunicationService>();
+      vpcMock = std::make_shared<
+          iroha::simulator::MockVerifiedProposalCreator>();
+      EXPECT_CALL(*pcsMock, on_proposal())
+          .WillRepeatedly(Return(prop_notifier.get_observable()));
+      EXPECT_CALL(*pcsMock, on_commit())
+          .WillRepeatedly(Return(commit_notifier.get_observable()));
+      EXPECT_CALL(*pcsMock, on_rejected())
+          .WillRepeatedly(Return(
+              rxcpp::observable<>::empty<iroha::model::Transaction>()));
+      EXPECT_CALL(*vpcMock, on_verified_proposal())
+          .WillRepeatedly(Return(verified_prop_notifier.get_observable()));
       statelessValidatorMock = std::make_shared<MockStatelessValidator>();
       wsv_query = std::make_shared<MockWsvQuery>();
       block_query = std::make_shared<MockBlockQuery>();
@@ -62,7 +81,7 @@ class ToriiServiceTest : public testing::Test {
 
       auto tx_processor =
           std::make_shared<iroha::torii::TransactionProcessorImpl>(
-              pcsMock, statelessValidatorMock);
+              pcsMock, statelessValidatorMock, vpcMock);
       auto pb_tx_factory =
           std::make_shared<iroha::model::converters::PbTransactionFactory>();
       auto command_service =
@@ -80,8 +99,11 @@ class ToriiServiceTest : public testing::Test {
       auto pb_query_resp_factory =
           std::make_shared<iroha::model::converters::PbQueryResponseFactory>();
 
+      auto block_streamer =
+          std::make_shared<iroha::torii::BlockStreamer>(block_query, pcsMock);
+
       auto query_service = std::make_unique<torii::QueryService>(
-          pb_query_factory, pb_query_resp_factory, qpi);
+          pb_query_factory, pb_query_resp_factory, qpi, block_streamer);
 
       //----------- Server run ----------------
       runner->run(std::move(command_service), std::move(query_service));
@@ -103,6 +125,10 @@ class ToriiServiceTest : public testing::Test {
   std::shared_ptr<MockBlockQuery> block_query;
 
   std::shared_ptr<MockPeerCommunicationService> pcsMock;
+  std::shared_ptr<iroha::simulator::MockVerifiedProposalCreator> vpcMock;
+  rxcpp::subjects::subject<iroha::model::Proposal> prop_notifier;
+  rxcpp::subjects::subject<iroha::model::Proposal> verified_prop_notifier;
+  rxcpp::subjects::subject<Commit> commit_notifier;
   std::shared_ptr<MockStatelessValidator> statelessValidatorMock;
 };
 
@@ -175,3 +201,213 @@ TEST_F(ToriiServiceTest, ToriiWhenNonBlocking) {
     ;
   ASSERT_EQ(count, TimesToriiNonBlocking);
 }
+
+TEST_F(ToriiServiceTest, ToriiWhenConcurrentClients) {
+  EXPECT_CALL(*statelessValidatorMock,
+              validate(A<const iroha::model::Transaction &>()))
+      .Times(ConcurrentClients * TimesToriiBlocking)
+      .WillRepeatedly(Return(true));
+
+  EXPECT_CALL(*pcsMock, propagate_transaction(_)).Times(AtLeast(1));
+
+  std::atomic_int succeeded{0};
+  std::vector<std::thread> clients;
+  for (size_t c = 0; c < ConcurrentClients; ++c) {
+    clients.emplace_back([c, &succeeded] {
+      for (size_t i = 0; i < TimesToriiBlocking; ++i) {
+        iroha::protocol::ToriiResponse response;
+        auto new_tx = iroha::protocol::Transaction();
+        auto meta = new_tx.mutable_meta();
+        meta->set_tx_counter(i);
+        meta->set_creator_account_id("account" + std::to_string(c));
+        auto stat = torii::CommandSyncClient(Ip, Port).Torii(new_tx, response);
+        if (stat.ok()
+            and response.validation()
+                == iroha::protocol::STATELESS_VALIDATION_SUCCESS) {
+          succeeded++;
+        }
+      }
+    });
+  }
+  for (auto &client : clients) {
+    client.join();
+  }
+  ASSERT_EQ(succeeded, ConcurrentClients * TimesToriiBlocking);
+}
+
+TEST_F(ToriiServiceTest, ToriiBatchReturnsStatusPerTransaction) {
+  // transactions with even counter are valid
+  EXPECT_CALL(*statelessValidatorMock,
+              validate(A<const iroha::model::Transaction &>()))
+      .Times(TimesToriiBlocking)
+      .WillRepeatedly(::testing::Invoke([](const auto &tx) {
+        return tx.tx_counter % 2 == 0;
+      }));
+
+  EXPECT_CALL(*pcsMock, propagate_transaction(_)).Times(AtLeast(1));
+
+  iroha::protocol::TxList txs;
+  for (size_t i = 0; i < TimesToriiBlocking; ++i) {
+    auto meta = txs.add_transactions()->mutable_meta();
+    meta->set_tx_counter(i);
+    meta->set_creator_account_id("accountA");
+  }
+  // the same transaction twice in one batch
+  *txs.add_transactions() = txs.transactions(0);
+
+  iroha::protocol::ToriiBatchResponse response;
+  auto stat = torii::CommandSyncClient(Ip, Port).ToriiBatch(txs, response);
+  ASSERT_TRUE(stat.ok());
+  ASSERT_EQ(response.responses_size(), TimesToriiBlocking + 1);
+  for (size_t i = 0; i < TimesToriiBlocking; ++i) {
+    ASSERT_EQ(response.responses(i).validation(),
+              i % 2 == 0 ? iroha::protocol::STATELESS_VALIDATION_SUCCESS
+                         : iroha::protocol::STATELESS_VALIDATION_FAILED);
+  }
+  ASSERT_EQ(response.responses(TimesToriiBlocking).validation(),
+            iroha::protocol::STATELESS_VALIDATION_FAILED);
+}
+
+TEST_F(ToriiServiceTest, StatusStreamFollowsTransaction) {
+  EXPECT_CALL(*statelessValidatorMock,
+              validate(A<const iroha::model::Transaction &>()))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*pcsMock, propagate_transaction(_)).Times(1);
+
+  auto new_tx = iroha::protocol::Transaction();
+  auto meta = new_tx.mutable_meta();
+  meta->set_tx_counter(1);
+  meta->set_creator_account_id("accountA");
+  iroha::protocol::ToriiResponse response;
+  ASSERT_TRUE(torii::CommandSyncClient(Ip, Port).Torii(new_tx, response).ok());
+
+  std::vector<iroha::protocol::TxStatus> statuses;
+  std::atomic_bool subscribed{false};
+  std::thread reader([&response, &statuses, &subscribed] {
+    iroha::protocol::TxStatusRequest request;
+    request.set_tx_hash(response.tx_hash());
+    auto stat = torii::CommandSyncClient(Ip, Port).StatusStream(
+        request, [&statuses, &subscribed](const auto &status) {
+          statuses.push_back(status.status());
+          subscribed = true;
+        });
+    ASSERT_TRUE(stat.ok());
+  });
+  // the last known status is sent right after subscription
+  while (not subscribed) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  // transaction as it arrives in proposal and block
+  auto model_tx =
+      *iroha::model::converters::PbTransactionFactory().deserialize(new_tx);
+  iroha::model::Proposal proposal(
+      std::vector<iroha::model::Transaction>{model_tx});
+  proposal.height = 2;
+  prop_notifier.get_subscriber().on_next(proposal);
+  verified_prop_notifier.get_subscriber().on_next(proposal);
+  iroha::model::Block block;
+  block.height = 2;
+  block.transactions = {model_tx};
+  commit_notifier.get_subscriber().on_next(rxcpp::observable<>::just(block));
+
+  reader.join();
+  ASSERT_EQ(statuses,
+            (std::vector<iroha::protocol::TxStatus>{
+                iroha::protocol::TX_STATELESS_PASSED,
+                iroha::protocol::TX_STATEFUL_PASSED,
+                iroha::protocol::TX_COMMITTED}));
+}
+
+TEST_F(ToriiServiceTest, StatusStreamWhenRejected) {
+  auto new_tx = iroha::protocol::Transaction();
+  auto meta = new_tx.mutable_meta();
+  meta->set_tx_counter(2);
+  meta->set_creator_account_id("accountA");
+  auto model_tx =
+      iroha::model::converters::PbTransactionFactory().deserialize(new_tx);
+
+  // proposal with transaction and verified proposal without it
+  iroha::model::Proposal proposal(
+      std::vector<iroha::model::Transaction>{*model_tx});
+  proposal.height = 3;
+  iroha::model::Proposal verified(std::vector<iroha::model::Transaction>{});
+  verified.height = 3;
+  prop_notifier.get_subscriber().on_next(proposal);
+  verified_prop_notifier.get_subscriber().on_next(verified);
+
+  std::vector<iroha::protocol::TxStatus> statuses;
+  iroha::protocol::TxStatusRequest request;
+  request.set_tx_hash(model_tx->tx_hash.to_string());
+  auto stat = torii::CommandSyncClient(Ip, Port).StatusStream(
+      request, [&statuses](const auto &status) {
+        statuses.push_back(status.status());
+      });
+  ASSERT_TRUE(stat.ok());
+  // final status is known already, stream ends at once
+  ASSERT_EQ(statuses,
+            (std::vector<iroha::protocol::TxStatus>{
+                iroha::protocol::TX_REJECTED}));
+}
+
+TEST_F(ToriiServiceTest, SubscribeBlocksReplaysAndFollowsLedger) {
+  std::mutex ledger_mutex;
+  std::vector<iroha::model::Block> ledger;
+  auto append = [&ledger, &ledger_mutex] {
+    std::lock_guard<std::mutex> lock(ledger_mutex);
+    iroha::model::Block block;
+    block.height = ledger.size() + 1;
+    block.hash.fill(block.height);
+    ledger.push_back(block);
+    return block;
+  };
+  EXPECT_CALL(*block_query, getBlocks(_, _))
+      .WillRepeatedly(
+          Invoke([&ledger, &ledger_mutex](uint32_t from, uint32_t to) {
+            std::lock_guard<std::mutex> lock(ledger_mutex);
+            std::vector<iroha::model::Block> blocks;
+            for (auto height = from;
+                 height <= to and height <= ledger.size();
+                 ++height) {
+              blocks.push_back(ledger.at(height - 1));
+            }
+            return rxcpp::observable<>::iterate(blocks);
+          }));
+  append();
+  append();
+
+  // history is replayed, then committed block follows
+  std::vector<uint64_t> heights;
+  std::string resume_token;
+  iroha::protocol::BlocksSubscription request;
+  request.set_from_height(1);
+  auto stat = torii_utils::QuerySyncClient(Ip, Port).SubscribeBlocks(
+      request, [&](const iroha::protocol::BlockEvent &event) {
+        heights.push_back(event.block().meta().height());
+        if (heights.size() == 2) {
+          resume_token = event.resume_token();
+          commit_notifier.get_subscriber().on_next(
+              rxcpp::observable<>::just(append()));
+        }
+        return heights.size() < 3;
+      });
+  ASSERT_EQ(stat.error_code(), grpc::StatusCode::CANCELLED);
+  ASSERT_EQ(heights, (std::vector<uint64_t>{1, 2, 3}));
+
+  // resumed stream starts after the acknowledged block
+  heights.clear();
+  request.set_resume_token(resume_token);
+  torii_utils::QuerySyncClient(Ip, Port).SubscribeBlocks(
+      request, [&heights](const iroha::protocol::BlockEvent &event) {
+        heights.push_back(event.block().meta().height());
+        return false;
+      });
+  ASSERT_EQ(heights, (std::vector<uint64_t>{3}));
+
+  // token of another chain is refused
+  resume_token.back() ^= 1;
+  request.set_resume_token(resume_token);
+  stat = torii_utils::QuerySyncClient(Ip, Port).SubscribeBlocks(
+      request, [](const iroha::protocol::BlockEvent &) { return true; });
+  ASSERT_EQ(stat.error_code(), grpc::StatusCode::FAILED_PRECONDITION);
+}
@@ -16,16 +16,22 @@
  */
 
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include <stdexcept>
 
 #include "model/query_execution.hpp"
 #include <model/queries/responses/account_assets_response.hpp>
 #include "model/queries/responses/account_response.hpp"
+#include "model/queries/responses/asset_holders_response.hpp"
 #include "model/queries/responses/error_response.hpp"
+#include "model/queries/responses/query_batch_response.hpp"
+#include "model/queries/responses/transactions_response.hpp"
+#include "model/commands/add_asset_quantity.hpp"
 
 using ::testing::Return;
 using ::testing::AtLeast;
 using ::testing::_;
 using ::testing::AllOf;
+using ::testing::Invoke;
 
 using namespace iroha::ametsuchi;
 
@@ -75,8 +81,8 @@ iroha::model::Account get_default_adversary() {
  * @param test_wsv
  * @param test_blocks
  */
-void set_default_ametsuchi(MockWsvQuery &test_wsv,
-                           MockBlockQuery &test_blocks) {
+template <typename Wsv>
+void set_default_ametsuchi(Wsv &test_wsv, MockBlockQuery &test_blocks) {
   // If No account exist - return nullopt
   EXPECT_CALL(test_wsv, getAccount(_)).WillRepeatedly(Return(nonstd::nullopt));
 
@@ -101,6 +107,14 @@ void set_default_ametsuchi(MockWsvQuery &test_wsv,
   acct_asset.balance = 150;
   EXPECT_CALL(test_wsv, getAccountAsset(ACCOUNT_ID, ASSET_ID))
       .WillRepeatedly(Return(acct_asset));
+
+  // If no account exist - return empty account assets
+  EXPECT_CALL(test_wsv, getAccountAssets(_))
+      .WillRepeatedly(Return(std::vector<iroha::model::AccountAsset>{}));
+  // Test account has only test assets
+  EXPECT_CALL(test_wsv, getAccountAssets(ACCOUNT_ID))
+      .WillRepeatedly(
+          Return(std::vector<iroha::model::AccountAsset>{acct_asset}));
 }
 
 
@@ -263,3 +277,357 @@ TEST(QueryExecutor, get_account_assets) {
 
   // TODO: tests for signatures
 }
+
+TEST(QueryExecutor, get_all_account_assets) {
+  auto wsv_queries = std::make_shared<MockWsvQuery>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+
+  auto query_proccesor =
+      iroha::model::QueryProcessingFactory(wsv_queries, block_queries);
+
+  set_default_ametsuchi(*wsv_queries, *block_queries);
+
+  // Valid cases:
+  // 1. Admin asks all assets of account_id
+  auto query = std::make_shared<iroha::model::GetAccountAssets>();
+  query->account_id = ACCOUNT_ID;
+  query->creator_account_id = ADMIN_ID;
+  query->signature.pubkey = get_default_creator().master_key;
+  auto response = query_proccesor.execute(query);
+  auto cast_resp =
+      std::dynamic_pointer_cast<iroha::model::AccountAssetsResponse>(response);
+  ASSERT_NE(cast_resp, nullptr);
+  ASSERT_EQ(cast_resp->acct_assets.size(), 1);
+  ASSERT_EQ(cast_resp->acct_assets.at(0).account_id, ACCOUNT_ID);
+  ASSERT_EQ(cast_resp->acct_assets.at(0).asset_id, ASSET_ID);
+
+  // --------- Non valid cases: -------
+
+  // 1. Asking account without assets
+  query->account_id = "nonacct";
+  response = query_proccesor.execute(query);
+  cast_resp =
+      std::dynamic_pointer_cast<iroha::model::AccountAssetsResponse>(response);
+  ASSERT_EQ(cast_resp, nullptr);
+  auto err_resp =
+      std::dynamic_pointer_cast<iroha::model::ErrorResponse>(response);
+  ASSERT_EQ(err_resp->reason, iroha::model::ErrorResponse::NO_ACCOUNT_ASSETS);
+
+  // 2. No rights to ask
+  query->account_id = ACCOUNT_ID;
+  query->creator_account_id = ADVERSARY_ID;
+  query->signature.pubkey = get_default_adversary().master_key;
+  response = query_proccesor.execute(query);
+  err_resp = std::dynamic_pointer_cast<iroha::model::ErrorResponse>(response);
+  ASSERT_EQ(err_resp->reason, iroha::model::ErrorResponse::STATEFUL_INVALID);
+}
+
+TEST(QueryExecutor, get_asset_holders) {
+  auto wsv_queries = std::make_shared<MockWsvQuery>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+
+  auto query_proccesor =
+      iroha::model::QueryProcessingFactory(wsv_queries, block_queries);
+
+  set_default_ametsuchi(*wsv_queries, *block_queries);
+
+  std::vector<iroha::model::AccountAsset> holders;
+  for (auto account_id : {ACCOUNT_ID, ADMIN_ID}) {
+    auto holder = iroha::model::AccountAsset();
+    holder.account_id = account_id;
+    holder.asset_id = ASSET_ID;
+    holder.balance = 100;
+    holders.push_back(holder);
+  }
+  // page of one holder is requested with one extra holder
+  EXPECT_CALL(*wsv_queries, getAssetHolders(ASSET_ID, "", 0, 2, true))
+      .WillOnce(Return(holders));
+
+  // Valid cases:
+  // 1. Admin asks first page of holders
+  auto query = std::make_shared<iroha::model::GetAssetHolders>();
+  query->asset_id = ASSET_ID;
+  query->page_size = 1;
+  query->order_by_balance = true;
+  query->creator_account_id = ADMIN_ID;
+  query->signature.pubkey = get_default_creator().master_key;
+  auto response = query_proccesor.execute(query);
+  auto cast_resp =
+      std::dynamic_pointer_cast<iroha::model::AssetHoldersResponse>(response);
+  ASSERT_NE(cast_resp, nullptr);
+  ASSERT_EQ(cast_resp->holders.size(), 1);
+  ASSERT_EQ(cast_resp->holders.at(0).account_id, ACCOUNT_ID);
+  ASSERT_EQ(cast_resp->next_account_id, ACCOUNT_ID);
+  ASSERT_EQ(cast_resp->next_balance, 100);
+
+  // --------- Non valid cases: -------
+
+  // 1. Account without read_all_accounts asks holders
+  query->creator_account_id = ACCOUNT_ID;
+  query->signature.pubkey = get_default_account().master_key;
+  response = query_proccesor.execute(query);
+  auto err_resp =
+      std::dynamic_pointer_cast<iroha::model::ErrorResponse>(response);
+  ASSERT_EQ(err_resp->reason, iroha::model::ErrorResponse::STATEFUL_INVALID);
+}
+
+TEST(QueryExecutor, get_account_transactions_page) {
+  auto wsv_queries = std::make_shared<MockWsvQuery>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+
+  auto query_proccesor =
+      iroha::model::QueryProcessingFactory(wsv_queries, block_queries);
+
+  set_default_ametsuchi(*wsv_queries, *block_queries);
+
+  iroha::ametsuchi::TransactionPage page;
+  for (size_t i = 0; i < 2; ++i) {
+    iroha::model::Transaction tx;
+    tx.creator_account_id = ACCOUNT_ID;
+    tx.tx_counter = i;
+    page.transactions.push_back(tx);
+  }
+  iroha::hash256_t next_hash;
+  next_hash.fill(0xB);
+  page.next_hash = next_hash;
+  iroha::hash256_t after_hash;
+  after_hash.fill(0xA);
+  EXPECT_CALL(*block_queries,
+              getAccountTransactions(
+                  ACCOUNT_ID,
+                  nonstd::optional<iroha::hash256_t>(after_hash),
+                  2))
+      .WillOnce(Return(page));
+
+  auto query = std::make_shared<iroha::model::GetAccountTransactions>();
+  query->account_id = ACCOUNT_ID;
+  query->after_hash = after_hash;
+  query->page_size = 2;
+  query->creator_account_id = ACCOUNT_ID;
+  query->signature.pubkey = get_default_account().master_key;
+  auto response = query_proccesor.execute(query);
+  auto cast_resp =
+      std::dynamic_pointer_cast<iroha::model::TransactionsResponse>(response);
+  ASSERT_NE(cast_resp, nullptr);
+  std::vector<uint64_t> counters;
+  cast_resp->transactions.subscribe(
+      [&counters](auto tx) { counters.push_back(tx.tx_counter); });
+  ASSERT_EQ(counters, (std::vector<uint64_t>{0, 1}));
+  // cursor of the next page is passed apart from transactions
+  ASSERT_EQ(cast_resp->next_tx_hash, next_hash);
+}
+
+TEST(QueryExecutor, get_account_cached_per_content) {
+  auto wsv_queries = std::make_shared<MockWsvQuery>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+  auto cache = std::make_shared<iroha::model::QueryResultCache>(size_t{100});
+
+  auto query_proccesor = iroha::model::QueryProcessingFactory(
+      wsv_queries, block_queries, cache);
+
+  set_default_ametsuchi(*wsv_queries, *block_queries);
+
+  // 1. Admin reads the account, result is cached
+  auto query = std::make_shared<iroha::model::GetAccount>();
+  query->account_id = ACCOUNT_ID;
+  query->creator_account_id = ADMIN_ID;
+  query->query_hash.fill(1);
+  auto response = query_proccesor.execute(query);
+  ASSERT_NE(
+      std::dynamic_pointer_cast<iroha::model::AccountResponse>(response),
+      nullptr);
+
+  // 2. Adversary is still checked for permissions
+  query->creator_account_id = ADVERSARY_ID;
+  response = query_proccesor.execute(query);
+  auto err_resp =
+      std::dynamic_pointer_cast<iroha::model::ErrorResponse>(response);
+  ASSERT_NE(err_resp, nullptr);
+  ASSERT_EQ(err_resp->reason, iroha::model::ErrorResponse::STATEFUL_INVALID);
+
+  // 3. Account owner gets the cached result for its own query
+  query->creator_account_id = ACCOUNT_ID;
+  query->query_hash.fill(2);
+  response = query_proccesor.execute(query);
+  auto cast_resp =
+      std::dynamic_pointer_cast<iroha::model::AccountResponse>(response);
+  ASSERT_NE(cast_resp, nullptr);
+  ASSERT_EQ(cast_resp->account.account_id, ACCOUNT_ID);
+  ASSERT_EQ(cast_resp->query_hash, query->query_hash);
+  ASSERT_EQ(cache->metrics().hits.load(), 1);
+
+  // 4. Commit touching the account evicts the result
+  auto add = std::make_shared<iroha::model::AddAssetQuantity>();
+  add->account_id = ACCOUNT_ID;
+  iroha::model::Transaction tx;
+  tx.commands.push_back(add);
+  iroha::model::Block block;
+  block.height = 1;
+  block.transactions.push_back(tx);
+  query_proccesor.onCommit(block);
+  query_proccesor.execute(query);
+  ASSERT_EQ(cache->metrics().hits.load(), 1);
+
+  // 5. Errors are not cached
+  query->account_id = "nobody@test";
+  query->creator_account_id = ADMIN_ID;
+  for (size_t i = 0; i < 2; ++i) {
+    err_resp = std::dynamic_pointer_cast<iroha::model::ErrorResponse>(
+        query_proccesor.execute(query));
+    ASSERT_NE(err_resp, nullptr);
+    ASSERT_EQ(err_resp->reason, iroha::model::ErrorResponse::NO_ACCOUNT);
+  }
+  ASSERT_EQ(cache->metrics().hits.load(), 1);
+}
+
+TEST(QueryExecutor, query_batch_executed_on_snapshot) {
+  auto wsv_queries = std::make_shared<MockReadOnlyWsv>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+  auto cache = std::make_shared<iroha::model::QueryResultCache>(size_t{100});
+
+  auto query_proccesor = iroha::model::QueryProcessingFactory(
+      wsv_queries, block_queries, cache);
+
+  set_default_ametsuchi(*wsv_queries, *block_queries);
+  EXPECT_CALL(*wsv_queries, snapshot(_))
+      .WillOnce(Invoke([](std::function<void()> function) {
+        function();
+        return true;
+      }));
+
+  auto account_query = std::make_shared<iroha::model::GetAccount>();
+  account_query->account_id = ACCOUNT_ID;
+  account_query->creator_account_id = ADMIN_ID;
+  // result read apart from the batch is cached
+  query_proccesor.execute(account_query);
+
+  auto assets_query = std::make_shared<iroha::model::GetAccountAssets>();
+  assets_query->account_id = ACCOUNT_ID;
+  assets_query->creator_account_id = ADMIN_ID;
+
+  auto batch = std::make_shared<iroha::model::QueryBatch>();
+  batch->creator_account_id = ADMIN_ID;
+  batch->query_hash.fill(3);
+  batch->queries.push_back(assets_query);
+  batch->queries.push_back(account_query);
+
+  auto response = query_proccesor.execute(batch);
+  auto cast_resp =
+      std::dynamic_pointer_cast<iroha::model::QueryBatchResponse>(response);
+  ASSERT_NE(cast_resp, nullptr);
+  ASSERT_EQ(cast_resp->query_hash, batch->query_hash);
+  ASSERT_EQ(cast_resp->responses.size(), 2);
+  ASSERT_NE(std::dynamic_pointer_cast<iroha::model::AccountAssetsResponse>(
+                cast_resp->responses.at(0)),
+            nullptr);
+  ASSERT_NE(std::dynamic_pointer_cast<iroha::model::AccountResponse>(
+                cast_resp->responses.at(1)),
+            nullptr);
+  // cached result may be newer than the snapshot
+  ASSERT_EQ(cache->metrics().hits.load(), 0);
+}
+
+TEST(QueryExecutor, query_batch_not_supported_without_snapshots) {
+  auto wsv_queries = std::make_shared<MockWsvQuery>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+
+  auto query_proccesor =
+      iroha::model::QueryProcessingFactory(wsv_queries, block_queries);
+
+  set_default_ametsuchi(*wsv_queries, *block_queries);
+
+  auto account_query = std::make_shared<iroha::model::GetAccount>();
+  account_query->account_id = ACCOUNT_ID;
+  account_query->creator_account_id = ADMIN_ID;
+  auto batch = std::make_shared<iroha::model::QueryBatch>();
+  batch->creator_account_id = ADMIN_ID;
+  batch->queries.push_back(account_query);
+
+  auto response = query_proccesor.execute(batch);
+  auto err_resp =
+      std::dynamic_pointer_cast<iroha::model::ErrorResponse>(response);
+  ASSERT_NE(err_resp, nullptr);
+  ASSERT_EQ(err_resp->reason, iroha::model::ErrorResponse::NOT_SUPPORTED);
+}
+
+TEST(QueryExecutor, query_batch_rejected_when_too_large) {
+  auto wsv_queries = std::make_shared<MockReadOnlyWsv>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+
+  auto query_proccesor =
+      iroha::model::QueryProcessingFactory(wsv_queries, block_queries);
+
+  set_default_ametsuchi(*wsv_queries, *block_queries);
+  EXPECT_CALL(*wsv_queries, snapshot(_)).Times(0);
+
+  auto account_query = std::make_shared<iroha::model::GetAccount>();
+  account_query->account_id = ACCOUNT_ID;
+  account_query->creator_account_id = ADMIN_ID;
+  auto batch = std::make_shared<iroha::model::QueryBatch>();
+  batch->creator_account_id = ADMIN_ID;
+  batch->queries.assign(
+      iroha::model::QueryProcessingFactory::MAX_BATCH_QUERIES + 1,
+      account_query);
+
+  auto err_resp = std::dynamic_pointer_cast<iroha::model::ErrorResponse>(
+      query_proccesor.execute(batch));
+  ASSERT_NE(err_resp, nullptr);
+  ASSERT_EQ(err_resp->reason, iroha::model::ErrorResponse::WRONG_FORMAT);
+}
+
+TEST(QueryExecutor, query_batch_not_supported_with_transactions) {
+  auto wsv_queries = std::make_shared<MockReadOnlyWsv>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+
+  auto query_proccesor =
+      iroha::model::QueryProcessingFactory(wsv_queries, block_queries);
+
+  set_default_ametsuchi(*wsv_queries, *block_queries);
+  EXPECT_CALL(*wsv_queries, snapshot(_)).Times(0);
+
+  // block store is not part of the snapshot
+  auto txs_query = std::make_shared<iroha::model::GetAccountTransactions>();
+  txs_query->account_id = ACCOUNT_ID;
+  txs_query->creator_account_id = ACCOUNT_ID;
+  auto batch = std::make_shared<iroha::model::QueryBatch>();
+  batch->creator_account_id = ACCOUNT_ID;
+  batch->queries.push_back(txs_query);
+
+  auto err_resp = std::dynamic_pointer_cast<iroha::model::ErrorResponse>(
+      query_proccesor.execute(batch));
+  ASSERT_NE(err_resp, nullptr);
+  ASSERT_EQ(err_resp->reason, iroha::model::ErrorResponse::NOT_SUPPORTED);
+}
+
+TEST(QueryExecutor, query_batch_executed_after_snapshot_failure) {
+  auto wsv_queries = std::make_shared<MockReadOnlyWsv>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+
+  auto query_proccesor =
+      iroha::model::QueryProcessingFactory(wsv_queries, block_queries);
+
+  set_default_ametsuchi(*wsv_queries, *block_queries);
+  EXPECT_CALL(*wsv_queries, snapshot(_))
+      .WillOnce(Invoke([](std::function<void()>) -> bool {
+        throw std::runtime_error("connection lost");
+      }))
+      .WillOnce(Invoke([](std::function<void()> function) {
+        function();
+        return true;
+      }));
+
+  auto account_query = std::make_shared<iroha::model::GetAccount>();
+  account_query->account_id = ACCOUNT_ID;
+  account_query->creator_account_id = ADMIN_ID;
+  auto batch = std::make_shared<iroha::model::QueryBatch>();
+  batch->creator_account_id = ADMIN_ID;
+  batch->queries.push_back(account_query);
+
+  ASSERT_THROW(query_proccesor.execute(batch), std::runtime_error);
+
+  // failed snapshot does not leave batches rejected as nested
+  auto cast_resp = std::dynamic_pointer_cast<iroha::model::QueryBatchResponse>(
+      query_proccesor.execute(batch));
+  ASSERT_NE(cast_resp, nullptr);
+  ASSERT_EQ(cast_resp->responses.size(), 1);
+}
@@ -66,3 +66,19 @@ TEST(MapQueue, change_size){
     ASSERT_TRUE(cmap[is[i]] == vs[i]);
   }
 }
+
+TEST(MapQueue, oldest_erased_when_over_size) {
+  structure::MapQueue<int, std::string> queue(2);
+  queue.set(1, "A");
+  queue.set(2, "B");
+  queue.set(3, "C");
+
+  ASSERT_EQ(queue.size(), 2);
+  ASSERT_EQ(queue.exists(1), 0);
+  ASSERT_EQ(queue.front(), 2);
+
+  queue.pop();
+  ASSERT_EQ(queue.size(), 1);
+  ASSERT_EQ(queue.front(), 3);
+  ASSERT_EQ(queue.getMaxKey(), 3);
+}